@@ -0,0 +1,310 @@
+/*
+ * bench.c
+ *
+ * Measures ISHA throughput on the host: the single-lane
+ * ISHAIterateDigest against the multi-lane kernels at various lane
+ * counts, on every instruction set the CPU supports, pbkdf1_many on 1
+ * to N worker threads, the cost of running pbkdf1 in slices, the
+ * checkpoint cache on an increasing iteration count workload, and
+ * PBKDF2 with precomputed HMAC pad states against a naive HMAC.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "isha.h"
+#include "isha_batch.h"
+#include "pbkdf1.h"
+#include "pbkdf1_cache.h"
+#include "hmac.h"
+#include "static_profiler.h"
+#include "pbkdf1_many.h"
+
+#define BENCH_HASHES  (1u << 23)  // hashes per measurement
+#define BENCH_JOBS    256        // pbkdf1_many jobs per measurement
+#define BENCH_DERIVES 2000       // 4096-iteration derivations per measurement
+
+static double now(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+/*
+ * Returns the hashes per second of ISHAIterateDigest on one digest
+ */
+static double bench_scalar(void) {
+	uint32_t md[ISHA_DIGESTWORDS] = { 1, 2, 3, 4, 5 };
+	double start = now();
+
+	ISHAIterateDigest(md, BENCH_HASHES);
+
+	double elapsed = now() - start;
+	// Keep the result live so the loop is not optimized away
+	if (md[0] == 0x12345678) {
+		printf("!\n");
+	}
+	return BENCH_HASHES / elapsed;
+}
+
+/*
+ * Returns the hashes per second of isha_batch_iterate on n lanes
+ */
+static double bench_batch(size_t n) {
+	uint32_t *md = malloc(n * ISHA_DIGESTWORDS * sizeof(*md));
+	uint32_t count = BENCH_HASHES / n;
+
+	for (size_t i = 0; i < n * ISHA_DIGESTWORDS; i++) {
+		md[i] = i;
+	}
+
+	double start = now();
+	isha_batch_iterate(md, n, count);
+	double elapsed = now() - start;
+
+	if (md[0] == 0x12345678) {
+		printf("!\n");
+	}
+	free(md);
+	return (double) count * n / elapsed;
+}
+
+/*
+ * Returns the hashes per second of pbkdf1_many on a pool of nthreads,
+ * for a batch where one job in eight has a much larger iteration count
+ */
+static double bench_many(int nthreads) {
+	static const uint8_t *p[BENCH_JOBS], *s[BENCH_JOBS];
+	static size_t pLen[BENCH_JOBS], sLen[BENCH_JOBS];
+	static uint32_t c[BENCH_JOBS];
+	static uint8_t dk[BENCH_JOBS * ISHA_DIGESTLEN];
+	static error_t status[BENCH_JOBS];
+	pbkdf1_pool_t *pool = pbkdf1_pool_create(nthreads);
+	double hashes = 0;
+
+	for (int j = 0; j < BENCH_JOBS; j++) {
+		p[j] = (const uint8_t *) "password";
+		s[j] = (const uint8_t *) "mysalt";
+		pLen[j] = 8;
+		sLen[j] = 6;
+		c[j] = (j % 8 == 0) ? 200000 : 4096 + j;
+		hashes += c[j];
+	}
+
+	double start = now();
+	pbkdf1_many(pool, p, pLen, s, sLen, c, BENCH_JOBS, dk, ISHA_DIGESTLEN,
+			status);
+	double elapsed = now() - start;
+
+	pbkdf1_pool_destroy(pool);
+	return hashes / elapsed;
+}
+
+/*
+ * Returns the time of one 4096-iteration derivation, in microseconds,
+ * using pbkdf1Step with the given slice (0 for a single pbkdf1 call)
+ */
+static double bench_sliced_once(uint32_t slice) {
+	uint8_t dk[ISHA_DIGESTLEN];
+	Pbkdf1Context ctx;
+	double start = now();
+
+	for (int i = 0; i < BENCH_DERIVES; i++) {
+		if (slice == 0) {
+			pbkdf1((const uint8_t *) "Boulder", 7, (const uint8_t *) "Buffaloes",
+					9, 4096, dk, sizeof(dk));
+		} else {
+			pbkdf1Start(&ctx, (const uint8_t *) "Boulder", 7,
+					(const uint8_t *) "Buffaloes", 9, 4096, dk, sizeof(dk));
+			while (pbkdf1Step(&ctx, slice) == ERROR_IN_PROGRESS)
+				;
+		}
+	}
+
+	return (now() - start) * 1e6 / BENCH_DERIVES;
+}
+
+/*
+ * Best of several runs of bench_sliced_once, to drop warm-up and
+ * scheduling noise from the comparison
+ */
+static double bench_sliced(uint32_t slice) {
+	double best = bench_sliced_once(slice);
+
+	for (int run = 1; run < 5; run++) {
+		double t = bench_sliced_once(slice);
+		if (t < best) {
+			best = t;
+		}
+	}
+	return best;
+}
+
+/*
+ * Derives the same key with c = step, 2 * step, ... 64 * step, as when
+ * calibrating an iteration count, with or without the cache, and
+ * returns the total time in milliseconds
+ */
+static double bench_calibration(Pbkdf1Cache *cache, uint32_t step) {
+	uint8_t dk[ISHA_DIGESTLEN];
+	double start = now();
+
+	for (uint32_t c = step; c <= 64 * step; c += step) {
+		if (cache == NULL) {
+			pbkdf1((const uint8_t *) "Boulder", 7, (const uint8_t *) "Buffaloes",
+					9, c, dk, sizeof(dk));
+		} else {
+			pbkdf1Cached(cache, (const uint8_t *) "Boulder", 7,
+					(const uint8_t *) "Buffaloes", 9, c, dk, sizeof(dk));
+		}
+	}
+
+	return (now() - start) * 1e3;
+}
+
+/*
+ * PBKDF2-HMAC-ISHA, one output block, calling hmacCompute (and so
+ * re-keying) for every iteration: four compressions per iteration
+ */
+static void pbkdf2_naive(const uint8_t *p, size_t pLen, const uint8_t *s,
+		size_t sLen, uint32_t c, uint8_t *dk) {
+	uint8_t msg[64];
+	uint8_t u[ISHA_DIGESTLEN];
+
+	memcpy(msg, s, sLen);
+	memcpy(msg + sLen, "\0\0\0\1", 4);
+	hmacCompute(&ishaHashAlgo, p, pLen, msg, sLen + 4, u);
+	memcpy(dk, u, ISHA_DIGESTLEN);
+
+	for (uint32_t j = 1; j < c; j++) {
+		hmacCompute(&ishaHashAlgo, p, pLen, u, ISHA_DIGESTLEN, u);
+		for (int i = 0; i < ISHA_DIGESTLEN; i++) {
+			dk[i] ^= u[i];
+		}
+	}
+}
+
+/*
+ * Times a 4096-iteration, 20-byte PBKDF2 derivation in microseconds,
+ * and counts the compressions it takes per iteration
+ */
+static double bench_pbkdf2(bool naive, double *compressions) {
+	uint8_t dk[ISHA_DIGESTLEN];
+	double best = 0;
+
+	for (int run = 0; run < 5; run++) {
+		double start = now();
+		if (naive) {
+			pbkdf2_naive((const uint8_t *) "Boulder", 7,
+					(const uint8_t *) "Buffaloes", 9, 4096, dk);
+		} else {
+			pbkdf2(&ishaHashAlgo, (const uint8_t *) "Boulder", 7,
+					(const uint8_t *) "Buffaloes", 9, 4096, dk, sizeof(dk));
+		}
+		double t = (now() - start) * 1e6;
+		if (run == 0 || t < best) {
+			best = t;
+		}
+	}
+
+	static_profile_reset();
+	static_profile_on();
+	if (naive) {
+		pbkdf2_naive((const uint8_t *) "Boulder", 7,
+				(const uint8_t *) "Buffaloes", 9, 4096, dk);
+	} else {
+		pbkdf2(&ishaHashAlgo, (const uint8_t *) "Boulder", 7,
+				(const uint8_t *) "Buffaloes", 9, 4096, dk, sizeof(dk));
+	}
+	static_profile_off();
+	*compressions =
+			static_profile_stats(PROFILE_ID_ISHAProcessMessageBlock)->calls
+					/ 4096.0;
+
+	return best;
+}
+
+int main(void) {
+	static const size_t lane_counts[] = { 1, 2, 4, 8, 16, 32, 64, 256 };
+	const int num_counts = sizeof(lane_counts) / sizeof(lane_counts[0]);
+	isha_batch_isa_t best = isha_batch_get_isa();
+	double baseline = bench_scalar();
+
+	printf("ISHAIterateDigest: %.2f Mhash/s\n", baseline / 1e6);
+	printf("%-8s %6s %12s %8s\n", "isa", "lanes", "Mhash/s", "speedup");
+
+	for (int isa = ISHA_BATCH_SCALAR; isa <= best; isa++) {
+		isha_batch_set_isa((isha_batch_isa_t) isa);
+		for (int i = 0; i < num_counts; i++) {
+			double rate = bench_batch(lane_counts[i]);
+			printf("%-8s %6zu %12.2f %7.2fx\n", isha_batch_isa_name(isa),
+					lane_counts[i], rate / 1e6, rate / baseline);
+		}
+	}
+
+	long ncpu = sysconf(_SC_NPROCESSORS_ONLN);
+	int max_threads = (ncpu > 4) ? ncpu : 4;
+	double one_thread = 0;
+
+	printf("\npbkdf1_many, %d mixed jobs, %ld CPU(s) online\n", BENCH_JOBS,
+			ncpu);
+	printf("%-8s %12s %8s\n", "threads", "Mhash/s", "speedup");
+	for (int t = 1; t <= max_threads; t++) {
+		double rate = bench_many(t);
+		if (t == 1) {
+			one_thread = rate;
+		}
+		printf("%-8d %12.2f %7.2fx\n", t, rate / 1e6, rate / one_thread);
+	}
+
+	static const uint32_t slices[] = { 1, 4, 16, 64, 256, 4096 };
+	const int num_slices = sizeof(slices) / sizeof(slices[0]);
+	double monolithic = bench_sliced(0);
+
+	printf("\npbkdf1, 4096 iterations: %.2f usec\n", monolithic);
+	printf("%-8s %12s %9s\n", "slice", "usec", "overhead");
+	for (int i = 0; i < num_slices; i++) {
+		double t = bench_sliced(slices[i]);
+		printf("%-8u %12.2f %8.1f%%\n", slices[i], t,
+				(t - monolithic) * 100 / monolithic);
+	}
+
+	static Pbkdf1Cache cache;
+	double uncached = bench_calibration(NULL, 1000);
+
+	pbkdf1CacheClear(&cache);
+	double cached = bench_calibration(&cache, 1000);
+	const Pbkdf1CacheStats *stats = pbkdf1CacheGetStats(&cache);
+
+	printf("\npbkdf1, c = 1000 .. 64000 in steps of 1000\n");
+	printf("uncached %.2f msec, cached %.2f msec (%.1fx)\n", uncached, cached,
+			uncached / cached);
+	printf("hits %u, misses %u, iterations run %llu, saved %llu\n",
+			stats->hits, stats->misses,
+			(unsigned long long) stats->iterationsRun,
+			(unsigned long long) stats->iterationsSaved);
+	pbkdf1CacheClear(&cache);
+
+	double naive_per_iter, midstate_per_iter;
+	double naive = bench_pbkdf2(true, &naive_per_iter);
+	double midstate = bench_pbkdf2(false, &midstate_per_iter);
+
+	uint8_t dk_naive[ISHA_DIGESTLEN], dk[ISHA_DIGESTLEN];
+	pbkdf2_naive((const uint8_t *) "Boulder", 7, (const uint8_t *) "Buffaloes",
+			9, 4096, dk_naive);
+	pbkdf2(&ishaHashAlgo, (const uint8_t *) "Boulder", 7,
+			(const uint8_t *) "Buffaloes", 9, 4096, dk, sizeof(dk));
+
+	printf("\npbkdf2-hmac-isha, 4096 iterations%s\n",
+			memcmp(dk, dk_naive, sizeof(dk)) ? " (RESULTS DIFFER)" : "");
+	printf("naive hmac:     %8.2f usec, %.2f compressions/iteration\n", naive,
+			naive_per_iter);
+	printf("cloned pads:    %8.2f usec, %.2f compressions/iteration (%.2fx)\n",
+			midstate, midstate_per_iter, naive / midstate);
+
+	return 0;
+}
@@ -0,0 +1,219 @@
+/*
+ * cg_report.c
+ *
+ * Renders the call graph printed by print_callgraph() on the board.
+ * Call sites and callees are resolved to functions with the nm output
+ * of the same build, as for pc_replay.
+ *
+ * The default output lists every sampled function with its total
+ * (inclusive) and self share of the samples, its callers and its
+ * callees, most expensive first. With -d it is a Graphviz digraph
+ * instead:
+ *
+ *   cg_report -d nm.txt callgraph.txt | dot -Tsvg > callgraph.svg
+ *
+ * Usage: cg_report [-d] nm-output callgraph-dump
+ */
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "nm_symtab.h"
+
+// Caller/callee pair resolved to function indices; len is unknown
+typedef struct {
+	size_t caller;
+	size_t callee;
+	uint32_t count;
+} arc_t;
+
+static pc_symbol_t *table;
+static size_t len;
+static uint32_t *self;    // samples in the function itself
+static uint32_t *total;   // samples with the function on the stack
+static arc_t *arcs;
+static size_t num_arcs;
+
+static size_t function_index(uint32_t addr) {
+	int i = pc_symtab_lookup(table, len, addr);
+
+	return (i < 0) ? len : (size_t) i;
+}
+
+static const char *function_name(size_t i) {
+	return (i < len) ? table[i].name : "(unknown)";
+}
+
+static void add_arc(size_t caller, size_t callee, uint32_t count) {
+	for (size_t i = 0; i < num_arcs; i++) {
+		if (arcs[i].caller == caller && arcs[i].callee == callee) {
+			arcs[i].count += count;
+			return;
+		}
+	}
+	arcs[num_arcs++] = (arc_t) { caller, callee, count };
+}
+
+static const uint32_t *sort_key;
+
+// Largest first, then by address
+static int compare_index(const void *a, const void *b) {
+	size_t x = *(const size_t *) a;
+	size_t y = *(const size_t *) b;
+
+	if (sort_key[x] != sort_key[y]) {
+		return (sort_key[x] > sort_key[y]) ? -1 : 1;
+	}
+	return (x < y) ? -1 : (x > y);
+}
+
+static void print_text(uint32_t samples) {
+	size_t *order = calloc(len + 1, sizeof(*order));
+
+	for (size_t i = 0; i <= len; i++) {
+		order[i] = i;
+	}
+	sort_key = total;
+	qsort(order, len + 1, sizeof(*order), compare_index);
+
+	printf("  total    self  function\n");
+	for (size_t k = 0; k <= len && total[order[k]] != 0; k++) {
+		size_t f = order[k];
+
+		printf("%6.1f%%  %5.1f%%  %s\n", 100.0 * total[f] / samples,
+				100.0 * self[f] / samples, function_name(f));
+		for (size_t i = 0; i < num_arcs; i++) {
+			if (arcs[i].callee == f) {
+				printf("                   <- %-32s %8u\n",
+						function_name(arcs[i].caller), (unsigned) arcs[i].count);
+			}
+		}
+		for (size_t i = 0; i < num_arcs; i++) {
+			if (arcs[i].caller == f) {
+				printf("                   -> %-32s %8u\n",
+						function_name(arcs[i].callee), (unsigned) arcs[i].count);
+			}
+		}
+	}
+	free(order);
+}
+
+static void print_dot(uint32_t samples) {
+	printf("digraph callgraph {\n");
+	printf("\tnode [shape=box];\n");
+	for (size_t f = 0; f <= len; f++) {
+		if (total[f] != 0) {
+			printf("\t\"%s\" [label=\"%s\\n%.1f%% (%.1f%% self)\"];\n",
+					function_name(f), function_name(f),
+					100.0 * total[f] / samples, 100.0 * self[f] / samples);
+		}
+	}
+	for (size_t i = 0; i < num_arcs; i++) {
+		printf("\t\"%s\" -> \"%s\" [label=\"%u\"];\n",
+				function_name(arcs[i].caller), function_name(arcs[i].callee),
+				(unsigned) arcs[i].count);
+	}
+	printf("}\n");
+}
+
+int main(int argc, char *argv[]) {
+	FILE *nm, *dump;
+	bool dot = false;
+	uint32_t samples = 0, dropped = 0;
+	size_t max_arcs = 0;
+	char line[256];
+	int opt;
+
+	while ((opt = getopt(argc, argv, "d")) != -1) {
+		if (opt != 'd') {
+			fprintf(stderr, "usage: %s [-d] nm-output callgraph-dump\n", argv[0]);
+			return 2;
+		}
+		dot = true;
+	}
+	if (argc - optind != 2) {
+		fprintf(stderr, "usage: %s [-d] nm-output callgraph-dump\n", argv[0]);
+		return 2;
+	}
+	nm = fopen(argv[optind], "r");
+	if (nm == NULL) {
+		perror(argv[optind]);
+		return 1;
+	}
+	dump = fopen(argv[optind + 1], "r");
+	if (dump == NULL) {
+		perror(argv[optind + 1]);
+		return 1;
+	}
+	if (nm_symtab_read(nm, &table, &len) != 0) {
+		fprintf(stderr, "%s: out of memory\n", argv[0]);
+		return 1;
+	}
+	fclose(nm);
+
+	self = calloc(len + 1, sizeof(*self));
+	total = calloc(len + 1, sizeof(*total));
+	if (self == NULL || total == NULL) {
+		fprintf(stderr, "%s: out of memory\n", argv[0]);
+		return 1;
+	}
+
+	while (fgets(line, sizeof(line), dump) != NULL) {
+		unsigned site, callee, count;
+		unsigned s, d;
+
+		if (sscanf(line, "callgraph: %u samples, %u dropped", &s, &d) == 2) {
+			samples = s;
+			dropped = d;
+			continue;
+		}
+		if (sscanf(line, "edge %x %x %u", &site, &callee, &count) != 3) {
+			continue;
+		}
+
+		if (site == 0) {
+			// Samples in the leaf; the leaf is also on the stack
+			self[function_index(callee)] += count;
+			total[function_index(callee)] += count;
+			continue;
+		}
+		if (num_arcs == max_arcs) {
+			max_arcs = max_arcs ? 2 * max_arcs : 64;
+			arcs = realloc(arcs, max_arcs * sizeof(*arcs));
+			if (arcs == NULL) {
+				fprintf(stderr, "%s: out of memory\n", argv[0]);
+				return 1;
+			}
+		}
+		// The call site is the return address; the call is just before it
+		add_arc(function_index(site - 2), function_index(callee), count);
+	}
+	fclose(dump);
+
+	// Without recursion a function is on the stack once per sample, so
+	// its total is its own samples plus those of the calls it made
+	for (size_t i = 0; i < num_arcs; i++) {
+		total[arcs[i].caller] += arcs[i].count;
+	}
+
+	if (samples == 0) {
+		fprintf(stderr, "%s: no samples in %s\n", argv[0], argv[optind + 1]);
+		return 1;
+	}
+	if (dot) {
+		print_dot(samples);
+	} else {
+		printf("%u samples, %u edges dropped\n", (unsigned) samples,
+				(unsigned) dropped);
+		print_text(samples);
+	}
+
+	free(arcs);
+	free(total);
+	free(self);
+	nm_symtab_free(table, len);
+	return 0;
+}
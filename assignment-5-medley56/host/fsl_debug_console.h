@@ -0,0 +1,15 @@
+/*
+ * fsl_debug_console.h
+ *
+ * Host stand-in for the SDK debug console, so that modules which
+ * report through PRINTF can be built and run off-target.
+ */
+
+#ifndef _FSL_DEBUG_CONSOLE_H_
+#define _FSL_DEBUG_CONSOLE_H_
+
+#include <stdio.h>
+
+#define PRINTF printf
+
+#endif  // _FSL_DEBUG_CONSOLE_H_
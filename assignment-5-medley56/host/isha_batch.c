@@ -0,0 +1,233 @@
+/*
+ * isha_batch.c
+ *
+ * Multi-lane ISHA, with SSE2 and AVX2 kernels on x86-64 selected at
+ * run time and a portable scalar fallback everywhere else.
+ */
+
+#include <string.h>
+
+#include "isha_batch.h"
+
+/* Scalar kernels: one lane per "vector" */
+#define KVEC        uint32_t
+#define KWIDTH      1
+#define KNAME(x)    scalar_##x
+#define KTARGET
+#include "isha_batch_kernel.h"
+#undef KVEC
+#undef KWIDTH
+#undef KNAME
+#undef KTARGET
+
+#if defined(__x86_64__)
+#define ISHA_BATCH_HAVE_X86
+
+typedef uint32_t v4u32 __attribute__((vector_size(16)));
+typedef uint32_t v8u32 __attribute__((vector_size(32)));
+
+/* SSE2 kernels: SSE2 is part of the x86-64 baseline */
+#define KVEC        v4u32
+#define KWIDTH      4
+#define KNAME(x)    sse2_##x
+#define KTARGET     __attribute__((target("sse2")))
+#include "isha_batch_kernel.h"
+#undef KVEC
+#undef KWIDTH
+#undef KNAME
+#undef KTARGET
+
+/* AVX2 kernels: only called when the CPU reports AVX2 */
+#define KVEC        v8u32
+#define KWIDTH      8
+#define KNAME(x)    avx2_##x
+#define KTARGET     __attribute__((target("avx2")))
+#include "isha_batch_kernel.h"
+#undef KVEC
+#undef KWIDTH
+#undef KNAME
+#undef KTARGET
+#endif
+
+// One set of kernels, processing width lanes at a time
+typedef struct {
+	size_t width;
+	void (*compress)(uint32_t *h, size_t stride, const uint32_t *w);
+	void (*iterate)(uint32_t *md, size_t stride, uint32_t count);
+} kernel_t;
+
+// Indexed by isha_batch_isa_t
+static const kernel_t kernels[] = {
+	{ 1, scalar_compress, scalar_iterate },
+#ifdef ISHA_BATCH_HAVE_X86
+	{ 4, sse2_compress, sse2_iterate },
+	{ 8, avx2_compress, avx2_iterate },
+#endif
+};
+
+static const uint32_t isha_iv[ISHA_DIGESTWORDS] = { 0x67452301, 0xEFCDAB89,
+		0x98BADCFE, 0x10325476, 0xC3D2E1F0 };
+
+static int selected_isa = -1;  // -1 until the first call picks one
+
+/*
+ * Returns the best instruction set this CPU supports
+ */
+static isha_batch_isa_t best_isa(void) {
+#ifdef ISHA_BATCH_HAVE_X86
+	if (__builtin_cpu_supports("avx2")) {
+		return ISHA_BATCH_AVX2;
+	}
+	return ISHA_BATCH_SSE2;
+#else
+	return ISHA_BATCH_SCALAR;
+#endif
+}
+
+isha_batch_isa_t isha_batch_get_isa(void) {
+	if (selected_isa < 0) {
+		selected_isa = best_isa();
+	}
+	return (isha_batch_isa_t) selected_isa;
+}
+
+isha_batch_isa_t isha_batch_set_isa(isha_batch_isa_t isa) {
+	isha_batch_isa_t best = best_isa();
+
+	selected_isa = (isa > best) ? best : isa;
+	return (isha_batch_isa_t) selected_isa;
+}
+
+const char *isha_batch_isa_name(isha_batch_isa_t isa) {
+	switch (isa) {
+	case ISHA_BATCH_SCALAR:
+		return "scalar";
+	case ISHA_BATCH_SSE2:
+		return "sse2";
+	case ISHA_BATCH_AVX2:
+		return "avx2";
+	}
+	return "unknown";
+}
+
+/*
+ * Returns the number of 64-byte blocks in the padded message: the
+ * message, a 0x80 byte, and the 8-byte length must all fit
+ */
+static size_t padded_blocks(size_t len) {
+	return (len + 8) / ISHA_BLOCKLEN + 1;
+}
+
+/*
+ * Writes the 16 message words of block b of the padded message, the
+ * same way ISHAInput and ISHAPadMessage would lay out MBlock
+ *
+ * Parameters:
+ *   msg      The message (in)
+ *   len      Message length, in bytes
+ *   b        Block index
+ *   w        Message words; word t is written to w[t * stride] (out)
+ *   stride   Distance between consecutive words in w
+ */
+static void padded_block_words(const uint8_t *msg, size_t len, size_t b,
+		uint32_t *w, size_t stride) {
+	uint8_t block[ISHA_BLOCKLEN];
+	size_t start = b * ISHA_BLOCKLEN;
+
+	for (size_t k = 0; k < ISHA_BLOCKLEN; k++) {
+		size_t pos = start + k;
+		block[k] = (pos < len) ? msg[pos] : (pos == len) ? 0x80 : 0;
+	}
+
+	if (b == padded_blocks(len) - 1) {
+		uint64_t bits = (uint64_t) len * 8;
+		for (int k = 0; k < 8; k++) {
+			block[ISHA_BLOCKLEN - 1 - k] = (uint8_t) (bits >> (8 * k));
+		}
+	}
+
+	for (size_t t = 0; t < 16; t++) {
+		w[t * stride] = ((uint32_t) block[t * 4] << 24)
+				| ((uint32_t) block[t * 4 + 1] << 16)
+				| ((uint32_t) block[t * 4 + 2] << 8)
+				| ((uint32_t) block[t * 4 + 3]);
+	}
+}
+
+/*
+ * Hashes the messages of lanes [first, first + k->width) together.
+ * Lanes with fewer blocks than others keep being compressed on zero
+ * blocks; their digest is copied out as soon as their last real block
+ * has been processed.
+ */
+static void hash_group(const kernel_t *k, const uint8_t *const msgs[],
+		const size_t lens[], size_t n, size_t first, uint32_t *md) {
+	uint32_t h[ISHA_DIGESTWORDS * ISHA_BATCH_MAX_WIDTH];
+	uint32_t w[16 * ISHA_BATCH_MAX_WIDTH];
+	size_t width = k->width;
+	size_t max_blocks = 0;
+
+	for (size_t i = 0; i < width; i++) {
+		size_t nb = padded_blocks(lens[first + i]);
+		if (nb > max_blocks) {
+			max_blocks = nb;
+		}
+		for (int word = 0; word < ISHA_DIGESTWORDS; word++) {
+			h[word * width + i] = isha_iv[word];
+		}
+	}
+
+	for (size_t b = 0; b < max_blocks; b++) {
+		for (size_t i = 0; i < width; i++) {
+			if (b < padded_blocks(lens[first + i])) {
+				padded_block_words(msgs[first + i], lens[first + i], b, w + i,
+						width);
+			} else {
+				for (int t = 0; t < 16; t++) {
+					w[t * width + i] = 0;
+				}
+			}
+		}
+
+		k->compress(h, width, w);
+
+		for (size_t i = 0; i < width; i++) {
+			if (b == padded_blocks(lens[first + i]) - 1) {
+				for (int word = 0; word < ISHA_DIGESTWORDS; word++) {
+					md[word * n + first + i] = h[word * width + i];
+				}
+			}
+		}
+	}
+}
+
+void isha_batch_hash(const uint8_t *const msgs[], const size_t lens[],
+		size_t n, uint32_t *md) {
+	size_t lane = 0;
+
+	// Widest kernels first, then narrower ones for the remainder
+	for (int isa = isha_batch_get_isa(); isa >= 0; isa--) {
+		const kernel_t *k = &kernels[isa];
+		for (; lane + k->width <= n; lane += k->width) {
+			hash_group(k, msgs, lens, n, lane, md);
+		}
+	}
+}
+
+void isha_batch_iterate(uint32_t *md, size_t n, uint32_t count) {
+	size_t lane = 0;
+
+	for (int isa = isha_batch_get_isa(); isa >= 0; isa--) {
+		const kernel_t *k = &kernels[isa];
+		for (; lane + k->width <= n; lane += k->width) {
+			k->iterate(md + lane, n, count);
+		}
+	}
+}
+
+void isha_batch_digest_bytes(const uint32_t *md, size_t n, size_t lane,
+		uint8_t *out, size_t outlen) {
+	for (size_t i = 0; i < outlen && i < ISHA_DIGESTLEN; i++) {
+		out[i] = (uint8_t) (md[(i / 4) * n + lane] >> (24 - 8 * (i % 4)));
+	}
+}
@@ -0,0 +1,94 @@
+/*
+ * isha_batch.h
+ *
+ * Multi-lane ISHA: hashes several independent messages at once, one
+ * message per vector lane. Used for offline key derivation on the host,
+ * where thousands of (password, salt) pairs are processed together.
+ *
+ * State is laid out lane-interleaved: word w of lane j lives at
+ * md[w * nlanes + j], so that each digest word of a group of lanes is
+ * one contiguous vector.
+ */
+
+#ifndef _ISHA_BATCH_H_
+#define _ISHA_BATCH_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "isha.h"
+
+#define ISHA_BATCH_MAX_WIDTH 8  // widest vector supported, in 32-bit lanes (AVX2)
+
+/*
+ * Instruction sets the batch kernels can run on
+ */
+typedef enum {
+	ISHA_BATCH_SCALAR,  // portable C, one lane at a time
+	ISHA_BATCH_SSE2,    // 4 lanes per vector
+	ISHA_BATCH_AVX2     // 8 lanes per vector
+} isha_batch_isa_t;
+
+/*
+ * Returns the instruction set the batch functions will use. This is the
+ * best one the CPU supports unless overridden by isha_batch_set_isa().
+ */
+isha_batch_isa_t isha_batch_get_isa(void);
+
+/*
+ * Selects the instruction set for subsequent batch calls. Requests for
+ * an instruction set the CPU does not support fall back to the best one
+ * that it does.
+ *
+ * Parameters:
+ *   isa   The requested instruction set
+ *
+ * Returns:
+ *   The instruction set actually selected
+ */
+isha_batch_isa_t isha_batch_set_isa(isha_batch_isa_t isa);
+
+/*
+ * Returns a printable name for an instruction set
+ */
+const char *isha_batch_isa_name(isha_batch_isa_t isa);
+
+/*
+ * Computes the ISHA digest of n independent messages. Gives the same
+ * result as ISHAReset/ISHAInput/ISHAResult on each message.
+ *
+ * Parameters:
+ *   msgs     Array of n message pointers (in)
+ *   lens     Array of n message lengths, in bytes (in)
+ *   n        Number of messages
+ *   md       n digests, lane-interleaved as described above (out)
+ */
+void isha_batch_hash(const uint8_t *const msgs[], const size_t lens[],
+		size_t n, uint32_t *md);
+
+/*
+ * Applies T = ISHA(T) count times to each of n digests. This is the
+ * multi-lane equivalent of ISHAIterateDigest.
+ *
+ * Parameters:
+ *   md     n digests, lane-interleaved as described above (in/out)
+ *   n      Number of digests
+ *   count  Number of times to apply the hash
+ */
+void isha_batch_iterate(uint32_t *md, size_t n, uint32_t count);
+
+/*
+ * Copies the digest of one lane out of a lane-interleaved array, as
+ * the big-endian bytes ISHAResult would produce
+ *
+ * Parameters:
+ *   md      n digests, lane-interleaved (in)
+ *   n       Number of digests in md
+ *   lane    The lane to extract
+ *   out     Output buffer (out)
+ *   outlen  Number of bytes to write, at most ISHA_DIGESTLEN
+ */
+void isha_batch_digest_bytes(const uint32_t *md, size_t n, size_t lane,
+		uint8_t *out, size_t outlen);
+
+#endif  // _ISHA_BATCH_H_
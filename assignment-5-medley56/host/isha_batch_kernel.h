@@ -0,0 +1,127 @@
+/*
+ * isha_batch_kernel.h
+ *
+ * Body of the multi-lane ISHA kernels. This file is included by
+ * isha_batch.c once per instruction set, with the following defined:
+ *
+ *   KVEC       Type holding KWIDTH 32-bit lanes (a GCC vector type, or
+ *              plain uint32_t for the scalar kernels)
+ *   KWIDTH     Number of lanes in a KVEC
+ *   KNAME(x)   Name of function x for this instruction set
+ *   KTARGET    Function attributes selecting the instruction set
+ *
+ * The round function is the same as ISHAProcessMessageBlock in isha.c,
+ * applied to every lane at once.
+ */
+
+#define KSPLAT(x)    ((KVEC){0} + (uint32_t)(x))
+#define KROTL(n, v)  (((v) << (n)) | ((v) >> (32 - (n))))
+
+#define KROUND(W) \
+	do { \
+		temp = KROTL(5, A) + ((B & C) | ((~B) & D)) + E + (W); \
+		E = KROTL(25, D); \
+		D = KROTL(15, C); \
+		C = KROTL(30, B); \
+		B = KROTL(10, A); \
+		A = KROTL(5, temp); \
+	} while (0)
+
+static inline KTARGET KVEC KNAME(load)(const uint32_t *p) {
+	KVEC v;
+	memcpy(&v, p, sizeof(v));
+	return v;
+}
+
+static inline KTARGET void KNAME(store)(uint32_t *p, KVEC v) {
+	memcpy(p, &v, sizeof(v));
+}
+
+/*
+ * Processes one 512-bit block for KWIDTH lanes
+ *
+ * Parameters:
+ *   h        Digest words; word i of the first lane is at h[i * stride] (in/out)
+ *   stride   Distance between consecutive digest words in h
+ *   w        Message words; word t of the first lane is at w[t * KWIDTH] (in)
+ */
+static KTARGET void KNAME(compress)(uint32_t *h, size_t stride,
+		const uint32_t *w) {
+	KVEC temp;
+	KVEC A = KNAME(load)(h + 0 * stride);
+	KVEC B = KNAME(load)(h + 1 * stride);
+	KVEC C = KNAME(load)(h + 2 * stride);
+	KVEC D = KNAME(load)(h + 3 * stride);
+	KVEC E = KNAME(load)(h + 4 * stride);
+
+	for (int t = 0; t < 16; t++) {
+		KROUND(KNAME(load)(w + t * KWIDTH));
+	}
+
+	KNAME(store)(h + 0 * stride, KNAME(load)(h + 0 * stride) + A);
+	KNAME(store)(h + 1 * stride, KNAME(load)(h + 1 * stride) + B);
+	KNAME(store)(h + 2 * stride, KNAME(load)(h + 2 * stride) + C);
+	KNAME(store)(h + 3 * stride, KNAME(load)(h + 3 * stride) + D);
+	KNAME(store)(h + 4 * stride, KNAME(load)(h + 4 * stride) + E);
+}
+
+/*
+ * Applies T = ISHA(T) count times to KWIDTH lanes. See
+ * ISHAIterateDigest for the single-lane version.
+ *
+ * Parameters:
+ *   md       Digest words; word i of the first lane is at md[i * stride] (in/out)
+ *   stride   Distance between consecutive digest words in md
+ *   count    Number of times to apply the hash
+ */
+static KTARGET void KNAME(iterate)(uint32_t *md, size_t stride,
+		uint32_t count) {
+	KVEC temp;
+	KVEC A, B, C, D, E;
+	KVEC T0 = KNAME(load)(md + 0 * stride);
+	KVEC T1 = KNAME(load)(md + 1 * stride);
+	KVEC T2 = KNAME(load)(md + 2 * stride);
+	KVEC T3 = KNAME(load)(md + 3 * stride);
+	KVEC T4 = KNAME(load)(md + 4 * stride);
+
+	while (count--) {
+		A = KSPLAT(0x67452301);
+		B = KSPLAT(0xEFCDAB89);
+		C = KSPLAT(0x98BADCFE);
+		D = KSPLAT(0x10325476);
+		E = KSPLAT(0xC3D2E1F0);
+
+		KROUND(T0);
+		KROUND(T1);
+		KROUND(T2);
+		KROUND(T3);
+		KROUND(T4);
+		KROUND(KSPLAT(0x80000000));
+		KROUND(KSPLAT(0));
+		KROUND(KSPLAT(0));
+		KROUND(KSPLAT(0));
+		KROUND(KSPLAT(0));
+		KROUND(KSPLAT(0));
+		KROUND(KSPLAT(0));
+		KROUND(KSPLAT(0));
+		KROUND(KSPLAT(0));
+		KROUND(KSPLAT(0));
+		KROUND(KSPLAT(ISHA_DIGESTLEN * 8));
+
+		T0 = A + 0x67452301;
+		T1 = B + 0xEFCDAB89;
+		T2 = C + 0x98BADCFE;
+		T3 = D + 0x10325476;
+		T4 = E + 0xC3D2E1F0;
+	}
+
+	KNAME(store)(md + 0 * stride, T0);
+	KNAME(store)(md + 1 * stride, T1);
+	KNAME(store)(md + 2 * stride, T2);
+	KNAME(store)(md + 3 * stride, T3);
+	KNAME(store)(md + 4 * stride, T4);
+}
+
+#undef KSPLAT
+#undef KROTL
+#undef KROUND
@@ -0,0 +1,479 @@
+/*
+ * isha_bench.c
+ *
+ * Repeatable host benchmark for isha.c and pbkdf1.c, for judging
+ * changes to them. Every optimized variant is first checked against the
+ * frozen reference in isha_ref.c; only then is anything timed.
+ *
+ * Each benchmark is warmed up, then timed over several samples. A
+ * sample is enough repetitions to take about SAMPLE_SECONDS, so clock
+ * resolution does not matter. The median and the median absolute
+ * deviation (MAD) of the per-operation times are reported, on stdout as
+ * a table and optionally as JSON for comparing runs.
+ *
+ * Usage: isha_bench [-s samples] [-w warmup] [-j results.json] [-q]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "isha.h"
+#include "isha_ref.h"
+#include "isha_batch.h"
+#include "pbkdf1.h"
+#include "pbkdf1_batch.h"
+#include "pbkdf1_cache.h"
+
+#define DEFAULT_SAMPLES  15
+#define DEFAULT_WARMUP   3
+#define SAMPLE_SECONDS   0.02   // target length of one sample
+#define MAX_SAMPLES      101
+#define MAX_RESULTS      32
+#define DIFF_CASES       500    // random cases per differential check
+
+typedef struct {
+	char name[32];
+	size_t param;          // input size in bytes, or iteration count
+	const char *param_name;
+	double bytes_per_op;   // for throughput; 0 if not meaningful
+	uint64_t reps;         // operations per sample
+	double median_ns;      // per operation
+	double mad_ns;
+	double min_ns;
+} result_t;
+
+static result_t results[MAX_RESULTS];
+static int num_results;
+
+static int num_samples = DEFAULT_SAMPLES;
+static int num_warmup = DEFAULT_WARMUP;
+
+// Benchmark inputs, and a sink that keeps results live
+static uint8_t input[4096];
+static volatile uint8_t sink;
+
+static double now(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+/*
+ * Returns a pseudo-random 32-bit value (xorshift), so that runs are
+ * repeatable
+ */
+static uint32_t rng(void) {
+	static uint32_t state = 2463534242u;
+	state ^= state << 13;
+	state ^= state >> 17;
+	state ^= state << 5;
+	return state;
+}
+
+static int cmp_double(const void *a, const void *b) {
+	double x = *(const double *) a, y = *(const double *) b;
+	return (x > y) - (x < y);
+}
+
+static double median(double *v, int n) {
+	qsort(v, n, sizeof(*v), cmp_double);
+	return (n % 2) ? v[n / 2] : (v[n / 2 - 1] + v[n / 2]) / 2;
+}
+
+/*
+ * Differential checks
+ */
+
+static int diff_cases, diff_failures;
+
+static void check(bool ok, const char *what, size_t param) {
+	diff_cases++;
+	if (!ok) {
+		if (diff_failures++ < 10) {
+			printf("MISMATCH: %s (%zu)\n", what, param);
+		}
+	}
+}
+
+/*
+ * ISHA on one message via the optimized code, delivered in chunks of
+ * the given size (0 for one call)
+ */
+static void isha_chunked(const uint8_t *msg, size_t len, size_t chunk,
+		uint8_t digest[ISHA_DIGESTLEN]) {
+	ISHAContext ctx;
+
+	ISHAReset(&ctx);
+	if (chunk == 0) {
+		ISHAInput(&ctx, msg, len);
+	} else {
+		for (size_t i = 0; i < len; i += chunk) {
+			ISHAInput(&ctx, msg + i, (len - i < chunk) ? len - i : chunk);
+		}
+	}
+	ISHAResult(&ctx, digest);
+}
+
+static void differential_isha(void) {
+	uint8_t exp[ISHA_DIGESTLEN], act[ISHA_DIGESTLEN];
+
+	for (int i = 0; i < DIFF_CASES; i++) {
+		size_t len = rng() % 300;
+		size_t chunk = (i % 3 == 0) ? 0 : (i % 3 == 1) ? ISHA_DIGESTLEN :
+				1 + rng() % 70;
+		for (size_t k = 0; k < len; k++) {
+			input[k] = rng();
+		}
+
+		isha_ref(input, len, exp);
+		isha_chunked(input, len, chunk, act);
+		check(memcmp(exp, act, sizeof(exp)) == 0, "ISHAInput/ISHAResult", len);
+	}
+}
+
+static void differential_iterate(void) {
+	uint8_t exp[ISHA_DIGESTLEN], act[ISHA_DIGESTLEN];
+	uint32_t md[ISHA_DIGESTWORDS];
+
+	for (int i = 0; i < DIFF_CASES / 10; i++) {
+		uint32_t count = rng() % 200;
+		for (int w = 0; w < ISHA_DIGESTWORDS; w++) {
+			md[w] = rng();
+		}
+		for (int k = 0; k < ISHA_DIGESTLEN; k++) {
+			exp[k] = (uint8_t) (md[k / 4] >> (24 - 8 * (k % 4)));
+		}
+
+		for (uint32_t j = 0; j < count; j++) {
+			isha_ref(exp, sizeof(exp), exp);
+		}
+		ISHAIterateDigest(md, count);
+		for (int k = 0; k < ISHA_DIGESTLEN; k++) {
+			act[k] = (uint8_t) (md[k / 4] >> (24 - 8 * (k % 4)));
+		}
+		check(memcmp(exp, act, sizeof(exp)) == 0, "ISHAIterateDigest", count);
+	}
+}
+
+static void differential_pbkdf1(void) {
+	static Pbkdf1Cache cache;
+	uint8_t exp[ISHA_DIGESTLEN], act[ISHA_DIGESTLEN];
+	uint8_t pass[40], salt[40];
+	Pbkdf1Context ctx;
+
+	pbkdf1CacheClear(&cache);
+	for (int i = 0; i < DIFF_CASES / 5; i++) {
+		size_t pLen = rng() % sizeof(pass), sLen = rng() % sizeof(salt);
+		// A few passwords, so the cache sees repeats
+		uint32_t seed = rng() % 4;
+		uint32_t c = 1 + rng() % 300;
+		size_t dkLen = rng() % (ISHA_DIGESTLEN + 1);
+		error_t err;
+
+		for (size_t k = 0; k < sizeof(pass); k++) {
+			pass[k] = (uint8_t) (seed * 31 + k);
+			salt[k] = (uint8_t) (seed * 17 + k * 3);
+		}
+		pLen = (seed == 0) ? pLen : 8;
+		sLen = (seed == 0) ? sLen : 6;
+
+		pbkdf1_ref(pass, pLen, salt, sLen, c, exp, dkLen);
+
+		err = pbkdf1(pass, pLen, salt, sLen, c, act, dkLen);
+		check(err == NO_ERROR && memcmp(exp, act, dkLen) == 0, "pbkdf1", c);
+
+		memset(act, 0, sizeof(act));
+		err = pbkdf1Start(&ctx, pass, pLen, salt, sLen, c, act, dkLen);
+		while (err == NO_ERROR || err == ERROR_IN_PROGRESS) {
+			err = pbkdf1Step(&ctx, 1 + rng() % 50);
+			if (err == NO_ERROR)
+				break;
+		}
+		check(err == NO_ERROR && memcmp(exp, act, dkLen) == 0, "pbkdf1Step",
+				c);
+
+		err = pbkdf1Cached(&cache, pass, pLen, salt, sLen, c, act, dkLen);
+		check(err == NO_ERROR && memcmp(exp, act, dkLen) == 0, "pbkdf1Cached",
+				c);
+	}
+	pbkdf1CacheClear(&cache);
+}
+
+static void differential_batch(void) {
+	enum { LANES = 19 };
+	static uint8_t msgs[LANES][200];
+	const uint8_t *msg_ptrs[LANES];
+	size_t lens[LANES];
+	uint32_t md[LANES * ISHA_DIGESTWORDS];
+	uint8_t exp[ISHA_DIGESTLEN], act[ISHA_DIGESTLEN];
+	uint8_t dk[LANES * ISHA_DIGESTLEN];
+	isha_batch_isa_t saved = isha_batch_get_isa();
+
+	for (int isa = ISHA_BATCH_SCALAR; isa <= saved; isa++) {
+		isha_batch_set_isa((isha_batch_isa_t) isa);
+
+		for (int round = 0; round < 10; round++) {
+			uint32_t c = 1 + rng() % 100;
+
+			for (int j = 0; j < LANES; j++) {
+				lens[j] = rng() % sizeof(msgs[j]);
+				for (size_t k = 0; k < lens[j]; k++) {
+					msgs[j][k] = rng();
+				}
+				msg_ptrs[j] = msgs[j];
+			}
+
+			isha_batch_hash(msg_ptrs, lens, LANES, md);
+			for (int j = 0; j < LANES; j++) {
+				isha_ref(msgs[j], lens[j], exp);
+				isha_batch_digest_bytes(md, LANES, j, act, sizeof(act));
+				check(memcmp(exp, act, sizeof(exp)) == 0,
+						isha_batch_isa_name(isa), lens[j]);
+			}
+
+			// Use the first half of each message as password, the rest
+			// as salt
+			size_t pLen[LANES], sLen[LANES];
+			const uint8_t *s[LANES];
+			for (int j = 0; j < LANES; j++) {
+				pLen[j] = lens[j] / 2;
+				sLen[j] = lens[j] - pLen[j];
+				s[j] = msgs[j] + pLen[j];
+			}
+			pbkdf1_batch(msg_ptrs, pLen, s, sLen, LANES, c, dk, ISHA_DIGESTLEN);
+			for (int j = 0; j < LANES; j++) {
+				pbkdf1_ref(msgs[j], pLen[j], s[j], sLen[j], c, exp,
+						ISHA_DIGESTLEN);
+				check(memcmp(exp, dk + j * ISHA_DIGESTLEN, ISHA_DIGESTLEN) == 0,
+						"pbkdf1_batch", c);
+			}
+		}
+	}
+
+	isha_batch_set_isa(saved);
+}
+
+/*
+ * Timing
+ */
+
+typedef void (*bench_fn)(size_t param, uint64_t reps);
+
+static void run_isha(size_t len, uint64_t reps) {
+	uint8_t digest[ISHA_DIGESTLEN] = { 0 };
+	ISHAContext ctx;
+
+	for (uint64_t r = 0; r < reps; r++) {
+		ISHAReset(&ctx);
+		ISHAInput(&ctx, input, len);
+		ISHAResult(&ctx, digest);
+		input[0] = digest[0];
+	}
+	sink = digest[0];
+}
+
+static void run_isha_ref(size_t len, uint64_t reps) {
+	uint8_t digest[ISHA_DIGESTLEN] = { 0 };
+
+	for (uint64_t r = 0; r < reps; r++) {
+		isha_ref(input, len, digest);
+		input[0] = digest[0];
+	}
+	sink = digest[0];
+}
+
+static void run_iterate(size_t count, uint64_t reps) {
+	uint32_t md[ISHA_DIGESTWORDS] = { 1, 2, 3, 4, 5 };
+
+	for (uint64_t r = 0; r < reps; r++) {
+		ISHAIterateDigest(md, count);
+	}
+	sink = md[0];
+}
+
+static void run_pbkdf1(size_t c, uint64_t reps) {
+	uint8_t dk[ISHA_DIGESTLEN] = { 0 };
+
+	for (uint64_t r = 0; r < reps; r++) {
+		pbkdf1((const uint8_t *) "Boulder", 7, (const uint8_t *) "Buffaloes", 9,
+				c, dk, sizeof(dk));
+	}
+	sink = dk[0];
+}
+
+static void run_pbkdf1_ref(size_t c, uint64_t reps) {
+	uint8_t dk[ISHA_DIGESTLEN] = { 0 };
+
+	for (uint64_t r = 0; r < reps; r++) {
+		pbkdf1_ref((const uint8_t *) "Boulder", 7,
+				(const uint8_t *) "Buffaloes", 9, c, dk, sizeof(dk));
+	}
+	sink = dk[0];
+}
+
+/*
+ * Warms up, picks a repetition count, takes the samples, and records
+ * the statistics
+ */
+static void measure(const char *name, bench_fn fn, size_t param,
+		const char *param_name, double bytes_per_op) {
+	double per_op[MAX_SAMPLES], dev[MAX_SAMPLES];
+	uint64_t reps = 1;
+	result_t *res;
+
+	// Double the repetitions until one sample is long enough; this also
+	// serves as warm-up
+	for (;;) {
+		double start = now();
+		fn(param, reps);
+		if (now() - start >= SAMPLE_SECONDS || reps >= (1ull << 40)) {
+			break;
+		}
+		reps *= 2;
+	}
+	for (int i = 0; i < num_warmup; i++) {
+		fn(param, reps);
+	}
+
+	for (int i = 0; i < num_samples; i++) {
+		double start = now();
+		fn(param, reps);
+		per_op[i] = (now() - start) * 1e9 / reps;
+	}
+
+	if (num_results == MAX_RESULTS) {
+		return;
+	}
+	res = &results[num_results++];
+	snprintf(res->name, sizeof(res->name), "%s", name);
+	res->param = param;
+	res->param_name = param_name;
+	res->bytes_per_op = bytes_per_op;
+	res->reps = reps;
+	res->median_ns = median(per_op, num_samples);
+	res->min_ns = per_op[0];  // sorted by median()
+	for (int i = 0; i < num_samples; i++) {
+		dev[i] = per_op[i] > res->median_ns ? per_op[i] - res->median_ns :
+				res->median_ns - per_op[i];
+	}
+	res->mad_ns = median(dev, num_samples);
+
+	printf("%-14s %-6s %6zu %14.1f %10.1f %6.2f%%", res->name, param_name,
+			param, res->median_ns, res->mad_ns,
+			100 * res->mad_ns / res->median_ns);
+	if (bytes_per_op > 0) {
+		printf(" %9.1f MB/s", bytes_per_op * 1e3 / res->median_ns);
+	}
+	printf("\n");
+}
+
+static void write_json(const char *path) {
+	FILE *f = fopen(path, "w");
+
+	if (f == NULL) {
+		perror(path);
+		return;
+	}
+
+	fprintf(f, "{\n");
+	fprintf(f, "  \"tool\": \"isha_bench\",\n");
+	fprintf(f, "  \"samples\": %d,\n", num_samples);
+	fprintf(f, "  \"warmup\": %d,\n", num_warmup);
+	fprintf(f, "  \"batch_isa\": \"%s\",\n",
+			isha_batch_isa_name(isha_batch_get_isa()));
+	fprintf(f, "  \"differential\": { \"cases\": %d, \"failures\": %d },\n",
+			diff_cases, diff_failures);
+	fprintf(f, "  \"results\": [\n");
+	for (int i = 0; i < num_results; i++) {
+		const result_t *r = &results[i];
+		fprintf(f, "    { \"name\": \"%s\", \"%s\": %zu, \"reps\": %llu, "
+				"\"median_ns\": %.2f, \"mad_ns\": %.2f, \"min_ns\": %.2f",
+				r->name, r->param_name, r->param, (unsigned long long) r->reps,
+				r->median_ns, r->mad_ns, r->min_ns);
+		if (r->bytes_per_op > 0) {
+			fprintf(f, ", \"mb_per_s\": %.2f",
+					r->bytes_per_op * 1e3 / r->median_ns);
+		}
+		fprintf(f, " }%s\n", (i + 1 < num_results) ? "," : "");
+	}
+	fprintf(f, "  ]\n}\n");
+	fclose(f);
+}
+
+int main(int argc, char **argv) {
+	static const size_t sizes[] = { 20, 64, 256, 1024, 4096 };
+	static const size_t counts[] = { 1, 16, 256, 4096 };
+	const char *json_path = NULL;
+	bool quick = false;
+	int opt;
+
+	while ((opt = getopt(argc, argv, "s:w:j:q")) != -1) {
+		switch (opt) {
+		case 's':
+			num_samples = atoi(optarg);
+			break;
+		case 'w':
+			num_warmup = atoi(optarg);
+			break;
+		case 'j':
+			json_path = optarg;
+			break;
+		case 'q':
+			quick = true;  // differential checks only
+			break;
+		default:
+			fprintf(stderr,
+					"usage: %s [-s samples] [-w warmup] [-j results.json] [-q]\n",
+					argv[0]);
+			return 2;
+		}
+	}
+	if (num_samples < 1 || num_samples > MAX_SAMPLES || num_warmup < 0) {
+		fprintf(stderr, "samples must be 1..%d, warmup >= 0\n", MAX_SAMPLES);
+		return 2;
+	}
+
+	differential_isha();
+	differential_iterate();
+	differential_pbkdf1();
+	differential_batch();
+	printf("differential: %d cases against isha_ref, %d failures\n",
+			diff_cases, diff_failures);
+	if (diff_failures) {
+		return 1;
+	}
+	if (quick) {
+		return 0;
+	}
+
+	for (size_t i = 0; i < sizeof(input); i++) {
+		input[i] = (uint8_t) rng();
+	}
+
+	printf("%-14s %-6s %6s %14s %10s %7s\n", "benchmark", "param", "", "median ns/op",
+			"MAD ns", "MAD%");
+	for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+		measure("isha", run_isha, sizes[i], "bytes", sizes[i]);
+	}
+	for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+		measure("isha_ref", run_isha_ref, sizes[i], "bytes", sizes[i]);
+	}
+	measure("isha_iterate", run_iterate, 1024, "count", 0);
+	for (size_t i = 0; i < sizeof(counts) / sizeof(counts[0]); i++) {
+		measure("pbkdf1", run_pbkdf1, counts[i], "count", 0);
+	}
+	for (size_t i = 0; i < sizeof(counts) / sizeof(counts[0]); i++) {
+		measure("pbkdf1_ref", run_pbkdf1_ref, counts[i], "count", 0);
+	}
+
+	if (json_path != NULL) {
+		write_json(json_path);
+	}
+
+	return 0;
+}
@@ -0,0 +1,16 @@
+/*
+ * isha_host.h
+ *
+ * Forced into the host build of ../source/isha.c (see the Makefile),
+ * whose marked lines must stay as the assignment gave them. They read
+ * the PC with ARM assembly, which means nothing on the host: there it
+ * is dropped, and the end addresses stay 0, as no PC ranges are
+ * recorded off-target.
+ */
+
+#ifndef _ISHA_HOST_H_
+#define _ISHA_HOST_H_
+
+#define asm(...)  ((void) 0)
+
+#endif  // _ISHA_HOST_H_
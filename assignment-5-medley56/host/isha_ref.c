@@ -0,0 +1,119 @@
+/*
+ * isha_ref.c
+ *
+ * Frozen reference implementation of ISHA and PBKDF1. See isha_ref.h.
+ */
+
+#include <string.h>
+
+#include "isha_ref.h"
+
+#define ISHARefCircularShift(bits,word) \
+  ((((word) << (bits)) & 0xFFFFFFFF) | ((word) >> (32-(bits))))
+
+static void isha_ref_process_block(ISHARefContext *ctx) {
+	uint32_t temp;
+	uint32_t W[16];
+	uint32_t A, B, C, D, E;
+
+	for (int t = 0; t < 16; t++) {
+		W[t] = ((uint32_t) ctx->MBlock[t * 4]) << 24;
+		W[t] |= ((uint32_t) ctx->MBlock[t * 4 + 1]) << 16;
+		W[t] |= ((uint32_t) ctx->MBlock[t * 4 + 2]) << 8;
+		W[t] |= ((uint32_t) ctx->MBlock[t * 4 + 3]);
+	}
+
+	A = ctx->MD[0];
+	B = ctx->MD[1];
+	C = ctx->MD[2];
+	D = ctx->MD[3];
+	E = ctx->MD[4];
+
+	for (int t = 0; t < 16; t++) {
+		temp = ISHARefCircularShift(5,A) + ((B & C) | ((~B) & D)) + E + W[t];
+		temp &= 0xFFFFFFFF;
+		E = ISHARefCircularShift(25,D);
+		D = ISHARefCircularShift(15,C);
+		C = ISHARefCircularShift(30,B);
+		B = ISHARefCircularShift(10,A);
+		A = ISHARefCircularShift(5,temp);
+	}
+
+	ctx->MD[0] = (ctx->MD[0] + A) & 0xFFFFFFFF;
+	ctx->MD[1] = (ctx->MD[1] + B) & 0xFFFFFFFF;
+	ctx->MD[2] = (ctx->MD[2] + C) & 0xFFFFFFFF;
+	ctx->MD[3] = (ctx->MD[3] + D) & 0xFFFFFFFF;
+	ctx->MD[4] = (ctx->MD[4] + E) & 0xFFFFFFFF;
+
+	ctx->MB_Idx = 0;
+}
+
+void isha_ref_reset(ISHARefContext *ctx) {
+	ctx->Length = 0;
+	ctx->MB_Idx = 0;
+
+	ctx->MD[0] = 0x67452301;
+	ctx->MD[1] = 0xEFCDAB89;
+	ctx->MD[2] = 0x98BADCFE;
+	ctx->MD[3] = 0x10325476;
+	ctx->MD[4] = 0xC3D2E1F0;
+}
+
+void isha_ref_input(ISHARefContext *ctx, const uint8_t *bytes, size_t nbytes) {
+	while (nbytes--) {
+		ctx->MBlock[ctx->MB_Idx++] = *bytes++;
+		ctx->Length += 8;
+		if (ctx->MB_Idx == 64) {
+			isha_ref_process_block(ctx);
+		}
+	}
+}
+
+void isha_ref_result(ISHARefContext *ctx, uint8_t digest_out[20]) {
+	uint64_t length = ctx->Length;
+
+	// A one bit, zeros up to 56 bytes into a block, then the bit length
+	ctx->MBlock[ctx->MB_Idx++] = 0x80;
+	if (ctx->MB_Idx > 56) {
+		while (ctx->MB_Idx < 64) {
+			ctx->MBlock[ctx->MB_Idx++] = 0;
+		}
+		isha_ref_process_block(ctx);
+	}
+	while (ctx->MB_Idx < 56) {
+		ctx->MBlock[ctx->MB_Idx++] = 0;
+	}
+	for (int i = 0; i < 8; i++) {
+		ctx->MBlock[56 + i] = (uint8_t) (length >> (56 - 8 * i));
+	}
+	isha_ref_process_block(ctx);
+
+	for (int i = 0; i < 20; i++) {
+		digest_out[i] = (uint8_t) (ctx->MD[i / 4] >> (24 - 8 * (i % 4)));
+	}
+}
+
+void isha_ref(const uint8_t *msg, size_t len, uint8_t digest_out[20]) {
+	ISHARefContext ctx;
+
+	isha_ref_reset(&ctx);
+	isha_ref_input(&ctx, msg, len);
+	isha_ref_result(&ctx, digest_out);
+}
+
+void pbkdf1_ref(const uint8_t *p, size_t pLen, const uint8_t *s, size_t sLen,
+		uint32_t c, uint8_t *dk, size_t dkLen) {
+	ISHARefContext ctx;
+	uint8_t t[20];
+
+	isha_ref_reset(&ctx);
+	isha_ref_input(&ctx, p, pLen);
+	isha_ref_input(&ctx, s, sLen);
+	isha_ref_result(&ctx, t);
+
+	for (uint32_t i = 1; i < c; i++) {
+		isha_ref(t, sizeof(t), t);
+	}
+
+	memcpy(dk, t, dkLen);
+}
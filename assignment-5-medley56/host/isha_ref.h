@@ -0,0 +1,39 @@
+/*
+ * isha_ref.h
+ *
+ * Frozen reference implementation of ISHA and PBKDF1, used by the host
+ * tools to check the optimized versions in ../source. This follows the
+ * original byte-at-a-time sha1 code from Paul E. Jones that isha.c is
+ * based on. Do not optimize it: its only job is to be obviously right.
+ */
+
+#ifndef _ISHA_REF_H_
+#define _ISHA_REF_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+typedef struct {
+	uint32_t MD[5];
+	uint64_t Length;      // message length in bits
+	uint8_t MBlock[64];
+	int MB_Idx;
+} ISHARefContext;
+
+void isha_ref_reset(ISHARefContext *ctx);
+void isha_ref_input(ISHARefContext *ctx, const uint8_t *bytes, size_t nbytes);
+void isha_ref_result(ISHARefContext *ctx, uint8_t digest_out[20]);
+
+/*
+ * Computes the ISHA digest of a whole message
+ */
+void isha_ref(const uint8_t *msg, size_t len, uint8_t digest_out[20]);
+
+/*
+ * PBKDF1 with ISHA: T1 = ISHA(P || S), Ti = ISHA(Ti-1), DK = Tc[0..dkLen).
+ * Parameters must be valid (c >= 1, dkLen <= 20).
+ */
+void pbkdf1_ref(const uint8_t *p, size_t pLen, const uint8_t *s, size_t sLen,
+		uint32_t c, uint8_t *dk, size_t dkLen);
+
+#endif  // _ISHA_REF_H_
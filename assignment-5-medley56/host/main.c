@@ -0,0 +1,38 @@
+/*
+ * main.c
+ *
+ * Runs the ISHA and PBKDF1 tests on the host
+ */
+
+#include <stdbool.h>
+
+#include "fsl_debug_console.h"
+#include "pbkdf1_test.h"
+#include "test_isha_batch.h"
+#include "test_pbkdf1_many.h"
+#include "test_pc_profiler.h"
+#include "test_static_profiler.h"
+#include "test_callgraph.h"
+#include "test_monotonic.h"
+#include "test_mtb.h"
+
+int main(void) {
+	bool success = true;
+
+	success &= test_isha();
+	success &= test_pbkdf1();
+	success &= test_pbkdf1_sliced();
+	success &= test_pbkdf1_cache();
+	success &= test_hmac();
+	success &= test_pbkdf2();
+	success &= test_isha_batch();
+	success &= test_pbkdf1_many();
+	success &= test_pc_profiler();
+	success &= test_static_profiler();
+	success &= test_callgraph();
+	success &= test_monotonic();
+	success &= test_mtb();
+
+	PRINTF("%s\r\n", success ? "All tests passed" : "Some tests FAILED");
+	return success ? 0 : 1;
+}
@@ -0,0 +1,324 @@
+/*
+ * mtb_decode.c
+ *
+ * Decodes the MTB dumps printed by mtb_dump() on the board. Branch
+ * sources and destinations are resolved to functions with the nm output
+ * of the same build, as for pc_replay.
+ *
+ * Between two packets the core ran straight from the destination of the
+ * first to the source of the second, so each pair of packets gives an
+ * executed run. The summary counts the halfwords of code in those runs
+ * per function, the hottest runs, and the branches between functions.
+ * Any number of dump files, each holding any number of dumps, are
+ * merged into one summary; with -s only the summary is printed.
+ *
+ * Usage: mtb_decode [-s] [-n hot-runs] nm-output dump-file...
+ */
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "nm_symtab.h"
+#include "mtb_trace.h"
+
+// A pair of addresses counted across all dumps: a run (first, last) or
+// a branch between functions (from, to)
+typedef struct {
+	uint32_t a;
+	uint32_t b;
+	uint32_t count;
+} pair_t;
+
+typedef struct {
+	pair_t *items;
+	size_t num;
+	size_t cap;
+} pairs_t;
+
+static pc_symbol_t *table;
+static size_t len;
+static uint64_t *halfwords;  // per function; index len is unknown code
+static uint32_t *runs;
+
+static size_t function_index(uint32_t addr) {
+	int i = pc_symtab_lookup(table, len, addr);
+
+	return (i < 0) ? len : (size_t) i;
+}
+
+static const char *function_name(size_t i) {
+	return (i < len) ? table[i].name : "(unknown)";
+}
+
+// Formats addr as function+offset into buf
+static const char *symbolize(char *buf, size_t n, uint32_t addr) {
+	size_t f = function_index(addr);
+
+	if (f == len) {
+		snprintf(buf, n, "0x%08x", (unsigned) addr);
+	} else {
+		snprintf(buf, n, "%s+0x%x", table[f].name,
+				(unsigned) (addr - table[f].start));
+	}
+	return buf;
+}
+
+static int add_pair(pairs_t *p, uint32_t a, uint32_t b) {
+	if (p->num == p->cap) {
+		p->cap = p->cap ? 2 * p->cap : 1024;
+		p->items = realloc(p->items, p->cap * sizeof(*p->items));
+		if (p->items == NULL) {
+			return -1;
+		}
+	}
+	p->items[p->num++] = (pair_t) { a, b, 1 };
+	return 0;
+}
+
+static int compare_pair(const void *x, const void *y) {
+	const pair_t *p = x;
+	const pair_t *q = y;
+
+	if (p->a != q->a) {
+		return (p->a < q->a) ? -1 : 1;
+	}
+	return (p->b < q->b) ? -1 : (p->b > q->b);
+}
+
+static int compare_weight(const void *x, const void *y) {
+	const pair_t *p = x;
+	const pair_t *q = y;
+	uint64_t wp = (uint64_t) p->count * ((p->b - p->a) / 2 + 1);
+	uint64_t wq = (uint64_t) q->count * ((q->b - q->a) / 2 + 1);
+
+	if (wp != wq) {
+		return (wp > wq) ? -1 : 1;
+	}
+	return compare_pair(x, y);
+}
+
+static int compare_count(const void *x, const void *y) {
+	const pair_t *p = x;
+	const pair_t *q = y;
+
+	if (p->count != q->count) {
+		return (p->count > q->count) ? -1 : 1;
+	}
+	return compare_pair(x, y);
+}
+
+// Sorts p and merges equal pairs, adding up their counts
+static void merge_pairs(pairs_t *p) {
+	size_t n = 0;
+
+	if (p->num == 0) {
+		return;
+	}
+	qsort(p->items, p->num, sizeof(*p->items), compare_pair);
+	for (size_t i = 1; i < p->num; i++) {
+		if (compare_pair(&p->items[i], &p->items[n]) == 0) {
+			p->items[n].count += p->items[i].count;
+		} else {
+			p->items[++n] = p->items[i];
+		}
+	}
+	p->num = n + 1;
+}
+
+static void print_packet(size_t i, const mtb_packet_t *p) {
+	char from[64], to[64];
+
+	printf("%5zu  %-32s -> %s%s%s\n", i,
+			symbolize(from, sizeof(from), p->source),
+			symbolize(to, sizeof(to), p->destination),
+			p->exception ? " exception" : "", p->start ? " start" : "");
+}
+
+static const uint64_t *sort_key;
+
+// Largest first, then by address
+static int compare_index(const void *a, const void *b) {
+	size_t x = *(const size_t *) a;
+	size_t y = *(const size_t *) b;
+
+	if (sort_key[x] != sort_key[y]) {
+		return (sort_key[x] > sort_key[y]) ? -1 : 1;
+	}
+	return (x < y) ? -1 : (x > y);
+}
+
+static void print_summary(pairs_t *hot, pairs_t *branches, size_t top,
+		uint64_t total) {
+	size_t *order = calloc(len + 1, sizeof(*order));
+	char first[64], last[64];
+
+	printf("  share   halfwords      runs  function\n");
+	for (size_t i = 0; i <= len; i++) {
+		order[i] = i;
+	}
+	sort_key = halfwords;
+	qsort(order, len + 1, sizeof(*order), compare_index);
+	for (size_t k = 0; k <= len && halfwords[order[k]] != 0; k++) {
+		size_t f = order[k];
+
+		printf("%6.1f%%  %10llu  %8u  %s\n", 100.0 * halfwords[f] / total,
+				(unsigned long long) halfwords[f], (unsigned) runs[f],
+				function_name(f));
+	}
+	free(order);
+
+	printf("\nhot runs:\n  share   halfwords      runs  run\n");
+	qsort(hot->items, hot->num, sizeof(*hot->items), compare_weight);
+	for (size_t i = 0; i < hot->num && i < top; i++) {
+		const pair_t *r = &hot->items[i];
+		uint64_t h = (uint64_t) r->count * ((r->b - r->a) / 2 + 1);
+
+		printf("%6.1f%%  %10llu  %8u  %s .. %s\n", 100.0 * h / total,
+				(unsigned long long) h, (unsigned) r->count,
+				symbolize(first, sizeof(first), r->a),
+				symbolize(last, sizeof(last), r->b));
+	}
+
+	printf("\nbranches between functions:\n     count  from -> to\n");
+	qsort(branches->items, branches->num, sizeof(*branches->items),
+			compare_count);
+	for (size_t i = 0; i < branches->num && i < top; i++) {
+		const pair_t *b = &branches->items[i];
+
+		printf("%10u  %s -> %s\n", (unsigned) b->count, function_name(b->a),
+				function_name(b->b));
+	}
+}
+
+static void usage(const char *prog) {
+	fprintf(stderr, "usage: %s [-s] [-n hot-runs] nm-output dump-file...\n",
+			prog);
+}
+
+int main(int argc, char *argv[]) {
+	FILE *nm;
+	bool summary_only = false;
+	size_t top = 10;
+	pairs_t hot = { 0 }, branches = { 0 };
+	size_t dumps = 0, packets = 0, gaps = 0, num_runs = 0;
+	uint64_t total = 0;
+	int opt;
+
+	while ((opt = getopt(argc, argv, "sn:")) != -1) {
+		switch (opt) {
+		case 's':
+			summary_only = true;
+			break;
+		case 'n':
+			top = strtoul(optarg, NULL, 0);
+			break;
+		default:
+			usage(argv[0]);
+			return 2;
+		}
+	}
+	if (argc - optind < 2) {
+		usage(argv[0]);
+		return 2;
+	}
+	nm = fopen(argv[optind], "r");
+	if (nm == NULL) {
+		perror(argv[optind]);
+		return 1;
+	}
+	if (nm_symtab_read(nm, &table, &len) != 0) {
+		fprintf(stderr, "%s: out of memory\n", argv[0]);
+		return 1;
+	}
+	fclose(nm);
+	halfwords = calloc(len + 1, sizeof(*halfwords));
+	runs = calloc(len + 1, sizeof(*runs));
+	if (halfwords == NULL || runs == NULL) {
+		fprintf(stderr, "%s: out of memory\n", argv[0]);
+		return 1;
+	}
+
+	for (int arg = optind + 1; arg < argc; arg++) {
+		FILE *f = fopen(argv[arg], "r");
+		mtb_dump_t dump;
+		int status;
+
+		if (f == NULL) {
+			perror(argv[arg]);
+			return 1;
+		}
+		while ((status = mtb_dump_read(f, &dump)) == 1) {
+			mtb_packet_t *p = calloc(dump.size / 8, sizeof(*p));
+			size_t n;
+
+			if (p == NULL) {
+				fprintf(stderr, "%s: out of memory\n", argv[0]);
+				return 1;
+			}
+			n = mtb_packets(&dump, p);
+			dumps++;
+			packets += n;
+			if (!summary_only) {
+				printf("%sdump %zu (%s): %zu packets%s\n", dumps > 1 ? "\n" : "",
+						dumps, argv[arg], n,
+						(dump.position & 0x4) ? ", wrapped" : "");
+			}
+
+			for (size_t i = 0; i < n; i++) {
+				size_t from = function_index(p[i].source);
+				size_t to = function_index(p[i].destination);
+				uint32_t first, last;
+
+				if (!summary_only) {
+					print_packet(i, &p[i]);
+				}
+				if (from != to && add_pair(&branches, from, to) != 0) {
+					fprintf(stderr, "%s: out of memory\n", argv[0]);
+					return 1;
+				}
+				if (i + 1 == n) {
+					break;
+				}
+				if (!mtb_run(&p[i], &p[i + 1], &first, &last)) {
+					gaps++;
+					continue;
+				}
+				if (add_pair(&hot, first, last) != 0) {
+					fprintf(stderr, "%s: out of memory\n", argv[0]);
+					return 1;
+				}
+				num_runs++;
+				runs[function_index(first)]++;
+				halfwords[function_index(first)] += (last - first) / 2 + 1;
+				total += (last - first) / 2 + 1;
+			}
+			free(p);
+			mtb_dump_free(&dump);
+		}
+		fclose(f);
+		if (status < 0) {
+			fprintf(stderr, "%s: %s: malformed or truncated dump\n", argv[0],
+					argv[arg]);
+			return 1;
+		}
+	}
+
+	if (total == 0) {
+		fprintf(stderr, "%s: no executed runs in the dumps\n", argv[0]);
+		return 1;
+	}
+	merge_pairs(&hot);
+	merge_pairs(&branches);
+	printf("%s%zu dumps, %zu packets, %zu runs, %zu gaps\n",
+			summary_only ? "" : "\n", dumps, packets, num_runs, gaps);
+	print_summary(&hot, &branches, top, total);
+
+	free(hot.items);
+	free(branches.items);
+	free(runs);
+	free(halfwords);
+	nm_symtab_free(table, len);
+	return 0;
+}
@@ -0,0 +1,99 @@
+/*
+ * mtb_trace.c
+ *
+ * Parses the MTB dumps printed by mtb_dump() and turns their packets
+ * into an execution trace
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "mtb_trace.h"
+
+#define MTB_POSITION_WRAP     0x4u
+#define MTB_POSITION_POINTER  0xFFFFFFF8u
+
+int mtb_dump_read(FILE *f, mtb_dump_t *dump) {
+	char line[256];
+	unsigned base, size, position;
+	uint32_t n = 0;
+
+	dump->words = NULL;
+	for (;;) {
+		if (fgets(line, sizeof(line), f) == NULL) {
+			return 0;
+		}
+		if (sscanf(line, "mtb: base %x size %u position %x", &base, &size,
+				&position) == 3) {
+			break;
+		}
+	}
+	// A power of 2, at least one packet
+	if (size < 16 || (size & (size - 1)) != 0) {
+		return -1;
+	}
+	dump->base = base;
+	dump->size = size;
+	dump->position = position;
+	dump->words = calloc(size / 4, sizeof(*dump->words));
+	if (dump->words == NULL) {
+		return -1;
+	}
+
+	while (fgets(line, sizeof(line), f) != NULL) {
+		unsigned source, destination;
+
+		if (sscanf(line, "0x%x 0x%x", &source, &destination) == 2) {
+			if (n == size / 4) {
+				break;
+			}
+			dump->words[n++] = source;
+			dump->words[n++] = destination;
+		} else if (strncmp(line, "end mtb", 7) == 0 && n == size / 4) {
+			return 1;
+		} else {
+			break;
+		}
+	}
+	mtb_dump_free(dump);
+	return -1;
+}
+
+void mtb_dump_free(mtb_dump_t *dump) {
+	free(dump->words);
+	dump->words = NULL;
+}
+
+size_t mtb_packets(const mtb_dump_t *dump, mtb_packet_t *packets) {
+	uint32_t slots = dump->size / 8;
+	uint32_t pointer = (dump->position & MTB_POSITION_POINTER & (dump->size - 1)) / 8;
+	uint32_t oldest, n;
+
+	if (dump->position & MTB_POSITION_WRAP) {
+		oldest = pointer;
+		n = slots;
+	} else {
+		oldest = 0;
+		n = pointer;
+	}
+	for (uint32_t i = 0; i < n; i++) {
+		const uint32_t *w = &dump->words[2 * ((oldest + i) % slots)];
+
+		packets[i].source = w[0] & ~1u;
+		packets[i].exception = w[0] & 1;
+		packets[i].destination = w[1] & ~1u;
+		packets[i].start = w[1] & 1;
+	}
+	return n;
+}
+
+bool mtb_run(const mtb_packet_t *prev, const mtb_packet_t *next,
+		uint32_t *first, uint32_t *last) {
+	if (next->start || next->source < prev->destination
+			|| next->source - prev->destination >= MTB_MAX_RUN_BYTES) {
+		return false;
+	}
+	*first = prev->destination;
+	*last = next->source;
+	return true;
+}
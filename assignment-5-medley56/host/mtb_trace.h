@@ -0,0 +1,78 @@
+/*
+ * mtb_trace.h
+ *
+ * Parses the MTB dumps printed by mtb_dump() and turns their packets
+ * into an execution trace
+ */
+
+#ifndef _MTB_TRACE_H_
+#define _MTB_TRACE_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+// Longest straight-line run believed; longer ones are trace gaps
+#define MTB_MAX_RUN_BYTES 4096
+
+/* One dump as printed: the buffer in buffer order, not yet decoded */
+typedef struct {
+	uint32_t base;
+	uint32_t size;       ///<Buffer bytes
+	uint32_t position;   ///<MTB_POSITION when tracing stopped
+	uint32_t *words;     ///<size / 4 words
+} mtb_dump_t;
+
+/* One branch: the PC left source and continued at destination */
+typedef struct {
+	uint32_t source;
+	uint32_t destination;
+	bool exception;  ///<A-bit: exception entry or return
+	bool start;      ///<S-bit: first packet after tracing started
+} mtb_packet_t;
+
+/*
+ * Reads the next dump from f, skipping any other output before it
+ *
+ * Parameters:
+ *   f      Console output (in)
+ *   dump   The dump; free its words with mtb_dump_free (out)
+ *
+ * Returns:
+ *   1 if a dump was read, 0 at end of file, -1 if a dump was malformed
+ *   or truncated, or memory ran out
+ */
+int mtb_dump_read(FILE *f, mtb_dump_t *dump);
+
+void mtb_dump_free(mtb_dump_t *dump);
+
+/*
+ * Decodes the packets of a dump, oldest first. If the pointer has
+ * wrapped, the buffer is full and the oldest packet is at the pointer;
+ * otherwise the packets run from the start of the buffer to the
+ * pointer.
+ *
+ * Parameters:
+ *   dump      The dump (in)
+ *   packets   size / 8 entries (out)
+ *
+ * Returns:
+ *   Number of packets written
+ */
+size_t mtb_packets(const mtb_dump_t *dump, mtb_packet_t *packets);
+
+/*
+ * Returns the straight-line run executed between two consecutive
+ * packets: from the destination of prev to the source of next,
+ * inclusive. Returns false if there is no such run: tracing restarted
+ * in between, or the addresses do not make a plausible run.
+ *
+ * Parameters:
+ *   prev, next   Consecutive packets (in)
+ *   first        Address of the first instruction of the run (out)
+ *   last         Address of the branch that ended it (out)
+ */
+bool mtb_run(const mtb_packet_t *prev, const mtb_packet_t *next,
+		uint32_t *first, uint32_t *last);
+
+#endif  // _MTB_TRACE_H_
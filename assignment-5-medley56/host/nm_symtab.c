@@ -0,0 +1,133 @@
+/*
+ * nm_symtab.c
+ *
+ * Builds a PC profiler symbol table from nm output
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "nm_symtab.h"
+
+// A function symbol as read, before sorting and merging
+typedef struct {
+	uint32_t start;
+	uint32_t end;
+	int rank;       // lower is preferred when several names share a start
+	size_t order;   // position in the input, to keep the sort stable
+	char *name;
+} raw_symbol_t;
+
+/*
+ * Returns the preference of an nm symbol type, or -1 if it is not code
+ */
+static int type_rank(char type) {
+	switch (type) {
+	case 'T':
+		return 0;
+	case 't':
+		return 1;
+	case 'W':
+		return 2;
+	case 'w':
+		return 3;
+	}
+	return -1;
+}
+
+static int compare_raw(const void *a, const void *b) {
+	const raw_symbol_t *x = a;
+	const raw_symbol_t *y = b;
+
+	if (x->start != y->start) {
+		return (x->start < y->start) ? -1 : 1;
+	}
+	if (x->rank != y->rank) {
+		return x->rank - y->rank;
+	}
+	return (x->order < y->order) ? -1 : (x->order > y->order);
+}
+
+int nm_symtab_read(FILE *f, pc_symbol_t **table, size_t *len) {
+	raw_symbol_t *raw = NULL;
+	size_t nraw = 0;
+	size_t cap = 0;
+	pc_symbol_t *out;
+	size_t n = 0;
+	char line[512];
+
+	while (fgets(line, sizeof(line), f) != NULL) {
+		unsigned long addr, size;
+		char type;
+		char name[256];
+		int rank;
+
+		// Symbols without a size have only three fields; they are skipped
+		if (sscanf(line, "%lx %lx %c %255s", &addr, &size, &type, name) != 4) {
+			continue;
+		}
+		rank = type_rank(type);
+		if (rank < 0 || size == 0) {
+			continue;
+		}
+
+		if (nraw == cap) {
+			raw_symbol_t *grown;
+			cap = cap ? cap * 2 : 256;
+			grown = realloc(raw, cap * sizeof(*raw));
+			if (grown == NULL) {
+				goto fail;
+			}
+			raw = grown;
+		}
+		raw[nraw].start = (uint32_t) addr & ~1u;  // Thumb bit
+		raw[nraw].end = raw[nraw].start + (uint32_t) size;
+		raw[nraw].rank = rank;
+		raw[nraw].order = nraw;
+		raw[nraw].name = strdup(name);
+		if (raw[nraw].name == NULL) {
+			goto fail;
+		}
+		nraw++;
+	}
+
+	qsort(raw, nraw, sizeof(*raw), compare_raw);
+
+	out = calloc(nraw ? nraw : 1, sizeof(*out));
+	if (out == NULL) {
+		goto fail;
+	}
+	for (size_t i = 0; i < nraw; i++) {
+		if (n > 0 && out[n - 1].start == raw[i].start) {
+			free(raw[i].name);  // alias of the preferred name before it
+			continue;
+		}
+		if (n > 0 && out[n - 1].end > raw[i].start) {
+			out[n - 1].end = raw[i].start;
+		}
+		out[n].start = raw[i].start;
+		out[n].end = raw[i].end;
+		out[n].name = raw[i].name;
+		n++;
+	}
+	free(raw);
+
+	*table = out;
+	*len = n;
+	return 0;
+
+fail:
+	for (size_t i = 0; i < nraw; i++) {
+		free(raw[i].name);
+	}
+	free(raw);
+	return -1;
+}
+
+void nm_symtab_free(pc_symbol_t *table, size_t len) {
+	for (size_t i = 0; i < len; i++) {
+		free((char *) table[i].name);
+	}
+	free(table);
+}
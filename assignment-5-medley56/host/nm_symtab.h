@@ -0,0 +1,36 @@
+/*
+ * nm_symtab.h
+ *
+ * Builds a PC profiler symbol table from nm output
+ */
+
+#ifndef _NM_SYMTAB_H_
+#define _NM_SYMTAB_H_
+
+#include <stdio.h>
+
+#include "pc_profiler.h"
+
+/*
+ * Reads the output of `arm-none-eabi-nm -S -n --defined-only` and
+ * returns the functions in it as a table for pc_profile_init: sorted by
+ * start, Thumb bit cleared, aliases at the same address merged (strong
+ * names preferred over weak ones), symbols without a size skipped, and
+ * each end clipped to the next start.
+ *
+ * Parameters:
+ *   f       nm output (in)
+ *   table   The table; free with nm_symtab_free (out)
+ *   len     Number of entries in the table (out)
+ *
+ * Returns:
+ *   0 on success, -1 if memory ran out
+ */
+int nm_symtab_read(FILE *f, pc_symbol_t **table, size_t *len);
+
+/*
+ * Frees a table returned by nm_symtab_read
+ */
+void nm_symtab_free(pc_symbol_t *table, size_t len);
+
+#endif  // _NM_SYMTAB_H_
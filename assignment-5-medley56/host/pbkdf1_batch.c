@@ -0,0 +1,72 @@
+/*
+ * pbkdf1_batch.c
+ *
+ * PBKDF1 over many (password, salt) pairs at once
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "pbkdf1_batch.h"
+#include "isha_batch.h"
+
+error_t pbkdf1_batch(const uint8_t *const p[], const size_t pLen[],
+		const uint8_t *const s[], const size_t sLen[], size_t n, uint32_t c,
+		uint8_t *dk, size_t dkLen) {
+	const uint8_t **msgs;
+	size_t *lens;
+	uint8_t *concat;
+	uint32_t *md;
+	size_t total = 0;
+
+	// Same checks as pbkdf1, for every lane
+	if (p == NULL || pLen == NULL || s == NULL || sLen == NULL || dk == NULL)
+		return ERROR_INVALID_PARAMETER;
+	if (c < 1)
+		return ERROR_INVALID_PARAMETER;
+	if (dkLen > ISHA_DIGESTLEN)
+		return ERROR_INVALID_LENGTH;
+	for (size_t j = 0; j < n; j++) {
+		if (p[j] == NULL || s[j] == NULL)
+			return ERROR_INVALID_PARAMETER;
+		total += pLen[j] + sLen[j];
+	}
+	if (n == 0)
+		return NO_ERROR;
+
+	msgs = malloc(n * sizeof(*msgs));
+	lens = malloc(n * sizeof(*lens));
+	concat = malloc(total ? total : 1);
+	md = malloc(n * ISHA_DIGESTWORDS * sizeof(*md));
+	if (msgs == NULL || lens == NULL || concat == NULL || md == NULL) {
+		free(msgs);
+		free(lens);
+		free(concat);
+		free(md);
+		return ERROR_OUT_OF_MEMORY;
+	}
+
+	// T1 = Hash(P || S) for every lane
+	total = 0;
+	for (size_t j = 0; j < n; j++) {
+		memcpy(concat + total, p[j], pLen[j]);
+		memcpy(concat + total + pLen[j], s[j], sLen[j]);
+		msgs[j] = concat + total;
+		lens[j] = pLen[j] + sLen[j];
+		total += lens[j];
+	}
+	isha_batch_hash(msgs, lens, n, md);
+
+	// T2 .. Tc
+	isha_batch_iterate(md, n, c - 1);
+
+	for (size_t j = 0; j < n; j++) {
+		isha_batch_digest_bytes(md, n, j, dk + j * dkLen, dkLen);
+	}
+
+	free(msgs);
+	free(lens);
+	free(concat);
+	free(md);
+	return NO_ERROR;
+}
@@ -0,0 +1,39 @@
+/*
+ * pbkdf1_batch.h
+ *
+ * PBKDF1 over many (password, salt) pairs at once, using the multi-lane
+ * ISHA kernels in isha_batch.h.
+ */
+
+#ifndef _PBKDF1_BATCH_H_
+#define _PBKDF1_BATCH_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "error.h"
+
+/*
+ * Derives n keys with PBKDF1. Key j is the same as
+ * pbkdf1(p[j], pLen[j], s[j], sLen[j], c, dk + j * dkLen, dkLen); all
+ * lanes run through their c iterations in lockstep.
+ *
+ * Parameters:
+ *   p       Array of n passwords (in)
+ *   pLen    Array of n password lengths, in bytes (in)
+ *   s       Array of n salts (in)
+ *   sLen    Array of n salt lengths, in bytes (in)
+ *   n       Number of keys to derive
+ *   c       Iteration count, shared by all lanes
+ *   dk      n derived keys of dkLen bytes each, back to back (out)
+ *   dkLen   Length of each derived key, at most ISHA_DIGESTLEN
+ *
+ * Returns:
+ *   NO_ERROR on success, ERROR_INVALID_PARAMETER or ERROR_INVALID_LENGTH
+ *   on bad arguments (as pbkdf1), or ERROR_OUT_OF_MEMORY
+ */
+error_t pbkdf1_batch(const uint8_t *const p[], const size_t pLen[],
+		const uint8_t *const s[], const size_t sLen[], size_t n, uint32_t c,
+		uint8_t *dk, size_t dkLen);
+
+#endif  // _PBKDF1_BATCH_H_
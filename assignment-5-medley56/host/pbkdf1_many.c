@@ -0,0 +1,267 @@
+/*
+ * pbkdf1_many.c
+ *
+ * PBKDF1 over many independent jobs on a work-stealing thread pool.
+ *
+ * Each batch is dealt round-robin into one deque per worker. A worker
+ * pops jobs from the back of its own deque; once that is empty it
+ * steals from the front of the others. Jobs are whole pbkdf1() calls,
+ * thousands of hash iterations each, so a mutex per deque costs nothing
+ * measurable.
+ */
+
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdlib.h>
+
+#include "pbkdf1_many.h"
+#include "pbkdf1.h"
+
+// A batch of jobs, as passed to pbkdf1_many
+typedef struct {
+	const uint8_t *const *p;
+	const size_t *pLen;
+	const uint8_t *const *s;
+	const size_t *sLen;
+	const uint32_t *c;
+	uint8_t *dk;
+	size_t dkLen;
+	error_t *status;
+} batch_t;
+
+// Job indices jobs[head..tail) waiting to run on one worker
+typedef struct {
+	pthread_mutex_t lock;
+	size_t *jobs;
+	size_t head;
+	size_t tail;
+} deque_t;
+
+typedef struct {
+	pbkdf1_pool_t *pool;
+	int id;
+} worker_t;
+
+struct pbkdf1_pool {
+	int nthreads;
+	pthread_t *threads;
+	worker_t *workers;
+	deque_t *deques;
+
+	pthread_mutex_t lock;      // protects everything below
+	pthread_cond_t work_cv;    // signalled when a batch is posted
+	pthread_cond_t done_cv;    // signalled when the last job finishes
+	unsigned generation;       // incremented for every batch
+	bool shutdown;
+	const batch_t *batch;
+	size_t remaining;          // jobs of the current batch not yet finished
+	bool failed;               // any job of the current batch failed
+};
+
+/*
+ * Takes the next job for worker id: the back of its own deque, or
+ * failing that the front of another worker's
+ *
+ * Returns:
+ *   true and the job index in *job, or false if every deque is empty
+ */
+static bool take_job(pbkdf1_pool_t *pool, int id, size_t *job) {
+	deque_t *own = &pool->deques[id];
+	bool found = false;
+
+	pthread_mutex_lock(&own->lock);
+	if (own->head < own->tail) {
+		*job = own->jobs[--own->tail];
+		found = true;
+	}
+	pthread_mutex_unlock(&own->lock);
+
+	for (int k = 1; !found && k < pool->nthreads; k++) {
+		deque_t *victim = &pool->deques[(id + k) % pool->nthreads];
+
+		pthread_mutex_lock(&victim->lock);
+		if (victim->head < victim->tail) {
+			*job = victim->jobs[victim->head++];
+			found = true;
+		}
+		pthread_mutex_unlock(&victim->lock);
+	}
+
+	return found;
+}
+
+static void *worker_main(void *arg) {
+	worker_t *self = arg;
+	pbkdf1_pool_t *pool = self->pool;
+	unsigned seen = 0;
+	size_t j;
+
+	for (;;) {
+		pthread_mutex_lock(&pool->lock);
+		while (!pool->shutdown && pool->generation == seen) {
+			pthread_cond_wait(&pool->work_cv, &pool->lock);
+		}
+		if (pool->shutdown) {
+			pthread_mutex_unlock(&pool->lock);
+			return NULL;
+		}
+		seen = pool->generation;
+		pthread_mutex_unlock(&pool->lock);
+
+		while (take_job(pool, self->id, &j)) {
+			// Look the batch up per job: a worker still draining one batch
+			// can pick up a job of the next, and the batch cannot finish
+			// (and be replaced) while job j is outstanding
+			pthread_mutex_lock(&pool->lock);
+			const batch_t *b = pool->batch;
+			pthread_mutex_unlock(&pool->lock);
+
+			error_t ret = pbkdf1(b->p[j], b->pLen[j], b->s[j], b->sLen[j],
+					b->c[j], b->dk + j * b->dkLen, b->dkLen);
+			b->status[j] = ret;
+
+			pthread_mutex_lock(&pool->lock);
+			if (ret != NO_ERROR) {
+				pool->failed = true;
+			}
+			if (--pool->remaining == 0) {
+				pthread_cond_signal(&pool->done_cv);
+			}
+			pthread_mutex_unlock(&pool->lock);
+		}
+	}
+}
+
+pbkdf1_pool_t *pbkdf1_pool_create(int nthreads) {
+	pbkdf1_pool_t *pool;
+	int started;
+
+	if (nthreads < 1) {
+		return NULL;
+	}
+
+	pool = calloc(1, sizeof(*pool));
+	if (pool == NULL) {
+		return NULL;
+	}
+	pool->nthreads = nthreads;
+	pool->threads = calloc(nthreads, sizeof(*pool->threads));
+	pool->workers = calloc(nthreads, sizeof(*pool->workers));
+	pool->deques = calloc(nthreads, sizeof(*pool->deques));
+	if (pool->threads == NULL || pool->workers == NULL
+			|| pool->deques == NULL) {
+		free(pool->threads);
+		free(pool->workers);
+		free(pool->deques);
+		free(pool);
+		return NULL;
+	}
+
+	pthread_mutex_init(&pool->lock, NULL);
+	pthread_cond_init(&pool->work_cv, NULL);
+	pthread_cond_init(&pool->done_cv, NULL);
+	for (int i = 0; i < nthreads; i++) {
+		pthread_mutex_init(&pool->deques[i].lock, NULL);
+	}
+
+	for (started = 0; started < nthreads; started++) {
+		pool->workers[started].pool = pool;
+		pool->workers[started].id = started;
+		if (pthread_create(&pool->threads[started], NULL, worker_main,
+				&pool->workers[started]) != 0) {
+			break;
+		}
+	}
+	if (started < nthreads) {
+		// Stop the ones that did start
+		pool->nthreads = started;
+		pbkdf1_pool_destroy(pool);
+		return NULL;
+	}
+
+	return pool;
+}
+
+void pbkdf1_pool_destroy(pbkdf1_pool_t *pool) {
+	if (pool == NULL) {
+		return;
+	}
+
+	pthread_mutex_lock(&pool->lock);
+	pool->shutdown = true;
+	pthread_cond_broadcast(&pool->work_cv);
+	pthread_mutex_unlock(&pool->lock);
+
+	for (int i = 0; i < pool->nthreads; i++) {
+		pthread_join(pool->threads[i], NULL);
+	}
+
+	for (int i = 0; i < pool->nthreads; i++) {
+		pthread_mutex_destroy(&pool->deques[i].lock);
+	}
+	pthread_cond_destroy(&pool->done_cv);
+	pthread_cond_destroy(&pool->work_cv);
+	pthread_mutex_destroy(&pool->lock);
+
+	free(pool->threads);
+	free(pool->workers);
+	free(pool->deques);
+	free(pool);
+}
+
+error_t pbkdf1_many(pbkdf1_pool_t *pool, const uint8_t *const p[],
+		const size_t pLen[], const uint8_t *const s[], const size_t sLen[],
+		const uint32_t c[], size_t n, uint8_t *dk, size_t dkLen,
+		error_t status[]) {
+	batch_t batch = { p, pLen, s, sLen, c, dk, dkLen, status };
+	size_t *jobs;
+	size_t per_worker;
+	bool failed;
+
+	//Check parameters
+	if (pool == NULL || p == NULL || pLen == NULL || s == NULL
+			|| sLen == NULL || c == NULL || dk == NULL || status == NULL)
+		return ERROR_INVALID_PARAMETER;
+	if (n == 0)
+		return NO_ERROR;
+
+	// Deal the jobs round-robin, so each worker starts with a similar mix
+	// of iteration counts. Worker i's share is jobs[i * per_worker ..].
+	per_worker = (n + pool->nthreads - 1) / pool->nthreads;
+	jobs = malloc(per_worker * pool->nthreads * sizeof(*jobs));
+	if (jobs == NULL)
+		return ERROR_OUT_OF_MEMORY;
+
+	pthread_mutex_lock(&pool->lock);
+	pool->batch = &batch;
+	pool->remaining = n;
+	pool->failed = false;
+
+	for (int i = 0; i < pool->nthreads; i++) {
+		deque_t *d = &pool->deques[i];
+
+		pthread_mutex_lock(&d->lock);
+		d->jobs = jobs + i * per_worker;
+		d->head = 0;
+		d->tail = 0;
+		for (size_t j = i; j < n; j += pool->nthreads) {
+			d->jobs[d->tail++] = j;
+		}
+		pthread_mutex_unlock(&d->lock);
+	}
+
+	pool->generation++;
+	pthread_cond_broadcast(&pool->work_cv);
+
+	while (pool->remaining > 0) {
+		pthread_cond_wait(&pool->done_cv, &pool->lock);
+	}
+	failed = pool->failed;
+	pool->batch = NULL;
+	pthread_mutex_unlock(&pool->lock);
+
+	// Every deque is empty now, so no worker will look at jobs again
+	free(jobs);
+
+	return failed ? ERROR_FAILURE : NO_ERROR;
+}
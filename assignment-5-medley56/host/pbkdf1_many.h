@@ -0,0 +1,64 @@
+/*
+ * pbkdf1_many.h
+ *
+ * PBKDF1 over many independent jobs, spread over a fixed pool of worker
+ * threads. Each worker owns a deque of jobs and steals from the others
+ * when its own runs dry, so a mix of small and large iteration counts
+ * does not leave threads idle at the end of a batch.
+ */
+
+#ifndef _PBKDF1_MANY_H_
+#define _PBKDF1_MANY_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "error.h"
+
+typedef struct pbkdf1_pool pbkdf1_pool_t;
+
+/*
+ * Starts a pool of worker threads
+ *
+ * Parameters:
+ *   nthreads  Number of workers, at least 1
+ *
+ * Returns:
+ *   The pool, or NULL if it could not be created
+ */
+pbkdf1_pool_t *pbkdf1_pool_create(int nthreads);
+
+/*
+ * Stops the workers and frees the pool. Must not be called while a
+ * pbkdf1_many call on the pool is in progress.
+ */
+void pbkdf1_pool_destroy(pbkdf1_pool_t *pool);
+
+/*
+ * Runs n PBKDF1 jobs on the pool and waits for all of them. Job j is
+ * pbkdf1(p[j], pLen[j], s[j], sLen[j], c[j], dk + j * dkLen, dkLen).
+ * Only one batch may run on a pool at a time.
+ *
+ * Parameters:
+ *   pool    The worker pool
+ *   p       Array of n passwords (in)
+ *   pLen    Array of n password lengths, in bytes (in)
+ *   s       Array of n salts (in)
+ *   sLen    Array of n salt lengths, in bytes (in)
+ *   c       Array of n iteration counts (in)
+ *   n       Number of jobs
+ *   dk      n derived keys of dkLen bytes each, back to back (out)
+ *   dkLen   Length of each derived key
+ *   status  Array of n results, the pbkdf1 return value of each job (out)
+ *
+ * Returns:
+ *   NO_ERROR if every job succeeded, ERROR_FAILURE if any job failed
+ *   (see status), or ERROR_INVALID_PARAMETER / ERROR_OUT_OF_MEMORY if
+ *   the batch could not be run at all
+ */
+error_t pbkdf1_many(pbkdf1_pool_t *pool, const uint8_t *const p[],
+		const size_t pLen[], const uint8_t *const s[], const size_t sLen[],
+		const uint32_t c[], size_t n, uint8_t *dk, size_t dkLen,
+		error_t status[]);
+
+#endif  // _PBKDF1_MANY_H_
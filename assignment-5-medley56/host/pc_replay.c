@@ -0,0 +1,112 @@
+/*
+ * pc_replay.c
+ *
+ * Replays a recorded trace of sampled PCs through the PC profiler and
+ * prints the flat profile, most sampled function first. The symbol
+ * table is built from nm output the same way pc_symtab_gen builds it
+ * for the firmware.
+ *
+ * A trace is one PC per line, in hex; blank lines and lines starting
+ * with # are ignored.
+ *
+ * Usage: pc_replay nm-output trace
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "nm_symtab.h"
+
+static const pc_symbol_t *sort_table;
+static const uint32_t *sort_counts;
+
+// Most samples first, then by address
+static int compare_index(const void *a, const void *b) {
+	size_t x = *(const size_t *) a;
+	size_t y = *(const size_t *) b;
+
+	if (sort_counts[x] != sort_counts[y]) {
+		return (sort_counts[x] > sort_counts[y]) ? -1 : 1;
+	}
+	return (sort_table[x].start < sort_table[y].start) ? -1 : 1;
+}
+
+static void print_row(uint32_t count, uint32_t total, uint32_t cumulative,
+		const char *name) {
+	printf("%6.1f%%  %6.1f%%  %8u  %s\n", 100.0 * count / total,
+			100.0 * cumulative / total, (unsigned) count, name);
+}
+
+int main(int argc, char *argv[]) {
+	FILE *nm, *trace;
+	pc_symbol_t *table;
+	uint32_t *counts;
+	size_t *order;
+	size_t len;
+	uint32_t total = 0;
+	uint32_t cumulative = 0;
+	char line[128];
+
+	if (argc != 3) {
+		fprintf(stderr, "usage: %s nm-output trace\n", argv[0]);
+		return 2;
+	}
+	nm = fopen(argv[1], "r");
+	if (nm == NULL) {
+		perror(argv[1]);
+		return 1;
+	}
+	trace = fopen(argv[2], "r");
+	if (trace == NULL) {
+		perror(argv[2]);
+		return 1;
+	}
+
+	if (nm_symtab_read(nm, &table, &len) != 0) {
+		fprintf(stderr, "%s: out of memory\n", argv[0]);
+		return 1;
+	}
+	fclose(nm);
+	counts = calloc(len ? len : 1, sizeof(*counts));
+	order = calloc(len ? len : 1, sizeof(*order));
+	if (counts == NULL || order == NULL) {
+		fprintf(stderr, "%s: out of memory\n", argv[0]);
+		return 1;
+	}
+
+	pc_profile_init(table, len, counts);
+	while (fgets(line, sizeof(line), trace) != NULL) {
+		unsigned long pc;
+
+		if (line[0] == '#' || sscanf(line, "%lx", &pc) != 1) {
+			continue;
+		}
+		pc_profile_sample((uint32_t) pc);
+		total++;
+	}
+	fclose(trace);
+
+	printf("%u samples, %zu functions\n", (unsigned) total, len);
+	if (total != 0) {
+		printf("      %%    cum %%   samples  function\n");
+		for (size_t i = 0; i < len; i++) {
+			order[i] = i;
+		}
+		sort_table = table;
+		sort_counts = counts;
+		qsort(order, len, sizeof(*order), compare_index);
+		for (size_t i = 0; i < len && counts[order[i]] != 0; i++) {
+			cumulative += counts[order[i]];
+			print_row(counts[order[i]], total, cumulative, table[order[i]].name);
+		}
+		if (pc_profile_unknown() != 0) {
+			cumulative += pc_profile_unknown();
+			print_row(pc_profile_unknown(), total, cumulative, "(unknown)");
+		}
+	}
+
+	free(order);
+	free(counts);
+	nm_symtab_free(table, len);
+	return 0;
+}
@@ -0,0 +1,74 @@
+/*
+ * pc_symtab_gen.c
+ *
+ * Generates source/pc_symtab.c, the PC profiler's symbol table, from
+ * the nm output of the linked firmware:
+ *
+ *   arm-none-eabi-nm -S -n --defined-only Debug/assignment-5-medley56.axf \
+ *       | host/pc_symtab_gen > source/pc_symtab.c
+ *
+ * The table is part of the image it describes, so the post-build step
+ * of the MCUXpresso project, host/pc_symtab_update.sh, runs this after
+ * every link and relinks when the table changed. pc_profile_on still
+ * warns if it does not match the running image.
+ *
+ * Usage: pc_symtab_gen [nm-output]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "nm_symtab.h"
+
+int main(int argc, char *argv[]) {
+	FILE *in = stdin;
+	pc_symbol_t *table;
+	size_t len;
+
+	if (argc > 2) {
+		fprintf(stderr, "usage: %s [nm-output]\n", argv[0]);
+		return 2;
+	}
+	if (argc == 2) {
+		in = fopen(argv[1], "r");
+		if (in == NULL) {
+			perror(argv[1]);
+			return 1;
+		}
+	}
+	if (nm_symtab_read(in, &table, &len) != 0) {
+		fprintf(stderr, "%s: out of memory\n", argv[0]);
+		return 1;
+	}
+	if (in != stdin) {
+		fclose(in);
+	}
+
+	printf("/*\n");
+	printf(" * pc_symtab.c\n");
+	printf(" *\n");
+	printf(" * Generated by host/pc_symtab_gen from the nm output of the linked\n");
+	printf(" * image. Do not edit: the post-build step (host/pc_symtab_update.sh)\n");
+	printf(" * regenerates it after every link, and relinks when it changed.\n");
+	printf(" */\n\n");
+	printf("#include \"pc_profiler.h\"\n\n");
+
+	if (len == 0) {
+		// No zero-length arrays in C; the one entry is never looked at
+		printf("const pc_symbol_t pc_symtab[1];\n");
+		printf("const size_t pc_symtab_len = 0;\n");
+		printf("uint32_t pc_symtab_counts[1];\n");
+	} else {
+		printf("const pc_symbol_t pc_symtab[] = {\n");
+		for (size_t i = 0; i < len; i++) {
+			printf("\t{ 0x%08x, 0x%08x, \"%s\" },\n", (unsigned) table[i].start,
+					(unsigned) table[i].end, table[i].name);
+		}
+		printf("};\n");
+		printf("const size_t pc_symtab_len = %zu;\n", len);
+		printf("uint32_t pc_symtab_counts[%zu];\n", len);
+	}
+
+	nm_symtab_free(table, len);
+	return 0;
+}
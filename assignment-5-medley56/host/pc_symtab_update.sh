@@ -0,0 +1,47 @@
+#!/bin/sh
+#
+# pc_symtab_update.sh
+#
+# Post-build step of both MCUXpresso configurations, run from the
+# build directory after each link:
+#
+#   sh ../host/pc_symtab_update.sh assignment-5-medley56.axf
+#
+# Regenerates source/pc_symtab.c from the image with host/pc_symtab_gen.
+# The table is part of the image it describes, so when it changes the
+# build is run again to relink with it. That second link only moves the
+# table and counts, which come after the code, so the table it produces
+# is the same. If it is not stable after MAX_PASSES links, fail the build
+# rather than ship a table that does not match.
+
+set -e
+
+MAX_PASSES=3
+CROSS=${CROSS:-arm-none-eabi-}
+
+axf=$1
+host=$(dirname "$0")
+table=$host/../source/pc_symtab.c
+pass=${PC_SYMTAB_PASS:-1}
+
+if [ -z "$axf" ] || [ ! -f "$axf" ]; then
+	echo "usage: $0 image.axf" >&2
+	exit 2
+fi
+
+make -s -C "$host" pc_symtab_gen
+"${CROSS}nm" -S -n --defined-only "$axf" | "$host/pc_symtab_gen" > pc_symtab.c.new
+
+if cmp -s pc_symtab.c.new "$table"; then
+	rm -f pc_symtab.c.new
+	exit 0
+fi
+if [ "$pass" -ge "$MAX_PASSES" ]; then
+	rm -f pc_symtab.c.new
+	echo "pc_symtab.c still changes after $pass links" >&2
+	exit 1
+fi
+
+mv pc_symtab.c.new "$table"
+echo "pc_symtab.c regenerated; relinking (pass $((pass + 1)))"
+PC_SYMTAB_PASS=$((pass + 1)) make --no-print-directory all
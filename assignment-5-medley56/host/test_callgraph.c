@@ -0,0 +1,209 @@
+/*
+ * test_callgraph.c
+ *
+ * Test functions for the call-stack sampling profiler
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "fsl_debug_console.h"
+#include "test_callgraph.h"
+#include "callgraph.h"
+
+/*
+ * The synthetic image: four functions of 0x100 bytes each, where
+ * a calls b with a BL at 0x1040, b calls c with a BLX r3 at 0x1180,
+ * c calls d with a BL at 0x1220, and d calls nothing
+ */
+#define CODE_START  0x1000
+#define CODE_END    0x1400
+#define RET_A       0x1044  // after the BL in a
+#define RET_B       0x1182  // after the BLX in b
+#define RET_C       0x1224  // after the BL in c
+
+static uint16_t code[(CODE_END - CODE_START) / 2];
+
+static const pc_symbol_t symbols[] = {
+	{ 0x1000, 0x1100, "a" },
+	{ 0x1100, 0x1200, "b" },
+	{ 0x1200, 0x1300, "c" },
+	{ 0x1300, 0x1400, "d" },
+};
+
+static uint16_t read_code(uint32_t addr) {
+	return code[(addr - CODE_START) / 2];
+}
+
+static void make_code(void) {
+	// Every halfword a NOP, except the calls
+	for (size_t i = 0; i < sizeof(code) / sizeof(code[0]); i++) {
+		code[i] = 0xBF00;
+	}
+	code[(RET_A - 4 - CODE_START) / 2] = 0xF000;  // bl b
+	code[(RET_A - 2 - CODE_START) / 2] = 0xF87E;
+	code[(RET_B - 2 - CODE_START) / 2] = 0x4798;  // blx r3
+	code[(RET_C - 4 - CODE_START) / 2] = 0xF000;  // bl d
+	code[(RET_C - 2 - CODE_START) / 2] = 0xF86E;
+}
+
+static void init(bool with_symbols) {
+	callgraph_config_t cfg = { CODE_START, CODE_END, read_code,
+			with_symbols ? symbols : NULL, with_symbols ? 4 : 0 };
+
+	callgraph_init(&cfg);
+}
+
+/*
+ * Writes an exception frame for an interrupt at pc with lr, and returns
+ * the number of words written
+ */
+static int make_frame(uint32_t *stack, uint32_t lr, uint32_t pc, bool padded) {
+	for (int i = 0; i < CALLGRAPH_FRAME_WORDS; i++) {
+		stack[i] = 0x20000000 + i;  // r0-r3, r12
+	}
+	stack[CALLGRAPH_FRAME_LR] = lr;
+	stack[CALLGRAPH_FRAME_PC] = pc;
+	stack[CALLGRAPH_FRAME_XPSR] = 0x01000000 | (padded ? (1u << 9) : 0);
+	if (padded) {
+		stack[CALLGRAPH_FRAME_WORDS] = RET_A | 1;  // must not be read
+		return CALLGRAPH_FRAME_WORDS + 1;
+	}
+	return CALLGRAPH_FRAME_WORDS;
+}
+
+static bool chain_is(const uint32_t *chain, int n, const uint32_t *exp,
+		int exp_n) {
+	return n == exp_n && memcmp(chain, exp, n * sizeof(chain[0])) == 0;
+}
+
+/*
+ * Returns the count of edge (site, callee), or 0 if it was not seen
+ */
+static uint32_t edge_count(uint32_t site, uint32_t callee) {
+	uint32_t samples, dropped;
+	const callgraph_edge_t *edges = callgraph_edges(&samples, &dropped);
+
+	for (int i = 0; i < CALLGRAPH_EDGES; i++) {
+		if (edges[i].count && edges[i].site == site
+				&& edges[i].callee == callee) {
+			return edges[i].count;
+		}
+	}
+	return 0;
+}
+
+static void report(bool ok, int test, int *tests_passed) {
+	if (ok) {
+		PRINTF("%s test %d: success\r\n", "test_callgraph", test);
+		(*tests_passed)++;
+	} else {
+		PRINTF("%s test %d: FAILURE\r\n", "test_callgraph", test);
+	}
+}
+
+bool test_callgraph()
+{
+	uint32_t stack[64];
+	uint32_t chain[CALLGRAPH_MAX_DEPTH];
+	int test = 0;
+	int tests_passed = 0;
+	int n, k;
+
+	make_code();
+
+	// Leaf d interrupted: LR returns into c, then the stack holds c's
+	// push {r4, lr}, b's push {r4-r7, lr} and a's push {lr}, with words
+	// that are not return addresses in between
+	{
+		static const uint32_t exp[] = { 0x1310, RET_C, RET_B, RET_A };
+
+		init(true);
+		k = make_frame(stack, RET_C | 1, 0x1310, false);
+		stack[k++] = 0x1051;            // odd and in code, but no call before it
+		stack[k++] = RET_B | 1;         // c: lr
+		stack[k++] = RET_A;             // Thumb bit clear
+		stack[k++] = 0x20001000;        // b: r4-r7
+		stack[k++] = 0xDEADBEEF;
+		stack[k++] = 0x00000000;
+		stack[k++] = 0x1101;
+		stack[k++] = RET_A | 1;         // b: lr
+		stack[k++] = 0x5001;            // outside the code
+		n = callgraph_unwind(stack, stack + k, chain, CALLGRAPH_MAX_DEPTH);
+		report(chain_is(chain, n, exp, 4), test++, &tests_passed);
+	}
+
+	// The interrupted function has made a call, so LR points back into
+	// itself and is skipped; its pushed LR returns into b. The frame was
+	// padded for alignment.
+	{
+		static const uint32_t exp[] = { 0x1230, RET_B, RET_A };
+
+		init(true);
+		k = make_frame(stack, RET_C | 1, 0x1230, true);
+		stack[k++] = RET_B | 1;
+		stack[k++] = RET_A | 1;
+		n = callgraph_unwind(stack, stack + k, chain, CALLGRAPH_MAX_DEPTH);
+		report(chain_is(chain, n, exp, 3), test++, &tests_passed);
+	}
+
+	// The scan stops at the end of the stack and at max entries
+	{
+		static const uint32_t exp[] = { 0x1310, RET_C };
+
+		init(true);
+		k = make_frame(stack, RET_C | 1, 0x1310, false);
+		stack[k++] = RET_B | 1;
+		n = callgraph_unwind(stack, stack + k - 1, chain, CALLGRAPH_MAX_DEPTH);
+		report(chain_is(chain, n, exp, 2)
+				&& callgraph_unwind(stack, stack + k, chain, 2) == 2
+				&& callgraph_unwind(stack, stack + k, chain, 0) == 0, test++,
+				&tests_passed);
+	}
+
+	// Edges: the same stack sampled three times, interrupted in two
+	// places in d, then once in b
+	{
+		init(true);
+		k = make_frame(stack, RET_C | 1, 0x1310, false);
+		stack[k++] = RET_B | 1;
+		stack[k++] = RET_A | 1;
+		callgraph_sample(stack, stack + k);
+		callgraph_sample(stack, stack + k);
+		stack[CALLGRAPH_FRAME_PC] = 0x13F0;
+		callgraph_sample(stack, stack + k);
+		k = make_frame(stack, RET_A | 1, 0x1150, false);
+		callgraph_sample(stack, stack + k);
+
+		report(edge_count(0, 0x1300) == 3 && edge_count(RET_C, 0x1300) == 3
+				&& edge_count(RET_B, 0x1200) == 3
+				&& edge_count(RET_A, 0x1100) == 4
+				&& edge_count(0, 0x1100) == 1, test++, &tests_passed);
+	}
+
+	// Without symbols every leaf PC is its own callee; once the table is
+	// full further edges are dropped, not overwritten
+	{
+		uint32_t samples, dropped;
+		uint32_t used = 0;
+		const callgraph_edge_t *edges;
+
+		init(false);
+		k = make_frame(stack, 0, 0, false);
+		for (uint32_t pc = CODE_START; pc < CODE_START + 4 * CALLGRAPH_EDGES;
+				pc += 2) {
+			stack[CALLGRAPH_FRAME_PC] = pc;
+			callgraph_sample(stack, stack + k);
+		}
+		edges = callgraph_edges(&samples, &dropped);
+		for (int i = 0; i < CALLGRAPH_EDGES; i++) {
+			used += (edges[i].count != 0);
+		}
+		report(samples == 2 * CALLGRAPH_EDGES && dropped > 0
+				&& used + dropped == samples && edge_count(0, CODE_START) == 1,
+				test++, &tests_passed);
+	}
+
+	return (test == tests_passed);
+}
@@ -0,0 +1,20 @@
+/*
+ * test_callgraph.h
+ *
+ * Test functions for the call-stack sampling profiler
+ */
+
+#ifndef _TEST_CALLGRAPH_H_
+#define _TEST_CALLGRAPH_H_
+
+#include <stdbool.h>
+
+/*
+ * Unwinds synthetic exception frames and stacks over a synthetic code
+ * image, and checks the unwound chains and the edges counted for them.
+ * Returns true if all tests pass, false otherwise. Diagnostic
+ * information is printed via PRINTF.
+ */
+bool test_callgraph();
+
+#endif  // _TEST_CALLGRAPH_H_
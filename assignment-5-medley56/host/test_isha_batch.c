@@ -0,0 +1,157 @@
+/*
+ * test_isha_batch.c
+ *
+ * Test functions for the multi-lane ISHA and PBKDF1
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "fsl_debug_console.h"
+#include "test_isha_batch.h"
+#include "pbkdf1_test.h"
+#include "isha.h"
+#include "isha_batch.h"
+#include "pbkdf1.h"
+#include "pbkdf1_batch.h"
+
+#define MAX_LANES   37   // not a multiple of any vector width
+#define MAX_MSGLEN  150  // long enough for three padded blocks
+
+/*
+ * Fills lane j's message with a length and contents that differ per
+ * lane, covering the 55/56 and 63/64 byte padding boundaries
+ */
+static size_t make_message(uint8_t *msg, int j) {
+	size_t len = (j * 29 + 3) % MAX_MSGLEN;
+
+	for (size_t i = 0; i < len; i++) {
+		msg[i] = (uint8_t) (i * 7 + j * 13);
+	}
+	return len;
+}
+
+/*
+ * Compares n lanes of isha_batch_hash followed by isha_batch_iterate
+ * against ISHA and ISHAIterateDigest
+ */
+static bool check_hash(size_t n, uint32_t count) {
+	static uint8_t bufs[MAX_LANES][MAX_MSGLEN];
+	const uint8_t *msgs[MAX_LANES] = { 0 };
+	size_t lens[MAX_LANES] = { 0 };
+	uint32_t md[MAX_LANES * ISHA_DIGESTWORDS];
+	uint8_t act_digest[ISHA_DIGESTLEN];
+	uint8_t exp_digest[ISHA_DIGESTLEN];
+	ISHAContext ctx;
+
+	for (size_t j = 0; j < n; j++) {
+		lens[j] = make_message(bufs[j], j);
+		msgs[j] = bufs[j];
+	}
+
+	isha_batch_hash(msgs, lens, n, md);
+	isha_batch_iterate(md, n, count);
+
+	for (size_t j = 0; j < n; j++) {
+		ISHAReset(&ctx);
+		ISHAInput(&ctx, msgs[j], lens[j]);
+		ISHAResult(&ctx, exp_digest);
+		ISHAIterateDigest(ctx.MD, count);
+		for (int i = 0; i < ISHA_DIGESTLEN; i++) {
+			exp_digest[i] = (uint8_t) (ctx.MD[i / 4] >> (24 - 8 * (i % 4)));
+		}
+
+		isha_batch_digest_bytes(md, n, j, act_digest, ISHA_DIGESTLEN);
+		if (!cmp_bin(act_digest, exp_digest, ISHA_DIGESTLEN)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+/*
+ * Compares n lanes of pbkdf1_batch against pbkdf1
+ */
+static bool check_pbkdf1(size_t n, uint32_t c, size_t dkLen) {
+	static const char *passwords[] = { "password", "Boulder", "", "hunter2",
+			"correct horse battery staple" };
+	static const char *salts[] = { "mysalt", "Buffaloes", "NaCl", "",
+			"0123456789012345678901234567890123456789012345678901234" };
+	const uint8_t *p[MAX_LANES] = { 0 }, *s[MAX_LANES] = { 0 };
+	size_t pLen[MAX_LANES] = { 0 }, sLen[MAX_LANES] = { 0 };
+	uint8_t act_dk[MAX_LANES * ISHA_DIGESTLEN];
+	uint8_t exp_dk[ISHA_DIGESTLEN];
+
+	for (size_t j = 0; j < n; j++) {
+		p[j] = (const uint8_t *) passwords[j % 5];
+		s[j] = (const uint8_t *) salts[(j / 5) % 5];
+		pLen[j] = strlen(passwords[j % 5]);
+		sLen[j] = strlen(salts[(j / 5) % 5]);
+	}
+
+	if (pbkdf1_batch(p, pLen, s, sLen, n, c, act_dk, dkLen) != NO_ERROR) {
+		return false;
+	}
+
+	for (size_t j = 0; j < n; j++) {
+		if (pbkdf1(p[j], pLen[j], s[j], sLen[j], c, exp_dk, dkLen) != NO_ERROR
+				|| !cmp_bin(act_dk + j * dkLen, exp_dk, dkLen)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+bool test_isha_batch()
+{
+	static const size_t lane_counts[] = { 1, 3, 4, 5, 8, 13, MAX_LANES };
+	const int num_counts = sizeof(lane_counts) / sizeof(lane_counts[0]);
+	isha_batch_isa_t saved = isha_batch_get_isa();
+	int test = 0;
+	int tests_passed = 0;
+
+	for (int isa = ISHA_BATCH_SCALAR; isa <= saved; isa++) {
+		isha_batch_set_isa((isha_batch_isa_t) isa);
+
+		for (int i = 0; i < num_counts; i++, test++) {
+			size_t n = lane_counts[i];
+			bool ok = check_hash(n, 0) && check_hash(n, 1)
+					&& check_hash(n, 100)
+					&& check_pbkdf1(n, 1, ISHA_DIGESTLEN)
+					&& check_pbkdf1(n, 1000, 9);
+
+			if (ok) {
+				PRINTF("%s test %d (%s, %zu lanes): success\r\n", __FUNCTION__,
+						test, isha_batch_isa_name(isa), n);
+				tests_passed++;
+			} else {
+				PRINTF("%s test %d (%s, %zu lanes): FAILURE\r\n", __FUNCTION__,
+						test, isha_batch_isa_name(isa), n);
+			}
+		}
+	}
+
+	// Bad parameters are rejected the same way as pbkdf1
+	{
+		const uint8_t *p[1] = { (const uint8_t *) "password" };
+		const uint8_t *s[1] = { (const uint8_t *) "mysalt" };
+		size_t pLen[1] = { 8 }, sLen[1] = { 6 };
+		uint8_t dk[32];
+
+		if (pbkdf1_batch(p, pLen, s, sLen, 1, 1, dk, 21) == ERROR_INVALID_LENGTH
+				&& pbkdf1_batch(p, pLen, s, sLen, 1, 0, dk, 20)
+						== ERROR_INVALID_PARAMETER
+				&& pbkdf1_batch(p, pLen, s, sLen, 1, 1, NULL, 20)
+						== ERROR_INVALID_PARAMETER) {
+			PRINTF("%s test %d: success\r\n", __FUNCTION__, test);
+			tests_passed++;
+		} else {
+			PRINTF("%s test %d: FAILURE\r\n", __FUNCTION__, test);
+		}
+		test++;
+	}
+
+	isha_batch_set_isa(saved);
+	return (test == tests_passed);
+}
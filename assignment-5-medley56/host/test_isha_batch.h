@@ -0,0 +1,21 @@
+/*
+ * test_isha_batch.h
+ *
+ * Test functions for the multi-lane ISHA and PBKDF1
+ */
+
+#ifndef _TEST_ISHA_BATCH_H_
+#define _TEST_ISHA_BATCH_H_
+
+#include <stdbool.h>
+
+/*
+ * Checks isha_batch_hash, isha_batch_iterate and pbkdf1_batch against
+ * the single-lane ISHA and pbkdf1, on every instruction set the CPU
+ * supports and for lane counts that do not fill a whole vector. Returns
+ * true if all tests pass, false otherwise. Diagnostic information is
+ * printed via PRINTF.
+ */
+bool test_isha_batch();
+
+#endif  // _TEST_ISHA_BATCH_H_
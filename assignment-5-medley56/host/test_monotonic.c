@@ -0,0 +1,198 @@
+/*
+ * test_monotonic.c
+ *
+ * Test functions for the 64-bit monotonic cycle clock
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "fsl_debug_console.h"
+#include "test_monotonic.h"
+#include "monotonic.h"
+
+#define SIM_PERIOD  4800      // LOAD + 1, as in ticktime.c
+#define SIM_HZ      48000000
+#define SIM_READS   200000
+
+/*
+ * Simulated SysTick. Time only moves when the counter or the pending
+ * flag is read, by sim_step cycles, or between reads. The tick
+ * interrupt runs just before or just after a read once it has been
+ * pending for sim_latency reads, which puts it between any two
+ * instructions of monotonic_now().
+ */
+static monotonic_clock_t clk;
+static uint64_t sim_time;       // true cycles since monotonic_init
+static uint64_t sim_delivered;  // reloads whose interrupt has run
+static uint32_t sim_step;
+static uint32_t sim_latency;
+static uint32_t sim_waited;
+static bool sim_masked;
+static uint32_t sim_midcall;    // interrupts run inside monotonic_now
+static uint32_t sim_seen;       // reads that saw the reload pending
+
+static uint32_t lcg_state = 1;
+
+static uint32_t lcg(void) {
+	lcg_state = lcg_state * 1664525u + 1013904223u;
+	return lcg_state >> 8;
+}
+
+static uint64_t sim_reloads(void) {
+	return sim_time / SIM_PERIOD;
+}
+
+static void sim_deliver(void) {
+	sim_delivered++;
+	sim_waited = 0;
+	monotonic_tick(&clk);
+}
+
+static void sim_maybe_interrupt(void) {
+	if (sim_masked || sim_reloads() == sim_delivered) {
+		return;
+	}
+	if (sim_waited++ < sim_latency) {
+		return;
+	}
+	sim_deliver();
+	sim_midcall++;
+}
+
+static uint32_t sim_counter(void) {
+	uint32_t val;
+
+	sim_maybe_interrupt();
+	sim_time += sim_step;
+	val = SIM_PERIOD - 1 - (uint32_t) (sim_time % SIM_PERIOD);
+	sim_maybe_interrupt();
+	return val;
+}
+
+static bool sim_pending(void) {
+	bool pending;
+
+	sim_maybe_interrupt();
+	sim_time += sim_step;
+	pending = sim_reloads() > sim_delivered;
+	sim_seen += pending;
+	sim_maybe_interrupt();
+	return pending;
+}
+
+/*
+ * Lets time pass outside monotonic_now(). Every reload is delivered,
+ * except that a reload in the last 64 cycles may stay pending into the
+ * next read: the interrupt is late, but not by a whole period.
+ */
+static void sim_idle(uint32_t cycles, bool leave_pending) {
+	sim_time += cycles;
+	leave_pending = leave_pending && sim_time % SIM_PERIOD < 64;
+	while (sim_reloads() > sim_delivered + (leave_pending ? 1 : 0)) {
+		sim_deliver();
+	}
+}
+
+/*
+ * Returns true if x / hz * scale, rounded down, is r. Reference in
+ * 128 bits.
+ */
+static bool scaled_is(uint64_t x, uint32_t scale, uint64_t r) {
+	return (uint64_t) ((unsigned __int128) x * scale / SIM_HZ) == r;
+}
+
+static void report(bool ok, int test, int *tests_passed) {
+	if (ok) {
+		PRINTF("%s test %d: success\r\n", "test_monotonic", test);
+		(*tests_passed)++;
+	} else {
+		PRINTF("%s test %d: FAILURE\r\n", "test_monotonic", test);
+	}
+}
+
+bool test_monotonic()
+{
+	int test = 0;
+	int tests_passed = 0;
+	uint64_t last = 0;
+	uint32_t bad = 0;
+	bool ok;
+
+	// Starts at 0 and counts every cycle while no reload is near
+	sim_time = 0;
+	sim_delivered = 0;
+	sim_step = 1;
+	sim_latency = 0;
+	sim_masked = false;
+	monotonic_init(&clk, SIM_PERIOD, SIM_HZ, sim_counter, sim_pending);
+	ok = monotonic_now(&clk) == 1;
+	sim_idle(1000, false);
+	ok = ok && monotonic_now(&clk) == 1003;
+	report(ok, test++, &tests_passed);
+
+	// Reads near reloads, with the interrupt arriving at every point of
+	// the read, late, or masked for the whole read
+	sim_midcall = 0;
+	sim_seen = 0;
+	for (int i = 0; i < SIM_READS; i++) {
+		uint64_t before, after, t;
+		uint32_t t32;
+		uint32_t to_reload;
+
+		sim_step = 1 + lcg() % 8;
+		sim_latency = lcg() % 8;
+		sim_waited = 0;
+		// Mostly land within a few reads of a reload
+		to_reload = SIM_PERIOD - (uint32_t) (sim_time % SIM_PERIOD);
+		if (lcg() % 4) {
+			uint32_t skew = lcg() % 64;
+			sim_idle((to_reload + SIM_PERIOD - 32 + skew) % SIM_PERIOD,
+					lcg() % 2);
+		} else {
+			sim_idle(lcg() % (3 * SIM_PERIOD), lcg() % 2);
+		}
+		// Masked with a reload pending is fine, as long as the read does
+		// not run into a second reload
+		to_reload = SIM_PERIOD - (uint32_t) (sim_time % SIM_PERIOD);
+		sim_masked = (lcg() % 4 == 0)
+				&& (sim_reloads() == sim_delivered || to_reload > 128);
+
+		before = sim_time;
+		t = monotonic_now(&clk);
+		t32 = monotonic_now32(&clk);
+		after = sim_time;
+
+		// The 32-bit read comes second, so it lies in [t, after]
+		if (t < before || t > after || t < last
+				|| (uint32_t) (t32 - (uint32_t) t) > after - t) {
+			if (bad++ < 5) {
+				PRINTF("read %d: %llu not in [%llu, %llu] or below %llu\r\n", i,
+						(unsigned long long) t, (unsigned long long) before,
+						(unsigned long long) after, (unsigned long long) last);
+			}
+		}
+		last = t;
+		sim_masked = false;
+	}
+	ok = bad == 0 && sim_midcall > 0 && sim_seen > 0;
+	if (!ok) {
+		PRINTF("%u bad reads, %u interrupts inside a read, %u pending seen\r\n",
+				bad, sim_midcall, sim_seen);
+	}
+	report(ok, test++, &tests_passed);
+
+	// Conversions round down and do not overflow
+	ok = monotonic_to_us(&clk, 47) == 0 && monotonic_to_us(&clk, 48) == 1
+			&& monotonic_to_ns(&clk, 1) == 20 && monotonic_to_ms(&clk, 48000) == 1
+			&& monotonic_from_us(&clk, 1) == 48
+			&& monotonic_from_us(&clk, 1500000) == 72000000;
+	for (uint64_t x = UINT64_MAX; x > 0 && ok; x /= 3) {
+		ok = scaled_is(x, 1000000000u, monotonic_to_ns(&clk, x))
+				&& scaled_is(x, 1000000u, monotonic_to_us(&clk, x))
+				&& scaled_is(x, 1000u, monotonic_to_ms(&clk, x));
+	}
+	report(ok, test++, &tests_passed);
+
+	return (test == tests_passed);
+}
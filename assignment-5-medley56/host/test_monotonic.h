@@ -0,0 +1,22 @@
+/*
+ * test_monotonic.h
+ *
+ * Test functions for the 64-bit monotonic cycle clock
+ */
+
+#ifndef _TEST_MONOTONIC_H_
+#define _TEST_MONOTONIC_H_
+
+#include <stdbool.h>
+
+/*
+ * Reads the monotonic clock against a simulated SysTick whose tick
+ * interrupt preempts at every point of the read, including with the
+ * reload pending and interrupts masked, and checks that each reading
+ * lies within the call and never goes backwards. Also checks the unit
+ * conversions. Returns true if all tests pass, false otherwise.
+ * Diagnostic information is printed via PRINTF.
+ */
+bool test_monotonic();
+
+#endif  // _TEST_MONOTONIC_H_
@@ -0,0 +1,117 @@
+/*
+ * test_mtb.c
+ *
+ * Test functions for the MTB dump decoder
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "fsl_debug_console.h"
+#include "test_mtb.h"
+#include "mtb_trace.h"
+
+// Console output around a 32-byte (4-packet) dump
+static const char dump_text[] =
+	"time_pbkdf1: 4096 iterations complete\r\n"
+	"mtb: base 0x1ffff000 size 32 position 0x00000014\r\n"
+	"0x00000101 0x00000200\r\n"
+	"0x00000210 0x00000300\r\n"
+	"0x00000310 0x00000401\r\n"
+	"0x00000410 0x00000500\r\n"
+	"end mtb\r\n"
+	"Done with MTB trace test....\r\n";
+
+// The same dump cut short
+static const char truncated_text[] =
+	"mtb: base 0x1ffff000 size 32 position 0x00000014\r\n"
+	"0x00000101 0x00000200\r\n"
+	"0x00000210 0x00000300\r\n";
+
+static int read_text(const char *text, mtb_dump_t *dump) {
+	FILE *f = fmemopen((void *) text, strlen(text), "r");
+	int status = mtb_dump_read(f, dump);
+
+	if (status == 1) {
+		// Nothing but trailing output is left
+		mtb_dump_t next;
+
+		if (mtb_dump_read(f, &next) != 0) {
+			status = -2;
+		}
+	}
+	fclose(f);
+	return status;
+}
+
+static bool packet_is(const mtb_packet_t *p, uint32_t source,
+		uint32_t destination, bool exception, bool start) {
+	return p->source == source && p->destination == destination
+			&& p->exception == exception && p->start == start;
+}
+
+static void report(bool ok, int test, int *tests_passed) {
+	if (ok) {
+		PRINTF("%s test %d: success\r\n", "test_mtb", test);
+		(*tests_passed)++;
+	} else {
+		PRINTF("%s test %d: FAILURE\r\n", "test_mtb", test);
+	}
+}
+
+bool test_mtb()
+{
+	int test = 0;
+	int tests_passed = 0;
+	mtb_dump_t dump;
+	mtb_packet_t p[4];
+	uint32_t first, last;
+	bool ok;
+
+	// Parse, skipping the surrounding console output
+	ok = read_text(dump_text, &dump) == 1 && dump.base == 0x1ffff000
+			&& dump.size == 32 && dump.position == 0x14
+			&& dump.words[0] == 0x101 && dump.words[7] == 0x500;
+	mtb_dump_free(&dump);
+	ok = ok && read_text(truncated_text, &dump) == -1 && dump.words == NULL;
+	report(ok, test++, &tests_passed);
+
+	// Not wrapped: packets from the start of the buffer to the pointer.
+	// Bit 0 of the words are the A and S flags.
+	read_text(dump_text, &dump);
+	dump.position = 0x18;
+	ok = mtb_packets(&dump, p) == 3
+			&& packet_is(&p[0], 0x100, 0x200, true, false)
+			&& packet_is(&p[2], 0x310, 0x400, false, true);
+	report(ok, test++, &tests_passed);
+
+	// Wrapped: all of the buffer, the oldest at the pointer (slot 2)
+	dump.position = 0x14;
+	ok = mtb_packets(&dump, p) == 4
+			&& packet_is(&p[0], 0x310, 0x400, false, true)
+			&& packet_is(&p[1], 0x410, 0x500, false, false)
+			&& packet_is(&p[2], 0x100, 0x200, true, false)
+			&& packet_is(&p[3], 0x210, 0x300, false, false);
+	mtb_dump_free(&dump);
+	report(ok, test++, &tests_passed);
+
+	// Runs go from one destination to the next source. Not across a
+	// restart, backwards, or further than MTB_MAX_RUN_BYTES.
+	{
+		mtb_packet_t a = { 0x100, 0x200, false, false };
+		mtb_packet_t b = { 0x220, 0x300, false, false };
+		mtb_packet_t restart = { 0x220, 0x300, false, true };
+		mtb_packet_t back = { 0x1fe, 0x300, false, false };
+		mtb_packet_t far = { 0x200 + MTB_MAX_RUN_BYTES, 0x300, false, false };
+
+		ok = mtb_run(&a, &b, &first, &last) && first == 0x200 && last == 0x220
+				&& !mtb_run(&a, &restart, &first, &last)
+				&& !mtb_run(&a, &back, &first, &last)
+				&& !mtb_run(&a, &far, &first, &last);
+	}
+	report(ok, test++, &tests_passed);
+
+	return (test == tests_passed);
+}
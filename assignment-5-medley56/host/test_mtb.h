@@ -0,0 +1,20 @@
+/*
+ * test_mtb.h
+ *
+ * Test functions for the MTB dump decoder
+ */
+
+#ifndef _TEST_MTB_H_
+#define _TEST_MTB_H_
+
+#include <stdbool.h>
+
+/*
+ * Parses well-formed and truncated dumps, decodes wrapped and unwrapped
+ * buffers into packets oldest first, and checks which consecutive
+ * packets make an executed run. Returns true if all tests pass, false
+ * otherwise. Diagnostic information is printed via PRINTF.
+ */
+bool test_mtb();
+
+#endif  // _TEST_MTB_H_
@@ -0,0 +1,122 @@
+/*
+ * test_pbkdf1_many.c
+ *
+ * Test functions for the thread-pool PBKDF1
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "fsl_debug_console.h"
+#include "test_pbkdf1_many.h"
+#include "pbkdf1_test.h"
+#include "isha.h"
+#include "pbkdf1.h"
+#include "pbkdf1_many.h"
+
+#define NUM_JOBS  61
+
+/*
+ * Runs NUM_JOBS jobs with mixed iteration counts (including an invalid
+ * count of 0) through pool and compares every slot against pbkdf1
+ */
+static bool check_batch(pbkdf1_pool_t *pool, int round) {
+	static const char *passwords[] = { "password", "Boulder", "", "hunter2" };
+	static const char *salts[] = { "mysalt", "Buffaloes", "NaCl" };
+	const uint8_t *p[NUM_JOBS], *s[NUM_JOBS];
+	size_t pLen[NUM_JOBS], sLen[NUM_JOBS];
+	uint32_t c[NUM_JOBS];
+	error_t status[NUM_JOBS];
+	uint8_t act_dk[NUM_JOBS * ISHA_DIGESTLEN];
+	uint8_t exp_dk[ISHA_DIGESTLEN];
+	bool any_invalid = false;
+	error_t ret;
+
+	for (int j = 0; j < NUM_JOBS; j++) {
+		p[j] = (const uint8_t *) passwords[j % 4];
+		s[j] = (const uint8_t *) salts[(j + round) % 3];
+		pLen[j] = strlen(passwords[j % 4]);
+		sLen[j] = strlen(salts[(j + round) % 3]);
+		// A few long jobs among many short ones, so that stealing matters
+		c[j] = (j % 10 == 0) ? 20000 : (uint32_t) (j * 37 + round) % 500;
+		any_invalid |= (c[j] == 0);
+		status[j] = ERROR_FAILURE;
+	}
+
+	ret = pbkdf1_many(pool, p, pLen, s, sLen, c, NUM_JOBS, act_dk,
+			ISHA_DIGESTLEN, status);
+	if (ret != (any_invalid ? ERROR_FAILURE : NO_ERROR)) {
+		return false;
+	}
+
+	for (int j = 0; j < NUM_JOBS; j++) {
+		error_t exp = pbkdf1(p[j], pLen[j], s[j], sLen[j], c[j], exp_dk,
+				ISHA_DIGESTLEN);
+		if (status[j] != exp) {
+			return false;
+		}
+		if (exp == NO_ERROR
+				&& !cmp_bin(act_dk + j * ISHA_DIGESTLEN, exp_dk,
+						ISHA_DIGESTLEN)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+bool test_pbkdf1_many()
+{
+	static const int pool_sizes[] = { 1, 2, 3, 8 };
+	const int num_sizes = sizeof(pool_sizes) / sizeof(pool_sizes[0]);
+	int test = 0;
+	int tests_passed = 0;
+
+	for (int i = 0; i < num_sizes; i++, test++) {
+		pbkdf1_pool_t *pool = pbkdf1_pool_create(pool_sizes[i]);
+		bool ok = (pool != NULL);
+
+		// Several batches back to back on the same pool
+		for (int round = 0; ok && round < 3; round++) {
+			ok = check_batch(pool, round);
+		}
+		pbkdf1_pool_destroy(pool);
+
+		if (ok) {
+			PRINTF("%s test %d (%d threads): success\r\n", __FUNCTION__, test,
+					pool_sizes[i]);
+			tests_passed++;
+		} else {
+			PRINTF("%s test %d (%d threads): FAILURE\r\n", __FUNCTION__, test,
+					pool_sizes[i]);
+		}
+	}
+
+	// Bad parameters and degenerate batches
+	{
+		pbkdf1_pool_t *pool = pbkdf1_pool_create(2);
+		const uint8_t *p[1] = { (const uint8_t *) "password" };
+		const uint8_t *s[1] = { (const uint8_t *) "mysalt" };
+		size_t pLen[1] = { 8 }, sLen[1] = { 6 };
+		uint32_t c[1] = { 2 };
+		error_t status[1];
+		uint8_t dk[32];
+
+		if (pbkdf1_pool_create(0) == NULL
+				&& pbkdf1_many(pool, p, pLen, s, sLen, c, 0, dk, 20, status)
+						== NO_ERROR
+				&& pbkdf1_many(pool, p, pLen, s, sLen, c, 1, NULL, 20, status)
+						== ERROR_INVALID_PARAMETER
+				&& pbkdf1_many(pool, p, pLen, s, sLen, c, 1, dk, 21, status)
+						== ERROR_FAILURE && status[0] == ERROR_INVALID_LENGTH) {
+			PRINTF("%s test %d: success\r\n", __FUNCTION__, test);
+			tests_passed++;
+		} else {
+			PRINTF("%s test %d: FAILURE\r\n", __FUNCTION__, test);
+		}
+		pbkdf1_pool_destroy(pool);
+		test++;
+	}
+
+	return (test == tests_passed);
+}
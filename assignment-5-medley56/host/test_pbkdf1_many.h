@@ -0,0 +1,20 @@
+/*
+ * test_pbkdf1_many.h
+ *
+ * Test functions for the thread-pool PBKDF1
+ */
+
+#ifndef _TEST_PBKDF1_MANY_H_
+#define _TEST_PBKDF1_MANY_H_
+
+#include <stdbool.h>
+
+/*
+ * Checks pbkdf1_many against pbkdf1 for jobs with mixed iteration
+ * counts, on pools of several sizes and over repeated batches. Returns
+ * true if all tests pass, false otherwise. Diagnostic information is
+ * printed via PRINTF.
+ */
+bool test_pbkdf1_many();
+
+#endif  // _TEST_PBKDF1_MANY_H_
@@ -0,0 +1,101 @@
+/*
+ * test_pc_profiler.c
+ *
+ * Test functions for the PC profiler's symbol lookup
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "fsl_debug_console.h"
+#include "test_pc_profiler.h"
+#include "pc_profiler.h"
+
+#define MAX_SYMBOLS  9
+
+/*
+ * Fills table with len functions starting at 0x100. Function k is
+ * 2 * (k + 1) halfwords long and every third one is followed by a gap.
+ *
+ * Returns:
+ *   The end of the last function
+ */
+static uint32_t make_table(pc_symbol_t *table, size_t len) {
+	uint32_t addr = 0x100;
+
+	for (size_t k = 0; k < len; k++) {
+		table[k].start = addr;
+		table[k].end = addr + 4 * (uint32_t) (k + 1);
+		table[k].name = "f";
+		addr = table[k].end + ((k % 3 == 2) ? 6 : 0);
+	}
+	return addr;
+}
+
+static int linear_lookup(const pc_symbol_t *table, size_t len, uint32_t pc) {
+	for (size_t k = 0; k < len; k++) {
+		if (pc >= table[k].start && pc < table[k].end) {
+			return (int) k;
+		}
+	}
+	return -1;
+}
+
+bool test_pc_profiler()
+{
+	pc_symbol_t table[MAX_SYMBOLS] = { 0 };
+	uint32_t counts[MAX_SYMBOLS] = { 0 };
+	int test = 0;
+	int tests_passed = 0;
+
+	// Every address from below the first function to past the last one
+	for (size_t len = 0; len <= MAX_SYMBOLS; len++, test++) {
+		uint32_t last = make_table(table, len);
+		bool ok = true;
+
+		pc_profile_init(table, len, counts);
+		for (uint32_t pc = 0xF0; ok && pc < last + 16; pc++) {
+			ok = (pc_profile_lookup(pc) == linear_lookup(table, len, pc));
+		}
+		ok = ok && (pc_profile_lookup(0) == -1)
+				&& (pc_profile_lookup(UINT32_MAX) == -1);
+
+		if (ok) {
+			PRINTF("%s test %d (%zu symbols): success\r\n", __FUNCTION__, test,
+					len);
+			tests_passed++;
+		} else {
+			PRINTF("%s test %d (%zu symbols): FAILURE\r\n", __FUNCTION__, test,
+					len);
+		}
+	}
+
+	// Histogram and unknown count, then reset
+	{
+		uint32_t total = 0;
+		bool ok;
+
+		make_table(table, MAX_SYMBOLS);
+		pc_profile_init(table, MAX_SYMBOLS, counts);
+		for (uint32_t pc = 0; pc < 0x200; pc += 2) {
+			pc_profile_sample(pc);
+		}
+		for (size_t k = 0; k < MAX_SYMBOLS; k++) {
+			total += counts[k];
+		}
+		ok = (counts[0] == 2) && (counts[8] == 18)
+				&& (total + pc_profile_unknown() == 0x100);
+		pc_profile_reset();
+		ok = ok && (counts[8] == 0) && (pc_profile_unknown() == 0);
+
+		if (ok) {
+			PRINTF("%s test %d: success\r\n", __FUNCTION__, test);
+			tests_passed++;
+		} else {
+			PRINTF("%s test %d: FAILURE\r\n", __FUNCTION__, test);
+		}
+		test++;
+	}
+
+	return (test == tests_passed);
+}
@@ -0,0 +1,21 @@
+/*
+ * test_pc_profiler.h
+ *
+ * Test functions for the PC profiler's symbol lookup
+ */
+
+#ifndef _TEST_PC_PROFILER_H_
+#define _TEST_PC_PROFILER_H_
+
+#include <stdbool.h>
+
+/*
+ * Checks pc_profile_lookup against a linear scan for every address
+ * around tables of 0 to MAX_SYMBOLS functions with gaps between some
+ * of them, and checks the histogram kept by pc_profile_sample. Returns
+ * true if all tests pass, false otherwise. Diagnostic information is
+ * printed via PRINTF.
+ */
+bool test_pc_profiler();
+
+#endif  // _TEST_PC_PROFILER_H_
@@ -0,0 +1,120 @@
+/*
+ * test_static_profiler.c
+ *
+ * Test functions for the static profiler's entry/exit timing
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "fsl_debug_console.h"
+#include "test_static_profiler.h"
+#include "static_profiler.h"
+#include "ticktime.h"
+
+// Fake clock; each test advances it by hand
+static uint32_t fake_now;
+
+static uint32_t fake_clock(void) {
+	return fake_now;
+}
+
+static bool stats_are(profile_id_t id, uint32_t calls, uint64_t cycles,
+		uint64_t selfCycles, uint32_t min, uint32_t max) {
+	const profile_stats_t *s = static_profile_stats(id);
+
+	return s->calls == calls && s->cycles == cycles
+			&& s->selfCycles == selfCycles && s->min == min && s->max == max;
+}
+
+static void report(bool ok, int test, int *tests_passed) {
+	if (ok) {
+		PRINTF("%s test %d: success\r\n", "test_static_profiler", test);
+		(*tests_passed)++;
+	} else {
+		PRINTF("%s test %d: FAILURE\r\n", "test_static_profiler", test);
+	}
+}
+
+bool test_static_profiler()
+{
+	int test = 0;
+	int tests_passed = 0;
+	bool ok;
+
+	static_profile_set_clock(fake_clock);
+
+	// pbkdf1 (100 cycles) calling pbkdf1Start (30), which calls ISHAReset
+	// (5), then pbkdf1Step (50); the clock wraps partway through
+	static_profile_reset();
+	static_profile_on();
+	fake_now = UINT32_MAX - 40;
+	PROFILE_ENTER(pbkdf1);
+	fake_now += 10;
+	PROFILE_ENTER(pbkdf1Start);
+	fake_now += 5;
+	PROFILE_ENTER(ISHAReset);
+	fake_now += 5;
+	PROFILE_EXIT(ISHAReset);
+	fake_now += 20;
+	PROFILE_EXIT(pbkdf1Start);
+	fake_now += 5;
+	PROFILE_ENTER(pbkdf1Step);
+	fake_now += 50;
+	PROFILE_EXIT(pbkdf1Step);
+	fake_now += 5;
+	PROFILE_EXIT(pbkdf1);
+	static_profile_off();
+	ok = stats_are(PROFILE_ID_pbkdf1, 1, 100, 20, 100, 100)
+			&& stats_are(PROFILE_ID_pbkdf1Start, 1, 30, 25, 30, 30)
+			&& stats_are(PROFILE_ID_ISHAReset, 1, 5, 5, 5, 5)
+			&& stats_are(PROFILE_ID_pbkdf1Step, 1, 50, 50, 50, 50);
+	report(ok, test++, &tests_passed);
+
+	// Repeated calls: min, max and mean
+	static_profile_reset();
+	static_profile_on();
+	for (uint32_t k = 1; k <= 4; k++) {
+		PROFILE_ENTER(ISHAInput);
+		fake_now += 10 * k;
+		PROFILE_EXIT(ISHAInput);
+	}
+	static_profile_off();
+	ok = stats_are(PROFILE_ID_ISHAInput, 4, 100, 100, 10, 40);
+	report(ok, test++, &tests_passed);
+
+	// Calls deeper than the stack go untimed, and do not upset the
+	// frames above them. Frame k starts at k - 1 and all end at 10.
+	static_profile_reset();
+	static_profile_on();
+	for (int d = 0; d < STATIC_PROFILE_MAX_DEPTH + 2; d++) {
+		PROFILE_ENTER(ISHAProcessMessageBlock);
+		fake_now += 1;
+	}
+	for (int d = 0; d < STATIC_PROFILE_MAX_DEPTH + 2; d++) {
+		PROFILE_EXIT(ISHAProcessMessageBlock);
+	}
+	static_profile_off();
+	ok = stats_are(PROFILE_ID_ISHAProcessMessageBlock,
+			STATIC_PROFILE_MAX_DEPTH, 3 + 4 + 5 + 6 + 7 + 8 + 9 + 10, 3 + 7, 3,
+			10);
+	report(ok, test++, &tests_passed);
+
+	// An exit whose entry was before static_profile_on() is ignored, as
+	// is everything while the profiler is off
+	static_profile_reset();
+	PROFILE_ENTER(ISHAResult);
+	static_profile_on();
+	PROFILE_ENTER(ISHAPadMessage);
+	fake_now += 7;
+	PROFILE_EXIT(ISHAPadMessage);
+	PROFILE_EXIT(ISHAResult);
+	static_profile_off();
+	ok = stats_are(PROFILE_ID_ISHAPadMessage, 1, 7, 7, 7, 7)
+			&& stats_are(PROFILE_ID_ISHAResult, 0, 0, 0, 0, 0);
+	report(ok, test++, &tests_passed);
+
+	static_profile_reset();
+	static_profile_set_clock(ticktime_cycles);
+	return (test == tests_passed);
+}
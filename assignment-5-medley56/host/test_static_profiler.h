@@ -0,0 +1,20 @@
+/*
+ * test_static_profiler.h
+ *
+ * Test functions for the static profiler's entry/exit timing
+ */
+
+#ifndef _TEST_STATIC_PROFILER_H_
+#define _TEST_STATIC_PROFILER_H_
+
+#include <stdbool.h>
+
+/*
+ * Runs nested, repeated, too-deep and unbalanced PROFILE_ENTER/EXIT
+ * sequences against a fake clock and checks the call counts and the
+ * inclusive, self, min and max cycles. Returns true if all tests pass,
+ * false otherwise. Diagnostic information is printed via PRINTF.
+ */
+bool test_static_profiler();
+
+#endif  // _TEST_STATIC_PROFILER_H_
@@ -0,0 +1,27 @@
+/*
+ * ticktime_host.c
+ *
+ * Host stand-in for the cycle clock of ticktime.c, so that modules
+ * which timestamp with ticktime_cycles() can be built and run
+ * off-target. A "cycle" here is a nanosecond of CLOCK_MONOTONIC.
+ */
+
+#include <stdint.h>
+#include <time.h>
+
+#include "ticktime.h"
+
+uint32_t ticktime_cycles(void) {
+	return (uint32_t) ticktime_cycles64();
+}
+
+uint64_t ticktime_cycles64(void) {
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t) ts.tv_sec * 1000000000u + ts.tv_nsec;
+}
+
+uint64_t ticktime_cycles_to_us(uint64_t cycles) {
+	return cycles / 1000u;
+}
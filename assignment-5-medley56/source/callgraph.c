@@ -0,0 +1,181 @@
+/**
+ * @file callgraph.c
+ * @brief Call-stack sampling profiler for Cortex-M0+ exception frames
+ * @author Gavin Medley
+ */
+
+#include "fsl_debug_console.h"
+#include "callgraph.h"
+
+#define CALLGRAPH_MAX_PROBES  16      // slots tried before an edge is dropped
+#define KL25Z_FLASH_END       0x20000 // code region when pc_symtab is empty
+#define XPSR_STACK_ALIGN      (1u << 9)
+
+bool callgraph_on = false;
+
+static callgraph_config_t config;
+static callgraph_edge_t edges[CALLGRAPH_EDGES];
+static uint32_t samples;
+static uint32_t dropped;
+
+static uint16_t read_memory(uint32_t addr) {
+	return *(const volatile uint16_t*) (uintptr_t) addr;
+}
+
+static uint16_t read_code(uint32_t addr) {
+	return config.readCode ? config.readCode(addr) : read_memory(addr);
+}
+
+/*
+ * Returns true if w looks like a return address: the Thumb bit is set
+ * and the instruction before it is a BL or a BLX
+ */
+static bool is_return_address(uint32_t w) {
+	uint32_t addr = w & ~1u;
+
+	if ((w & 1) == 0 || addr < config.codeStart + 4 || addr >= config.codeEnd) {
+		return false;
+	}
+	// BLX Rm: 0100 0111 1mmm m000
+	if ((read_code(addr - 2) & 0xFF87) == 0x4780) {
+		return true;
+	}
+	// BL: 1111 0xxx xxxx xxxx, 11x1 xxxx xxxx xxxx
+	return (read_code(addr - 4) & 0xF800) == 0xF000
+			&& (read_code(addr - 2) & 0xD000) == 0xD000;
+}
+
+/*
+ * Returns the start of the function containing addr, or addr itself if
+ * there is no symbol for it
+ */
+static uint32_t function_of(uint32_t addr) {
+	int i = pc_symtab_lookup(config.symbols, config.numSymbols, addr);
+
+	return (i < 0) ? addr : config.symbols[i].start;
+}
+
+void callgraph_init(const callgraph_config_t *cfg) {
+	config = *cfg;
+	callgraph_reset();
+}
+
+int callgraph_unwind(const uint32_t *frame, const uint32_t *stackEnd,
+		uint32_t *chain, int max) {
+	const uint32_t *sp = frame + CALLGRAPH_FRAME_WORDS;
+	uint32_t lr = frame[CALLGRAPH_FRAME_LR];
+	int n = 0;
+
+	if (max < 1) {
+		return 0;
+	}
+	// The core inserted a padding word to align the frame
+	if (frame[CALLGRAPH_FRAME_XPSR] & XPSR_STACK_ALIGN) {
+		sp++;
+	}
+
+	chain[n++] = frame[CALLGRAPH_FRAME_PC] & ~1u;
+
+	// LR holds the caller for a leaf. In a function that has already
+	// made calls it points back into the function itself; skip it then.
+	if (n < max && is_return_address(lr)
+			&& function_of(lr & ~1u) != function_of(chain[0])) {
+		chain[n++] = lr & ~1u;
+	}
+
+	for (int k = 0; k < CALLGRAPH_SCAN_WORDS && sp < stackEnd && n < max;
+			k++, sp++) {
+		uint32_t w = *sp;
+
+		if (!is_return_address(w)) {
+			continue;
+		}
+		// The LR taken from the frame is usually also pushed by the
+		// function's prologue
+		if ((w & ~1u) == chain[n - 1]) {
+			continue;
+		}
+		chain[n++] = w & ~1u;
+	}
+
+	return n;
+}
+
+/*
+ * Counts one sample of the edge (site, callee)
+ */
+static void add_edge(uint32_t site, uint32_t callee) {
+	uint32_t h = (site * 0x9E3779B1u) ^ callee;
+
+	h ^= h >> 16;
+	h *= 0x85EBCA6Bu;
+	h ^= h >> 13;
+
+	for (int probe = 0; probe < CALLGRAPH_MAX_PROBES; probe++) {
+		callgraph_edge_t *e = &edges[(h + probe) & (CALLGRAPH_EDGES - 1)];
+
+		if (e->count == 0) {
+			e->site = site;
+			e->callee = callee;
+			e->count = 1;
+			return;
+		}
+		if (e->site == site && e->callee == callee) {
+			e->count++;
+			return;
+		}
+	}
+	dropped++;
+}
+
+void callgraph_sample(const uint32_t *frame, const uint32_t *stackEnd) {
+	uint32_t chain[CALLGRAPH_MAX_DEPTH];
+	int n = callgraph_unwind(frame, stackEnd, chain, CALLGRAPH_MAX_DEPTH);
+
+	samples++;
+	add_edge(0, function_of(chain[0]));
+	for (int i = 1; i < n; i++) {
+		add_edge(chain[i], function_of(chain[i - 1]));
+	}
+}
+
+void callgraph_reset(void) {
+	for (int i = 0; i < CALLGRAPH_EDGES; i++) {
+		edges[i] = (callgraph_edge_t) { 0 };
+	}
+	samples = 0;
+	dropped = 0;
+}
+
+const callgraph_edge_t* callgraph_edges(uint32_t *s, uint32_t *d) {
+	*s = samples;
+	*d = dropped;
+	return edges;
+}
+
+void callgraph_profile_on(void) {
+	callgraph_config_t cfg = { 0, KL25Z_FLASH_END, NULL, pc_symtab,
+			pc_symtab_len };
+
+	if (pc_symtab_len > 0) {
+		cfg.codeStart = pc_symtab[0].start;
+		cfg.codeEnd = pc_symtab[pc_symtab_len - 1].end;
+	}
+	callgraph_init(&cfg);
+	callgraph_on = true;
+}
+
+void callgraph_profile_off(void) {
+	callgraph_on = false;
+}
+
+void print_callgraph(void) {
+	PRINTF("callgraph: %u samples, %u dropped\r\n", samples, dropped);
+	for (int i = 0; i < CALLGRAPH_EDGES; i++) {
+		if (edges[i].count != 0) {
+			PRINTF("edge 0x%08x 0x%08x %u\r\n", edges[i].site, edges[i].callee,
+					edges[i].count);
+		}
+	}
+	PRINTF("end callgraph\r\n");
+}
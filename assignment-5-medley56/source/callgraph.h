@@ -0,0 +1,130 @@
+/**
+ * @file callgraph.h
+ * @brief Call-stack sampling profiler for Cortex-M0+ exception frames
+ * @author Gavin Medley
+ *
+ * Each sample unwinds the interrupted code from its exception frame:
+ * the stacked PC, the stacked LR, then return addresses found by
+ * scanning the stack above the frame. A word counts as a return
+ * address if it has the Thumb bit set, lies in code, and follows a BL
+ * or BLX instruction. Frame pointers are not needed, but stale return
+ * addresses left in uninitialized locals can show up as extra callers.
+ *
+ * Every caller/callee pair on the unwound stack is counted in a hash
+ * table keyed by (call site, callee). The callee is the start of its
+ * function when a symbol table is given; the call site is the return
+ * address, so host/cg_report can name both the calling function and
+ * the line. Samples in the leaf itself are counted with call site 0.
+ */
+
+#ifndef _CALLGRAPH_H_
+#define _CALLGRAPH_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "pc_profiler.h"
+
+#define CALLGRAPH_EDGES       128  // hash table slots; a power of two
+#define CALLGRAPH_MAX_DEPTH   8    // frames kept per sample
+#define CALLGRAPH_SCAN_WORDS  64   // stack words searched per sample
+
+/* Exception frame words, as stacked by the core on exception entry */
+#define CALLGRAPH_FRAME_LR    5
+#define CALLGRAPH_FRAME_PC    6
+#define CALLGRAPH_FRAME_XPSR  7
+#define CALLGRAPH_FRAME_WORDS 8
+
+/*
+ * Reads the halfword of code at addr
+ */
+typedef uint16_t (*callgraph_read_code_t)(uint32_t addr);
+
+/*
+ * Where code lives, how to read it, and the symbols that callees are
+ * bucketed by
+ */
+typedef struct {
+	uint32_t codeStart;
+	uint32_t codeEnd;
+	callgraph_read_code_t readCode;  ///<NULL reads memory directly
+	const pc_symbol_t *symbols;      ///<NULL to keep raw callee addresses
+	size_t numSymbols;
+} callgraph_config_t;
+
+/* One caller/callee pair and the number of samples it was seen in */
+typedef struct {
+	uint32_t site;    ///<Return address in the caller, or 0 for the leaf
+	uint32_t callee;  ///<Function start, or the raw address if unknown
+	uint32_t count;
+} callgraph_edge_t;
+
+/* Flag to indicate if call graph sampling is on */
+extern bool callgraph_on;
+
+/*
+ * Sets up the unwinder and clears the table
+ *
+ * Parameters:
+ *   config  Code region and symbols (in); copied
+ */
+void callgraph_init(const callgraph_config_t *config);
+
+/*
+ * Unwinds the code interrupted by an exception
+ *
+ * Parameters:
+ *   frame      The exception frame (in)
+ *   stackEnd   One past the last word of the stack (in)
+ *   chain      The stacked PC, then return addresses, innermost
+ *              first, Thumb bit cleared (out)
+ *   max        Size of chain
+ *
+ * Returns:
+ *   Number of entries written to chain
+ */
+int callgraph_unwind(const uint32_t *frame, const uint32_t *stackEnd,
+		uint32_t *chain, int max);
+
+/*
+ * Unwinds one sample and counts its edges. Called from SysTick_Handler
+ * while callgraph_on is set.
+ *
+ * Parameters:
+ *   frame      The exception frame (in)
+ *   stackEnd   One past the last word of the stack (in)
+ */
+void callgraph_sample(const uint32_t *frame, const uint32_t *stackEnd);
+
+/*
+ * Clears the table and the sample counts
+ */
+void callgraph_reset(void);
+
+/*
+ * Returns the hash table, CALLGRAPH_EDGES slots; slots with a count of
+ * 0 are empty
+ *
+ * Parameters:
+ *   samples   Number of samples taken (out)
+ *   dropped   Edges not counted because the table was full (out)
+ */
+const callgraph_edge_t* callgraph_edges(uint32_t *samples, uint32_t *dropped);
+
+/*
+ * Turns call graph sampling on, for the code described by pc_symtab
+ */
+void callgraph_profile_on(void);
+
+/*
+ * Turns call graph sampling off
+ */
+void callgraph_profile_off(void);
+
+/*
+ * Prints the table in the format read by host/cg_report
+ */
+void print_callgraph(void);
+
+#endif  // _CALLGRAPH_H_
@@ -0,0 +1,36 @@
+/**
+ * @file hash_algo.c
+ * @brief Hash algorithm descriptors for the KDF layer
+ * @author Gavin Medley
+ */
+
+#include <string.h>
+
+#include "hash_algo.h"
+
+static void ishaInit(void *context) {
+	ISHAReset(context);
+}
+
+static void ishaUpdate(void *context, const void *data, size_t length) {
+	ISHAInput(context, data, length);
+}
+
+static void ishaFinal(void *context, uint8_t *digest) {
+	ISHAResult(context, digest);
+}
+
+static void ishaCopy(void *dest, const void *src) {
+	memcpy(dest, src, sizeof(ISHAContext));
+}
+
+const HashAlgo ishaHashAlgo = {
+	"ISHA",
+	sizeof(ISHAContext),
+	ISHA_BLOCKLEN,
+	ISHA_DIGESTLEN,
+	ishaInit,
+	ishaUpdate,
+	ishaFinal,
+	ishaCopy
+};
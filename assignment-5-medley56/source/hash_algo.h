@@ -0,0 +1,53 @@
+/**
+ * @file hash_algo.h
+ * @brief Hash algorithm descriptors for the KDF layer
+ *
+ * Modeled on the HashAlgo interface of CycloneCRYPTO, so that HMAC and
+ * PBKDF2 can be written once against any hash. ISHA is the only backend
+ * for now.
+ *
+ * @author Gavin Medley
+ */
+
+#ifndef _HASH_ALGO_H
+#define _HASH_ALGO_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "isha.h"
+
+//Largest block, digest and context of any registered hash
+#define MAX_HASH_BLOCK_SIZE  ISHA_BLOCKLEN
+#define MAX_HASH_DIGEST_SIZE ISHA_DIGESTLEN
+
+//Storage large enough for the context of any registered hash
+typedef union {
+	ISHAContext isha;
+} HashContext;
+
+//Hash algorithm operations
+typedef void (*HashAlgoInit)(void *context);
+typedef void (*HashAlgoUpdate)(void *context, const void *data, size_t length);
+typedef void (*HashAlgoFinal)(void *context, uint8_t *digest);
+typedef void (*HashAlgoCopy)(void *dest, const void *src);
+
+/**
+ * @brief Common interface for hash algorithms
+ **/
+
+typedef struct {
+	const char *name;        ///<Algorithm name
+	size_t contextSize;      ///<Size of the algorithm's context, at most sizeof(HashContext)
+	size_t blockSize;        ///<Input block size, in bytes, at most MAX_HASH_BLOCK_SIZE
+	size_t digestSize;       ///<Digest size, in bytes, at most MAX_HASH_DIGEST_SIZE
+	HashAlgoInit init;       ///<Start a new message
+	HashAlgoUpdate update;   ///<Absorb the next part of the message
+	HashAlgoFinal final;     ///<Pad, and write the digest
+	HashAlgoCopy copy;       ///<Clone a context, e.g. a precomputed midstate
+} HashAlgo;
+
+//Hash algorithms
+extern const HashAlgo ishaHashAlgo;
+
+#endif
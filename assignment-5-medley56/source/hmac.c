@@ -0,0 +1,139 @@
+/**
+ * @file hmac.c
+ * @brief HMAC (Keyed-Hashing for Message Authentication), RFC 2104
+ * @author Gavin Medley
+ */
+
+#include <string.h>
+
+#include "hmac.h"
+
+#define HMAC_IPAD 0x36
+#define HMAC_OPAD 0x5C
+
+/**
+ * @brief Initialize HMAC with a key
+ *
+ * Absorbs K ^ ipad and K ^ opad into the inner and outer midstates, and
+ * starts the first MAC. Keys longer than a block are hashed first
+ *
+ * @param[out] context HMAC state
+ * @param[in] hash Underlying hash function
+ * @param[in] key Secret key
+ * @param[in] keyLen Length of the key, in bytes
+ * @return Error code
+ **/
+
+error_t hmacInit(HmacContext *context, const HashAlgo *hash,
+		const void *key, size_t keyLen) {
+	uint8_t block[MAX_HASH_BLOCK_SIZE];
+	size_t i;
+
+	//Check parameters
+	if (context == NULL || hash == NULL || (key == NULL && keyLen != 0))
+		return ERROR_INVALID_PARAMETER;
+	if (hash->blockSize > MAX_HASH_BLOCK_SIZE
+			|| hash->digestSize > MAX_HASH_DIGEST_SIZE
+			|| hash->contextSize > sizeof(HashContext))
+		return ERROR_UNSUPPORTED_HASH_ALGO;
+
+	context->hash = hash;
+
+	//K, zero-padded to a full block
+	memset(block, 0, hash->blockSize);
+	if (keyLen > hash->blockSize) {
+		hash->init(&context->hashContext);
+		hash->update(&context->hashContext, key, keyLen);
+		hash->final(&context->hashContext, block);
+	} else if (keyLen > 0) {
+		memcpy(block, key, keyLen);
+	}
+
+	//Inner midstate: H state after K ^ ipad
+	for (i = 0; i < hash->blockSize; i++)
+		block[i] ^= HMAC_IPAD;
+	hash->init(&context->innerMidstate);
+	hash->update(&context->innerMidstate, block, hash->blockSize);
+
+	//Outer midstate: H state after K ^ opad
+	for (i = 0; i < hash->blockSize; i++)
+		block[i] ^= HMAC_IPAD ^ HMAC_OPAD;
+	hash->init(&context->outerMidstate);
+	hash->update(&context->outerMidstate, block, hash->blockSize);
+
+	memset(block, 0, sizeof(block));
+
+	hmacReset(context);
+
+	//Successful processing
+	return NO_ERROR;
+}
+
+/**
+ * @brief Start a new MAC with the key given to hmacInit()
+ *
+ * @param[in,out] context HMAC state
+ **/
+
+void hmacReset(HmacContext *context) {
+	context->hash->copy(&context->hashContext, &context->innerMidstate);
+}
+
+/**
+ * @brief Absorb the next part of the message
+ *
+ * @param[in,out] context HMAC state
+ * @param[in] data Message bytes
+ * @param[in] length Number of bytes
+ **/
+
+void hmacUpdate(HmacContext *context, const void *data, size_t length) {
+	context->hash->update(&context->hashContext, data, length);
+}
+
+/**
+ * @brief Finish the MAC, and start a new one with the same key
+ *
+ * @param[in,out] context HMAC state
+ * @param[out] digest The MAC, digestSize bytes
+ **/
+
+void hmacFinal(HmacContext *context, uint8_t *digest) {
+	const HashAlgo *hash = context->hash;
+	uint8_t inner[MAX_HASH_DIGEST_SIZE];
+
+	//H((K ^ opad) || H((K ^ ipad) || text))
+	hash->final(&context->hashContext, inner);
+	hash->copy(&context->hashContext, &context->outerMidstate);
+	hash->update(&context->hashContext, inner, hash->digestSize);
+	hash->final(&context->hashContext, digest);
+
+	hmacReset(context);
+}
+
+/**
+ * @brief Compute the HMAC of a message in one call
+ *
+ * @param[in] hash Underlying hash function
+ * @param[in] key Secret key
+ * @param[in] keyLen Length of the key, in bytes
+ * @param[in] data Message
+ * @param[in] dataLen Length of the message, in bytes
+ * @param[out] digest The MAC, hash->digestSize bytes
+ * @return Error code
+ **/
+
+error_t hmacCompute(const HashAlgo *hash, const void *key, size_t keyLen,
+		const void *data, size_t dataLen, uint8_t *digest) {
+	HmacContext context;
+	error_t error;
+
+	error = hmacInit(&context, hash, key, keyLen);
+	if (error)
+		return error;
+
+	hmacUpdate(&context, data, dataLen);
+	hmacFinal(&context, digest);
+
+	return NO_ERROR;
+}
@@ -0,0 +1,43 @@
+/**
+ * @file hmac.h
+ * @brief HMAC (Keyed-Hashing for Message Authentication), RFC 2104
+ *
+ * The inner and outer keyed hash states (after absorbing K ^ ipad and
+ * K ^ opad) are computed once by hmacInit(). Every MAC after that starts
+ * from copies of them, so a MAC over a short message costs two
+ * compressions instead of four.
+ *
+ * @author Gavin Medley
+ */
+
+#ifndef _HMAC_H
+#define _HMAC_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "error.h"
+#include "hash_algo.h"
+
+/**
+ * @brief HMAC state
+ **/
+
+typedef struct {
+	const HashAlgo *hash;       ///<Underlying hash function
+	HashContext innerMidstate;  ///<Hash state after absorbing K ^ ipad
+	HashContext outerMidstate;  ///<Hash state after absorbing K ^ opad
+	HashContext hashContext;    ///<Inner hash of the MAC in progress
+} HmacContext;
+
+//HMAC related functions
+error_t hmacInit(HmacContext *context, const HashAlgo *hash,
+		const void *key, size_t keyLen);
+void hmacReset(HmacContext *context);
+void hmacUpdate(HmacContext *context, const void *data, size_t length);
+void hmacFinal(HmacContext *context, uint8_t *digest);
+
+error_t hmacCompute(const HashAlgo *hash, const void *key, size_t keyLen,
+		const void *data, size_t dataLen, uint8_t *digest);
+
+#endif
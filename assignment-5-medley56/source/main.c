@@ -1,138 +1,218 @@
-/*
- * PBKDF1.c
- *
- * Application entry point, and test timing.
- * 
- */
-
-#include <stdio.h>
-#include <stdlib.h>
-#include <assert.h>
-#include <pc_profiler.h>
-#include <string.h>
-
-#include "board.h"
-#include "peripherals.h"
-#include "pin_mux.h"
-#include "clock_config.h"
-#include "MKL25Z4.h"
-#include "fsl_debug_console.h"
-
-#include "pbkdf1.h"
-#include "pbkdf1_test.h"
-#include "ticktime.h"
-
-#include "static_profiler.h"
-
-/*
- * Times a single call to the pbkdf1 function, and prints
- * the resulting duration.
- *
- * Parameters:
- *     print_time - Boolean flag to indicate if the time duration should be printed.
- */
-static void time_pbkdf1(bool print_time) {
-	const char *pass = "Boulder";
-	const char *salt = "Buffaloes";
-	int iterations = 4096;
-	size_t dk_len = 20;
-	int passlen, saltlen;
-	uint8_t act_result[512];
-	uint8_t exp_result[512];
-
-	const char *exp_result_hex = "E9C8B4E075D3BB7652204AD6CBBE19B44051EFB4";
-
-	ticktime_t duration = 0;
-
-	assert(dk_len <= sizeof(act_result));
-
-	hexstr_to_bytes(exp_result, exp_result_hex, dk_len);
-	passlen = strlen(pass);
-	saltlen = strlen(salt);
-
-	reset_timer();
-	error_t err = pbkdf1((const uint8_t*) pass, passlen, (const uint8_t*) salt,
-			saltlen, iterations, act_result, dk_len);
-	duration = get_timer();
-
-	if ((err == NO_ERROR) && cmp_bin(act_result, exp_result, dk_len)) {
-		if (print_time) {
-			PRINTF("%s: %u iterations took %u msec\r\n", __FUNCTION__,
-					iterations, duration);
-		} else {
-			PRINTF("%s: %u iterations complete\r\n", __FUNCTION__, iterations,
-					duration);
-		}
-	} else {
-		if (print_time) {
-			PRINTF("FAILURE on timed test duration=%u msec\r\n", duration);
-		} else {
-			PRINTF("FAILURE on tests.\r\n", duration);
-		}
-	}
-}
-
-/*
- * Run all the validity checks; exit on failure
- */
-static void run_tests() {
-	bool success = true;
-
-	success &= test_isha();
-	success &= test_pbkdf1();
-
-	if (success)
-		return;
-
-	PRINTF("TEST FAILURES EXIST ... exiting\r\n");
-
-	exit(-1);
-}
-
-/*
- * Application entry point.
- */
-int main(void) {
-
-	/* Init board hardware. */
-	BOARD_InitBootPins();
-	BOARD_InitBootClocks();
-	BOARD_InitBootPeripherals();
-#ifndef BOARD_INIT_DEBUG_CONSOLE_PERIPHERAL
-	BOARD_InitDebugConsole();
-#endif
-
-	init_ticktime();
-
-	PRINTF("Running validity tests...\r\n");
-	run_tests();
-	PRINTF("All tests passed!\r\n");
-
-	//Time test section 1 for reporting and comparing time.
-	PRINTF("Running timing test...Report this time.\r\n");
-	time_pbkdf1(true);
-	PRINTF("Done with timing test...\r\n");
-
-	//Time test section 2 for profiling with static profiling.
-	PRINTF("Running call count test with static profiling....\r\n");
-	static_profile_on();
-	time_pbkdf1(false);
-	static_profile_off();
-	print_static_profiler_summary();
-	PRINTF("Done with call count test with static profiling....\r\n");
-
-	//Time test section 3 for profiling with PC.
-	// Note: The PC profiler requires all profiled functions to already
-	// have been run in order to capture their end locations in memory.
-	// This is OK in this case because we have already run
-	// tests that fully exercised the relevant functions.
-	PRINTF("Running call count test with PC profiling....\r\n");
-	pc_profile_on();
-	time_pbkdf1(false);
-	pc_profile_off();
-	print_pc_profiler_summary();
-	PRINTF("Done with call count test with PC profiling....\r\n");
-
-	return 0;
-}
-
+/*
+ * PBKDF1.c
+ *
+ * Application entry point, and test timing.
+ * 
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+#include <pc_profiler.h>
+#include "callgraph.h"
+#include <string.h>
+
+#include "board.h"
+#include "peripherals.h"
+#include "pin_mux.h"
+#include "clock_config.h"
+#include "MKL25Z4.h"
+#include "fsl_debug_console.h"
+
+#include "pbkdf1.h"
+#include "pbkdf1_test.h"
+#include "ticktime.h"
+
+#include "static_profiler.h"
+#include "mtb_dump.h"
+
+#define MTB_TRACE_RUNS     8     // MTB dumps taken in section 5
+#define MTB_TRACE_SPACING  107   // ticks between their stop points; all 8
+                                 // fall inside the ~94 msec derivation
+
+/*
+ * Times a single call to the pbkdf1 function, and prints
+ * the resulting duration.
+ *
+ * Parameters:
+ *     print_time - Boolean flag to indicate if the time duration should be printed.
+ */
+static void time_pbkdf1(bool print_time) {
+	const char *pass = "Boulder";
+	const char *salt = "Buffaloes";
+	int iterations = 4096;
+	size_t dk_len = 20;
+	int passlen, saltlen;
+	uint8_t act_result[512];
+	uint8_t exp_result[512];
+
+	const char *exp_result_hex = "E9C8B4E075D3BB7652204AD6CBBE19B44051EFB4";
+
+	ticktime_t duration = 0;
+
+	assert(dk_len <= sizeof(act_result));
+
+	hexstr_to_bytes(exp_result, exp_result_hex, dk_len);
+	passlen = strlen(pass);
+	saltlen = strlen(salt);
+
+	reset_timer();
+	error_t err = pbkdf1((const uint8_t*) pass, passlen, (const uint8_t*) salt,
+			saltlen, iterations, act_result, dk_len);
+	duration = get_timer();
+
+	if ((err == NO_ERROR) && cmp_bin(act_result, exp_result, dk_len)) {
+		if (print_time) {
+			PRINTF("%s: %u iterations took %u msec\r\n", __FUNCTION__,
+					iterations, duration);
+		} else {
+			PRINTF("%s: %u iterations complete\r\n", __FUNCTION__, iterations,
+					duration);
+		}
+	} else {
+		if (print_time) {
+			PRINTF("FAILURE on timed test duration=%u msec\r\n", duration);
+		} else {
+			PRINTF("FAILURE on tests.\r\n", duration);
+		}
+	}
+}
+
+/*
+ * Times the same derivation as time_pbkdf1, run through the incremental
+ * API in slices the way a cooperative main loop would, and prints the
+ * resulting duration. The difference from time_pbkdf1 is the cost of
+ * slicing.
+ *
+ * Parameters:
+ *     slice - Number of iterations per pbkdf1Step call.
+ */
+static void time_pbkdf1_sliced(uint32_t slice) {
+	const char *pass = "Boulder";
+	const char *salt = "Buffaloes";
+	uint32_t iterations = 4096;
+	size_t dk_len = 20;
+	uint8_t act_result[20];
+	uint8_t exp_result[20];
+	uint32_t steps = 0;
+	Pbkdf1Context ctx;
+
+	const char *exp_result_hex = "E9C8B4E075D3BB7652204AD6CBBE19B44051EFB4";
+
+	ticktime_t duration = 0;
+
+	hexstr_to_bytes(exp_result, exp_result_hex, dk_len);
+
+	reset_timer();
+	error_t err = pbkdf1Start(&ctx, (const uint8_t*) pass, strlen(pass),
+			(const uint8_t*) salt, strlen(salt), iterations, act_result, dk_len);
+	while (err == NO_ERROR || err == ERROR_IN_PROGRESS) {
+		// Other main loop work would run between the steps
+		err = pbkdf1Step(&ctx, slice);
+		steps++;
+		if (err == NO_ERROR)
+			break;
+	}
+	duration = get_timer();
+
+	if ((err == NO_ERROR) && cmp_bin(act_result, exp_result, dk_len)) {
+		PRINTF("%s: %u iterations in %u steps of %u took %u msec\r\n",
+				__FUNCTION__, iterations, steps, slice, duration);
+	} else {
+		PRINTF("FAILURE on sliced timed test duration=%u msec\r\n", duration);
+	}
+}
+
+/*
+ * Run all the validity checks; exit on failure
+ */
+static void run_tests() {
+	bool success = true;
+
+	success &= test_isha();
+	success &= test_pbkdf1();
+	success &= test_pbkdf1_sliced();
+	success &= test_pbkdf1_cache();
+	success &= test_hmac();
+	success &= test_pbkdf2();
+
+	if (success)
+		return;
+
+	PRINTF("TEST FAILURES EXIST ... exiting\r\n");
+
+	exit(-1);
+}
+
+/*
+ * Application entry point.
+ */
+int main(void) {
+
+	/* Init board hardware. */
+	BOARD_InitBootPins();
+	BOARD_InitBootClocks();
+	BOARD_InitBootPeripherals();
+#ifndef BOARD_INIT_DEBUG_CONSOLE_PERIPHERAL
+	BOARD_InitDebugConsole();
+#endif
+
+	init_ticktime();
+
+	PRINTF("Running validity tests...\r\n");
+	run_tests();
+	PRINTF("All tests passed!\r\n");
+
+	//Time test section 1 for reporting and comparing time.
+	PRINTF("Running timing test...Report this time.\r\n");
+	time_pbkdf1(true);
+	PRINTF("Done with timing test...\r\n");
+
+	//Time test section 1b: cost of running the same derivation in slices
+	PRINTF("Running sliced timing test...\r\n");
+	time_pbkdf1_sliced(1);
+	time_pbkdf1_sliced(16);
+	time_pbkdf1_sliced(256);
+	PRINTF("Done with sliced timing test...\r\n");
+
+	//Time test section 2 for profiling with static profiling.
+	PRINTF("Running call count test with static profiling....\r\n");
+	static_profile_on();
+	time_pbkdf1(false);
+	static_profile_off();
+	print_static_profiler_summary();
+	PRINTF("Done with call count test with static profiling....\r\n");
+
+	//Time test section 3 for profiling with PC.
+	// Note: Samples are bucketed by the function table in pc_symtab.c,
+	// which has to be regenerated from this build's .axf (see README).
+	PRINTF("Running call count test with PC profiling....\r\n");
+	pc_profile_on();
+	time_pbkdf1(false);
+	pc_profile_off();
+	print_pc_profiler_summary();
+	PRINTF("Done with call count test with PC profiling....\r\n");
+
+	//Time test section 4 for call graph sampling. The output is read by
+	// host/cg_report.
+	PRINTF("Running call graph sampling test....\r\n");
+	callgraph_profile_on();
+	time_pbkdf1(false);
+	callgraph_profile_off();
+	print_callgraph();
+	PRINTF("Done with call graph sampling test....\r\n");
+
+	//Time test section 5 for MTB traces. Each run freezes the trace a
+	// different number of ticks in, so that the dumps sample different
+	// points of the derivation; host/mtb_decode -s merges them.
+	PRINTF("Running MTB trace test....\r\n");
+	for (uint32_t ticks = 1; ticks <= MTB_TRACE_RUNS; ticks++) {
+		mtb_stop_after(ticks * MTB_TRACE_SPACING);
+		time_pbkdf1(false);
+		mtb_dump();
+	}
+	PRINTF("Done with MTB trace test....\r\n");
+
+	return 0;
+}
+
@@ -0,0 +1,91 @@
+/**
+ * @file monotonic.h
+ * @brief 64-bit monotonic cycle clock from a periodic down-counter
+ * @author Gavin Medley
+ *
+ * The time is the number of counter overflows, kept by the tick
+ * interrupt, times the period, plus how far the counter has counted
+ * down since it last reloaded. This gives counter-clock resolution
+ * (one core cycle for SysTick on the core clock) at any interrupt rate,
+ * so the tick rate can be as low as the application allows.
+ *
+ * The counter is read through accessor functions, so the same code
+ * runs against SysTick on the board and a simulated counter on the
+ * host.
+ */
+
+#ifndef _MONOTONIC_H_
+#define _MONOTONIC_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+ * Returns the current value of the down-counter, period - 1 .. 0
+ */
+typedef uint32_t (*monotonic_read_counter_t)(void);
+
+/*
+ * Returns true if the counter has reloaded since the last
+ * monotonic_tick(), i.e. the tick interrupt is pending
+ */
+typedef bool (*monotonic_wrap_pending_t)(void);
+
+typedef struct {
+	volatile uint64_t overflows;  ///<Reloads counted by monotonic_tick()
+	uint32_t period;              ///<Counts per reload, LOAD + 1 for SysTick
+	uint32_t hz;                  ///<Counter frequency
+	monotonic_read_counter_t readCounter;
+	monotonic_wrap_pending_t wrapPending;
+} monotonic_clock_t;
+
+/*
+ * Sets up a clock at time 0. Call it right after the counter has been
+ * (re)started from period - 1.
+ *
+ * Parameters:
+ *   clock         The clock (out)
+ *   period        Counts per reload
+ *   hz            Counter frequency
+ *   readCounter   Reads the counter
+ *   wrapPending   Reads the pending flag of the tick interrupt
+ */
+void monotonic_init(monotonic_clock_t *clock, uint32_t period, uint32_t hz,
+		monotonic_read_counter_t readCounter,
+		monotonic_wrap_pending_t wrapPending);
+
+/*
+ * Counts one reload. Call it from the tick interrupt.
+ */
+static inline void monotonic_tick(monotonic_clock_t *clock) {
+	clock->overflows++;
+}
+
+/*
+ * Returns counter clocks since monotonic_init(). Safe to call from
+ * thread mode and from interrupts; a reload whose tick interrupt has
+ * not run yet is counted. Only wrong if interrupts are masked for a
+ * whole period or more.
+ */
+uint64_t monotonic_now(const monotonic_clock_t *clock);
+
+/*
+ * Returns the low 32 bits of monotonic_now(), more cheaply. For
+ * differences of readings less than 2^32 clocks apart.
+ */
+uint32_t monotonic_now32(const monotonic_clock_t *clock);
+
+/*
+ * Convert a number of counter clocks to ns, us or ms, rounding down,
+ * without overflowing for any count the clock can reach
+ */
+uint64_t monotonic_to_ns(const monotonic_clock_t *clock, uint64_t cycles);
+uint64_t monotonic_to_us(const monotonic_clock_t *clock, uint64_t cycles);
+uint64_t monotonic_to_ms(const monotonic_clock_t *clock, uint64_t cycles);
+
+/*
+ * Converts a duration in us to counter clocks, rounding down
+ */
+uint64_t monotonic_from_us(const monotonic_clock_t *clock, uint64_t us);
+
+#endif  // _MONOTONIC_H_
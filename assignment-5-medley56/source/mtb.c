@@ -55,10 +55,9 @@
 #if !defined (__MTB_DISABLE)
 
   // Allow for MTB buffer size being set by define set via command line
-  // Otherwise provide small default buffer
-  #if !defined (__MTB_BUFFER_SIZE)
-    #define __MTB_BUFFER_SIZE 128
-  #endif
+  // Otherwise use the default from mtb_dump.h, which also sizes the
+  // MTB_MASTER mask and the dump
+  #include "mtb_dump.h"
   
   // Check that buffer size requested is >0 bytes in size
   #if (__MTB_BUFFER_SIZE > 0)
@@ -0,0 +1,65 @@
+/**
+ * @file mtb_dump.c
+ * @brief Start, stop and dump the Micro Trace Buffer over the console
+ * @author Gavin Medley
+ */
+
+#include "MKL25Z4.h"
+#include "fsl_debug_console.h"
+#include "mtb_dump.h"
+
+static volatile uint32_t stop_countdown;  // 0 when no stop is requested
+
+/*
+ * Returns MTB_MASTER_MASK for the buffer: the buffer is 2^(MASK + 4)
+ * bytes, and the pointer wraps within it
+ */
+static uint32_t master_mask(void) {
+	uint32_t mask = 0;
+
+	while ((16u << mask) < __MTB_BUFFER_SIZE) {
+		mask++;
+	}
+	return mask;
+}
+
+void mtb_start(void) {
+	stop_countdown = 0;
+	MTB->MASTER = 0;
+	MTB->FLOW = 0;      // no watermark: keep overwriting the oldest packets
+	MTB->POSITION = 0;  // start of the buffer, not wrapped
+	MTB->MASTER = MTB_MASTER_EN_MASK | MTB_MASTER_MASK(master_mask());
+}
+
+void mtb_stop(void) {
+	MTB->MASTER &= ~MTB_MASTER_EN_MASK;
+}
+
+void mtb_stop_after(uint32_t ticks) {
+	mtb_start();
+	stop_countdown = ticks;
+}
+
+void mtb_tick(void) {
+	if (stop_countdown != 0 && --stop_countdown == 0) {
+		mtb_stop();
+	}
+}
+
+void mtb_dump(void) {
+	uint32_t position;
+	const uint32_t *buffer;
+
+	stop_countdown = 0;
+	mtb_stop();  // so that printing is not traced over the capture
+	position = MTB->POSITION;
+	buffer = (const uint32_t*) (uintptr_t) (MTB->BASE
+			+ (position & MTB_POSITION_POINTER_MASK & ~(__MTB_BUFFER_SIZE - 1u)));
+
+	PRINTF("mtb: base 0x%08x size %u position 0x%08x\r\n", (uint32_t) (uintptr_t) buffer,
+			__MTB_BUFFER_SIZE, position);
+	for (int i = 0; i < __MTB_BUFFER_SIZE / 4; i += MTB_PACKET_BYTES / 4) {
+		PRINTF("0x%08x 0x%08x\r\n", buffer[i], buffer[i + 1]);
+	}
+	PRINTF("end mtb\r\n");
+}
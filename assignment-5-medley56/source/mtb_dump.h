@@ -0,0 +1,64 @@
+/**
+ * @file mtb_dump.h
+ * @brief Start, stop and dump the Micro Trace Buffer over the console
+ * @author Gavin Medley
+ *
+ * While enabled, the MTB writes an 8-byte packet to a RAM buffer for
+ * every non-sequential change of the PC: the source of the branch, then
+ * its destination. The buffer is reserved by mtb.c at the start of the
+ * default RAM bank, which is where MTB_POSITION points when it is 0.
+ *
+ * mtb_dump() prints the buffer in the format read by host/mtb_decode,
+ * which orders the packets and symbolizes them with the nm output of
+ * the build:
+ *
+ *   mtb: base 0x1ffff000 size 1024 position 0x00000128
+ *   0x00000e1b 0x00000e00
+ *   ...one line per packet, in buffer order
+ *   end mtb
+ */
+
+#ifndef _MTB_DUMP_H_
+#define _MTB_DUMP_H_
+
+#include <stdint.h>
+
+/* Trace buffer size in bytes: a power of 2, at least 16. mtb.c
+ * reserves it; set __MTB_BUFFER_SIZE on the command line to change it. */
+#if !defined (__MTB_BUFFER_SIZE)
+#define __MTB_BUFFER_SIZE 1024
+#endif
+
+#define MTB_PACKET_BYTES 8
+
+/*
+ * Empties the buffer and starts tracing
+ */
+void mtb_start(void);
+
+/*
+ * Stops tracing; the buffer keeps the last packets
+ */
+void mtb_stop(void);
+
+/*
+ * Starts tracing and has SysTick stop it after the given number of
+ * ticks, so the buffer holds whatever ran just before that interrupt
+ *
+ * Parameters:
+ *   ticks   Ticks to trace for, at least 1
+ */
+void mtb_stop_after(uint32_t ticks);
+
+/*
+ * Counts down a stop requested by mtb_stop_after(). Called from
+ * SysTick_Handler.
+ */
+void mtb_tick(void);
+
+/*
+ * Stops tracing and prints the buffer for host/mtb_decode
+ */
+void mtb_dump(void);
+
+#endif  // _MTB_DUMP_H_
@@ -36,6 +36,11 @@
 #include <string.h>
 #include "pbkdf1.h"
 #include "isha.h"
+#include "hmac.h"
+#include "static_profiler.h"
+
+//PBKDF2 OID (1.2.840.113549.1.5.12)
+const uint8_t PBKDF2_OID[9] = {0x2A, 0x86, 0x48, 0x86, 0xF7, 0x0D, 0x01, 0x05, 0x0C};
 
 /**
  * @brief PBKDF1 key derivation function
@@ -56,12 +61,46 @@
 
 error_t pbkdf1(const uint8_t *p, size_t pLen, const uint8_t *s, size_t sLen,
 		uint32_t c, uint8_t *dk, size_t dkLen) {
-	uint32_t i;
+	error_t error;
+	Pbkdf1Context context;
+
+	PROFILE_ENTER(pbkdf1);
+
+	//Compute T(1), then iterate to T(c) in a single step
+	error = pbkdf1Start(&context, p, pLen, s, sLen, c, dk, dkLen);
+	if (!error)
+		error = pbkdf1Step(&context, context.remaining);
+
+	PROFILE_EXIT(pbkdf1);
+	return error;
+}
+
+
+/**
+ * @brief Start an incremental PBKDF1 derivation
+ *
+ * Checks the parameters and computes T(1) = Hash(P || S). The remaining
+ * c - 1 iterations are applied by pbkdf1Step() or pbkdf1StepUntil(), so
+ * that a long derivation can be interleaved with other work
+ *
+ * @param[out] context Caller-owned PBKDF1 state
+ * @param[in] p Password, an octet string
+ * @param[in] pLen Length in octets of password
+ * @param[in] s Salt, an octet string
+ * @param[in] sLen Length in octets of salt
+ * @param[in] c Iteration count
+ * @param[out] dk Derived key, written when the derivation completes
+ * @param[in] dkLen Intended length in octets of the derived key
+ * @return Error code
+ **/
+
+error_t pbkdf1Start(Pbkdf1Context *context, const uint8_t *p, size_t pLen,
+		const uint8_t *s, size_t sLen, uint32_t c, uint8_t *dk, size_t dkLen) {
 	uint8_t t[ISHA_DIGESTLEN];
-	ISHAContext *hashContext = (ISHAContext*) malloc(sizeof(ISHAContext));
+	ISHAContext hashContext;
 
 	//Check parameters
-	if (p == NULL || s == NULL || dk == NULL)
+	if (context == NULL || p == NULL || s == NULL || dk == NULL)
 		return ERROR_INVALID_PARAMETER;
 
 	//The iteration count must be a positive integer
@@ -72,25 +111,198 @@ error_t pbkdf1(const uint8_t *p, size_t pLen, const uint8_t *s, size_t sLen,
 	if (dkLen > ISHA_DIGESTLEN)
 		return ERROR_INVALID_LENGTH;
 
+	PROFILE_ENTER(pbkdf1Start);
+
 	//Apply the hash function to the concatenation of P and S
-	ISHAReset(hashContext);
-	ISHAInput(hashContext, p, pLen);
-	ISHAInput(hashContext, s, sLen);
-	ISHAResult(hashContext, t);
-
-	//Iterate as many times as required
-	for (i = 1; i < c; i++) {
-		//Apply the hash function to T(i - 1)
-		ISHAReset(hashContext);
-		ISHAInput(hashContext, t, ISHA_DIGESTLEN);
-		ISHAResult(hashContext, t);
+	ISHAReset(&hashContext);
+	ISHAInput(&hashContext, p, pLen);
+	ISHAInput(&hashContext, s, sLen);
+	ISHAResult(&hashContext, t);
+
+	memcpy(context->md, hashContext.MD, sizeof(context->md));
+	context->remaining = c - 1;
+	context->dk = dk;
+	context->dkLen = dkLen;
+
+	PROFILE_EXIT(pbkdf1Start);
+
+	//Successful processing
+	return NO_ERROR;
+}
+
+
+/**
+ * @brief Apply up to maxIterations of an incremental PBKDF1 derivation
+ *
+ * When the last iteration has been applied, the derived key is written
+ * to the dk buffer given to pbkdf1Start()
+ *
+ * @param[in,out] context PBKDF1 state from pbkdf1Start()
+ * @param[in] maxIterations Largest number of iterations to apply now
+ * @return NO_ERROR once the derived key is ready, ERROR_IN_PROGRESS if
+ *   iterations remain
+ **/
+
+error_t pbkdf1Step(Pbkdf1Context *context, uint32_t maxIterations) {
+	uint32_t n;
+	size_t i;
+
+	//Check parameters
+	if (context == NULL)
+		return ERROR_INVALID_PARAMETER;
+
+	PROFILE_ENTER(pbkdf1Step);
+
+	//Each iteration is a single compression on the digest words, since
+	//T(i - 1) is always exactly one digest long
+	n = (context->remaining < maxIterations) ? context->remaining :
+			maxIterations;
+	ISHAIterateDigest(context->md, n);
+	context->remaining -= n;
+
+	if (context->remaining > 0) {
+		PROFILE_EXIT(pbkdf1Step);
+		return ERROR_IN_PROGRESS;
+	}
+
+	//Output the derived key DK (the digest words are big-endian)
+	for (i = 0; i < context->dkLen; i++) {
+		context->dk[i] = (uint8_t) (context->md[i / 4] >> (24 - 8 * (i % 4)));
 	}
 
-	//Output the derived key DK
-	memcpy(dk, t, dkLen);
+	PROFILE_EXIT(pbkdf1Step);
+
+	//Successful processing
+	return NO_ERROR;
+}
+
+
+/**
+ * @brief Run an incremental PBKDF1 derivation until a deadline
+ *
+ * Applies iterations in chunks, checking the clock between chunks, until
+ * the derivation completes or the deadline has been reached. The call
+ * may overrun the deadline by the time taken for one chunk
+ *
+ * @param[in,out] context PBKDF1 state from pbkdf1Start()
+ * @param[in] clock Function returning the current time, in ticks
+ * @param[in] deadline Time at which to return, in the units of clock
+ * @param[in] chunk Iterations applied between reads of the clock
+ * @return NO_ERROR once the derived key is ready, ERROR_IN_PROGRESS if
+ *   iterations remain
+ **/
+
+error_t pbkdf1StepUntil(Pbkdf1Context *context, Pbkdf1ClockFunc clock,
+		uint32_t deadline, uint32_t chunk) {
+	error_t error;
+
+	//Check parameters
+	if (context == NULL || clock == NULL || chunk < 1)
+		return ERROR_INVALID_PARAMETER;
+
+	//Always make progress, even if called after the deadline. The signed
+	//difference keeps the comparison correct when the clock wraps
+	do {
+		error = pbkdf1Step(context, chunk);
+	} while (error == ERROR_IN_PROGRESS && (int32_t) (clock() - deadline) < 0);
 
-	//Free previously allocated memory
-	free(hashContext);
+	return error;
+}
+
+
+/**
+ * @brief Check whether an incremental PBKDF1 derivation has completed
+ *
+ * @param[in] context PBKDF1 state from pbkdf1Start()
+ * @return NO_ERROR if the derived key is ready, ERROR_IN_PROGRESS if
+ *   iterations remain
+ **/
+
+error_t pbkdf1Poll(const Pbkdf1Context *context) {
+	//Check parameters
+	if (context == NULL)
+		return ERROR_INVALID_PARAMETER;
+
+	return (context->remaining > 0) ? ERROR_IN_PROGRESS : NO_ERROR;
+}
+
+
+/**
+ * @brief PBKDF2 key derivation function
+ *
+ * PBKDF2 applies a pseudorandom function, HMAC over the given hash, to
+ * derive keys. The length of the derived key is essentially unbounded.
+ *
+ * The HMAC key (the password) is the same for every iteration, so its
+ * ipad/opad hash states are computed once and cloned, and each iteration
+ * costs two compressions rather than four
+ *
+ * @param[in] hash Underlying hash function
+ * @param[in] p Password, an octet string
+ * @param[in] pLen Length in octets of password
+ * @param[in] s Salt, an octet string
+ * @param[in] sLen Length in octets of salt
+ * @param[in] c Iteration count
+ * @param[out] dk Derived key
+ * @param[in] dkLen Intended length in octets of the derived key
+ * @return Error code
+ **/
+
+error_t pbkdf2(const HashAlgo *hash, const uint8_t *p, size_t pLen,
+		const uint8_t *s, size_t sLen, uint32_t c, uint8_t *dk, size_t dkLen) {
+	error_t error;
+	size_t i;
+	size_t n;
+	uint32_t j;
+	uint32_t blockIndex;
+	uint8_t a[4];
+	uint8_t u[MAX_HASH_DIGEST_SIZE];
+	uint8_t t[MAX_HASH_DIGEST_SIZE];
+	HmacContext hmacContext;
+
+	//Check parameters
+	if (hash == NULL || p == NULL || s == NULL || dk == NULL)
+		return ERROR_INVALID_PARAMETER;
+
+	//The iteration count must be a positive integer
+	if (c < 1)
+		return ERROR_INVALID_PARAMETER;
+
+	//Precompute the keyed midstates
+	error = hmacInit(&hmacContext, hash, p, pLen);
+	if (error)
+		return error;
+
+	//For each block of the derived key apply the function F
+	for (blockIndex = 1; dkLen > 0; blockIndex++) {
+		//INT (i), a four-octet encoding of the integer i, MSB first
+		a[0] = (blockIndex >> 24) & 0xFF;
+		a[1] = (blockIndex >> 16) & 0xFF;
+		a[2] = (blockIndex >> 8) & 0xFF;
+		a[3] = blockIndex & 0xFF;
+
+		//U1 = PRF (P, S || INT (i))
+		hmacUpdate(&hmacContext, s, sLen);
+		hmacUpdate(&hmacContext, a, sizeof(a));
+		hmacFinal(&hmacContext, u);
+		memcpy(t, u, hash->digestSize);
+
+		//Uj = PRF (P, U{j-1}), and T = U1 ^ U2 ^ ... ^ Uc
+		for (j = 1; j < c; j++) {
+			hmacUpdate(&hmacContext, u, hash->digestSize);
+			hmacFinal(&hmacContext, u);
+
+			for (i = 0; i < hash->digestSize; i++)
+				t[i] ^= u[i];
+		}
+
+		//Save the resulting block
+		n = (dkLen < hash->digestSize) ? dkLen : hash->digestSize;
+		memcpy(dk, t, n);
+
+		dk += n;
+		dkLen -= n;
+	}
 
 	//Successful processing
 	return NO_ERROR;
@@ -0,0 +1,184 @@
+/**
+ * @file pbkdf1_cache.c
+ * @brief Iteration-checkpoint cache for PBKDF1
+ * @author Gavin Medley
+ */
+
+#include <string.h>
+
+#include "pbkdf1_cache.h"
+#include "pbkdf1.h"
+
+/*
+ * Finds the entry for T(1), or claims the least recently used one for it
+ *
+ * Returns:
+ *   The entry; *found tells whether it already held T(1)
+ */
+static Pbkdf1CacheEntry* find_entry(Pbkdf1Cache *cache,
+		const uint32_t t1[ISHA_DIGESTWORDS], bool *found) {
+	Pbkdf1CacheEntry *victim = &cache->entries[0];
+
+	cache->clock++;
+	for (int i = 0; i < PBKDF1_CACHE_ENTRIES; i++) {
+		Pbkdf1CacheEntry *e = &cache->entries[i];
+		if (e->valid && memcmp(e->t1, t1, sizeof(e->t1)) == 0) {
+			e->lastUse = cache->clock;
+			*found = true;
+			return e;
+		}
+		if (!e->valid) {
+			victim = e;
+		} else if (victim->valid && e->lastUse < victim->lastUse) {
+			victim = e;
+		}
+	}
+
+	memset(victim, 0, sizeof(*victim));
+	victim->valid = true;
+	victim->lastUse = cache->clock;
+	memcpy(victim->t1, t1, sizeof(victim->t1));
+	*found = false;
+	return victim;
+}
+
+/*
+ * Returns the checkpoint with the highest iteration count at or below
+ * c, or NULL if there is none
+ */
+static const Pbkdf1Checkpoint* best_checkpoint(const Pbkdf1CacheEntry *e,
+		uint32_t c) {
+	const Pbkdf1Checkpoint *best = NULL;
+
+	for (uint32_t k = 0; k < e->numCheckpoints; k++) {
+		if (e->checkpoints[k].iteration > c) {
+			break;
+		}
+		best = &e->checkpoints[k];
+	}
+	return best;
+}
+
+/*
+ * Records T(iteration). When the entry is full, the checkpoint that sits
+ * closest to the one below it (or to T(1)) is dropped, which keeps the
+ * remaining checkpoints spread out over the chain. The highest one is
+ * never dropped.
+ */
+static void add_checkpoint(Pbkdf1CacheEntry *e, uint32_t iteration,
+		const uint32_t md[ISHA_DIGESTWORDS]) {
+	uint32_t k = 0;
+	uint32_t drop = 0;
+	uint32_t smallest_gap = UINT32_MAX;
+
+	while (k < e->numCheckpoints && e->checkpoints[k].iteration < iteration) {
+		k++;
+	}
+	if (k < e->numCheckpoints && e->checkpoints[k].iteration == iteration) {
+		return;
+	}
+
+	if (e->numCheckpoints == PBKDF1_CACHE_CHECKPOINTS) {
+		// Iterations of the existing checkpoints with the new one merged in
+		// at position k, then the gap below each of them
+		uint32_t its[PBKDF1_CACHE_CHECKPOINTS + 1];
+
+		for (uint32_t j = 0; j < k; j++) {
+			its[j] = e->checkpoints[j].iteration;
+		}
+		its[k] = iteration;
+		for (uint32_t j = k; j < PBKDF1_CACHE_CHECKPOINTS; j++) {
+			its[j + 1] = e->checkpoints[j].iteration;
+		}
+
+		// The highest checkpoint is always kept, since increasing iteration
+		// counts resume from it
+		for (uint32_t j = 0; j < PBKDF1_CACHE_CHECKPOINTS; j++) {
+			uint32_t gap = its[j] - ((j == 0) ? 1 : its[j - 1]);
+			if (gap < smallest_gap) {
+				smallest_gap = gap;
+				drop = j;
+			}
+		}
+
+		if (drop == k) {
+			return;  // the new checkpoint is the least useful one
+		}
+		if (drop < k) {
+			memmove(&e->checkpoints[drop], &e->checkpoints[drop + 1],
+					(k - 1 - drop) * sizeof(e->checkpoints[0]));
+			k--;
+		} else {
+			memmove(&e->checkpoints[k + 1], &e->checkpoints[k],
+					(drop - 1 - k) * sizeof(e->checkpoints[0]));
+		}
+	} else {
+		memmove(&e->checkpoints[k + 1], &e->checkpoints[k],
+				(e->numCheckpoints - k) * sizeof(e->checkpoints[0]));
+		e->numCheckpoints++;
+	}
+
+	e->checkpoints[k].iteration = iteration;
+	memcpy(e->checkpoints[k].md, md, sizeof(e->checkpoints[k].md));
+}
+
+void pbkdf1CacheClear(Pbkdf1Cache *cache) {
+	// volatile so the wipe of key material is not optimized away
+	volatile uint8_t *bytes = (volatile uint8_t*) cache;
+
+	for (size_t i = 0; i < sizeof(*cache); i++) {
+		bytes[i] = 0;
+	}
+}
+
+error_t pbkdf1Cached(Pbkdf1Cache *cache, const uint8_t *p, size_t pLen,
+		const uint8_t *s, size_t sLen, uint32_t c, uint8_t *dk, size_t dkLen) {
+	Pbkdf1Context ctx;
+	Pbkdf1CacheEntry *e;
+	const Pbkdf1Checkpoint *cp;
+	uint32_t at = 1;  // ctx.md holds T(at)
+	bool found;
+	error_t err;
+
+	if (cache == NULL) {
+		return ERROR_INVALID_PARAMETER;
+	}
+
+	err = pbkdf1Start(&ctx, p, pLen, s, sLen, c, dk, dkLen);
+	if (err != NO_ERROR) {
+		return err;
+	}
+
+	e = find_entry(cache, ctx.md, &found);
+	cp = found ? best_checkpoint(e, c) : NULL;
+	if (cp != NULL) {
+		memcpy(ctx.md, cp->md, sizeof(ctx.md));
+		at = cp->iteration;
+		ctx.remaining = c - at;
+		cache->stats.hits++;
+		cache->stats.iterationsSaved += at - 1;
+	} else {
+		cache->stats.misses++;
+	}
+	cache->stats.iterationsRun += ctx.remaining;
+
+	// Step to each interval boundary on the way to c, leaving a checkpoint
+	// at each one and at c itself
+	do {
+		uint32_t step = PBKDF1_CACHE_INTERVAL - (at % PBKDF1_CACHE_INTERVAL);
+		if (step > c - at) {
+			step = c - at;
+		}
+		err = pbkdf1Step(&ctx, step);
+		at += step;
+		if (at > 1) {
+			add_checkpoint(e, at, ctx.md);
+		}
+	} while (err == ERROR_IN_PROGRESS);
+
+	return err;
+}
+
+const Pbkdf1CacheStats* pbkdf1CacheGetStats(const Pbkdf1Cache *cache) {
+	return &cache->stats;
+}
@@ -0,0 +1,92 @@
+/**
+ * @file pbkdf1_cache.h
+ * @brief Iteration-checkpoint cache for PBKDF1
+ *
+ * PBKDF1 is a pure chain, T(i) = Hash(T(i - 1)) starting from
+ * T(1) = Hash(P || S), so any T(i) can be resumed from. The cache keeps
+ * T at a few checkpoints per (password, salt), and a request for c
+ * iterations resumes from the highest checkpoint at or below c.
+ *
+ * Entries are keyed by T(1) itself: two (P, S) pairs with the same T(1)
+ * have the same chain. Checkpoints are key material, so the cache should
+ * be cleared with pbkdf1CacheClear() once it is no longer needed.
+ *
+ * @author Gavin Medley
+ */
+
+#ifndef _PBKDF1_CACHE_H
+#define _PBKDF1_CACHE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "error.h"
+#include "isha.h"
+
+#ifndef PBKDF1_CACHE_ENTRIES
+#define PBKDF1_CACHE_ENTRIES 4       // (password, salt) pairs kept, least recently used evicted
+#endif
+
+#ifndef PBKDF1_CACHE_CHECKPOINTS
+#define PBKDF1_CACHE_CHECKPOINTS 8   // checkpoints kept per pair
+#endif
+
+#ifndef PBKDF1_CACHE_INTERVAL
+#define PBKDF1_CACHE_INTERVAL 1024   // a derivation leaves a checkpoint every this many iterations
+#endif
+
+typedef struct {
+	uint32_t iteration;             // i
+	uint32_t md[ISHA_DIGESTWORDS];  // T(i), as digest words
+} Pbkdf1Checkpoint;
+
+typedef struct {
+	bool valid;
+	uint32_t lastUse;               // cache clock value at last lookup
+	uint32_t t1[ISHA_DIGESTWORDS];  // T(1), the key of this entry
+	uint32_t numCheckpoints;
+	Pbkdf1Checkpoint checkpoints[PBKDF1_CACHE_CHECKPOINTS];  // sorted by iteration
+} Pbkdf1CacheEntry;
+
+typedef struct {
+	uint32_t hits;             // derivations resumed from a checkpoint
+	uint32_t misses;           // derivations started from T(1)
+	uint64_t iterationsSaved;  // iterations skipped thanks to checkpoints
+	uint64_t iterationsRun;    // iterations actually computed
+} Pbkdf1CacheStats;
+
+typedef struct {
+	Pbkdf1CacheEntry entries[PBKDF1_CACHE_ENTRIES];
+	uint32_t clock;
+	Pbkdf1CacheStats stats;
+} Pbkdf1Cache;
+
+/*
+ * Empties the cache, wiping all checkpoints, and zeroes the statistics
+ *
+ * Parameters:
+ *   cache   The cache (out)
+ */
+void pbkdf1CacheClear(Pbkdf1Cache *cache);
+
+/*
+ * Derives a key exactly as pbkdf1() does, resuming from and adding to
+ * the checkpoints in the cache
+ *
+ * Parameters:
+ *   cache   The cache (in/out)
+ *   p, pLen, s, sLen, c, dk, dkLen   As for pbkdf1()
+ *
+ * Returns:
+ *   The same error codes as pbkdf1()
+ */
+error_t pbkdf1Cached(Pbkdf1Cache *cache, const uint8_t *p, size_t pLen,
+		const uint8_t *s, size_t sLen, uint32_t c, uint8_t *dk, size_t dkLen);
+
+/*
+ * Returns the hit/miss statistics since the last pbkdf1CacheClear()
+ */
+const Pbkdf1CacheStats* pbkdf1CacheGetStats(const Pbkdf1Cache *cache);
+
+#endif  // _PBKDF1_CACHE_H
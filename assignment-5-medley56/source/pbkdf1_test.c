@@ -16,6 +16,8 @@
 
 #include "isha.h"
 #include "pbkdf1.h"
+#include "pbkdf1_cache.h"
+#include "hmac.h"
 
 
 /* 
@@ -159,7 +161,32 @@ bool test_isha()
     }
   }
 
-  return (num_tests*2 == tests_passed);
+  // Third time through: Deliver data in digest-sized chunks, which
+  // ISHAInput copies in whole, at every offset within the block
+  for (int i=0; i<num_tests; i++) {
+    const unsigned char *data = (const unsigned char *)tests[i].msg;
+    msglen = strlen(tests[i].msg);
+    hexstr_to_bytes(exp_digest, tests[i].hexdigest, ISHA_DIGESTLEN);
+
+    ISHAReset(&ctx);
+    while (msglen > 0) {
+      int bytes_this_pass = min(ISHA_DIGESTLEN, msglen);
+      ISHAInput(&ctx, data, bytes_this_pass);
+      msglen -= bytes_this_pass;
+      data += bytes_this_pass;
+    }
+
+    ISHAResult(&ctx, act_digest);
+
+    if (cmp_bin(act_digest, exp_digest, ISHA_DIGESTLEN)) {
+      PRINTF("%s test %d: success\r\n", __FUNCTION__, i + 2*num_tests);
+      tests_passed++;
+    } else {
+      PRINTF("%s test %d: FAILURE\r\n", __FUNCTION__, i + 2*num_tests);
+    }
+  }
+
+  return (num_tests*3 == tests_passed);
 }
 
 
@@ -226,3 +253,363 @@ bool test_pbkdf1()
   return (num_tests == tests_passed);
 }
 
+
+/*
+ * Fake clock for pbkdf1StepUntil: advances one tick per read
+ */
+static uint32_t fake_ticks;
+
+static uint32_t fake_clock(void)
+{
+  return fake_ticks++;
+}
+
+
+/*
+ * Tests the incremental pbkdf1Start/pbkdf1Step/pbkdf1StepUntil/pbkdf1Poll
+ * API. Returns true if all tests pass, false otherwise. Diagnostic
+ * information is printed via PRINTF.
+ */
+bool test_pbkdf1_sliced()
+{
+  typedef struct {
+    const char *pass;
+    const char *salt;
+    uint32_t iterations;
+    uint32_t slice;  // iterations per pbkdf1Step call
+    const char *hex_result;
+  } test_matrix_t;
+
+  test_matrix_t tests[] =
+    { {"password", "mysalt", 1, 1, "7801FCB5B83564125D46C1371D4D1A8FE76EFCE2"},
+      {"password", "mysalt", 2, 1, "B78FFB10683380215A1592113339AAFBA84699CF"},
+      {"password", "mysalt", 3, 1, "4D498330A2A342B2E846E212D938EA132F2E7F7C"},
+      {"password", "mysalt", 100, 1, "C9C355F2BAC4DA6F97A1288069A28274557D51D3"},
+      {"password", "mysalt", 100, 7, "C9C355F2BAC4DA6F97A1288069A28274557D51D3"},
+      {"password", "mysalt", 100, 99, "C9C355F2BAC4DA6F97A1288069A28274557D51D3"},
+      {"password", "mysalt", 100, 1000, "C9C355F2BAC4DA6F97A1288069A28274557D51D3"},
+      {"Boulder", "Buffaloes", 4096, 64, "E9C8B4E075D3BB7652204AD6CBBE19B44051EFB4"}
+    };
+  const int num_tests = sizeof(tests) / sizeof(test_matrix_t);
+  int tests_passed = 0;
+  uint8_t exp_result[ISHA_DIGESTLEN];
+  uint8_t act_result[ISHA_DIGESTLEN];
+  Pbkdf1Context ctx;
+  error_t ret;
+
+  for (int i=0; i<num_tests; i++) {
+    uint32_t steps = 0;
+    uint32_t exp_steps = (tests[i].iterations - 1 + tests[i].slice - 1) / tests[i].slice;
+    bool ok;
+
+    hexstr_to_bytes(exp_result, tests[i].hex_result, ISHA_DIGESTLEN);
+    memset(act_result, 0, sizeof(act_result));
+
+    ret = pbkdf1Start(&ctx, (const uint8_t *)tests[i].pass, strlen(tests[i].pass),
+        (const uint8_t *)tests[i].salt, strlen(tests[i].salt), tests[i].iterations,
+        act_result, ISHA_DIGESTLEN);
+    ok = (ret == NO_ERROR);
+
+    // Step until done; the key must only appear on the final step
+    do {
+      ret = pbkdf1Step(&ctx, tests[i].slice);
+      steps++;
+      if (ret == ERROR_IN_PROGRESS && pbkdf1Poll(&ctx) != ERROR_IN_PROGRESS)
+        ok = false;
+    } while (ok && ret == ERROR_IN_PROGRESS);
+
+    ok = ok && (ret == NO_ERROR) && (pbkdf1Poll(&ctx) == NO_ERROR) &&
+      (steps == (exp_steps ? exp_steps : 1)) && cmp_bin(act_result, exp_result, ISHA_DIGESTLEN);
+
+    if (ok) {
+      PRINTF("%s test %d: success\r\n", __FUNCTION__, i);
+      tests_passed++;
+    } else {
+      PRINTF("%s test %d: FAILURE\r\n", __FUNCTION__, i);
+    }
+  }
+
+  // Deadline-bounded stepping: the fake clock advances one tick per
+  // read and is checked after each chunk, so each call runs exactly 5
+  // chunks of 100 iterations (4095 iterations -> 9 calls)
+  {
+    const char *exp_hex = "E9C8B4E075D3BB7652204AD6CBBE19B44051EFB4";
+    uint32_t calls = 0;
+
+    hexstr_to_bytes(exp_result, exp_hex, ISHA_DIGESTLEN);
+    ret = pbkdf1Start(&ctx, (const uint8_t *)"Boulder", 7,
+        (const uint8_t *)"Buffaloes", 9, 4096, act_result, ISHA_DIGESTLEN);
+    while (ret == NO_ERROR || ret == ERROR_IN_PROGRESS) {
+      fake_ticks = 0;
+      ret = pbkdf1StepUntil(&ctx, fake_clock, 4, 100);
+      calls++;
+      if (ret == NO_ERROR)
+        break;
+    }
+
+    if (ret == NO_ERROR && calls == 9 && cmp_bin(act_result, exp_result, ISHA_DIGESTLEN)) {
+      PRINTF("%s test %d: success\r\n", __FUNCTION__, num_tests);
+      tests_passed++;
+    } else {
+      PRINTF("%s test %d: FAILURE\r\n", __FUNCTION__, num_tests);
+    }
+  }
+
+  // Bad parameters are rejected by pbkdf1Start, as by pbkdf1
+  if (pbkdf1Start(&ctx, (const uint8_t *)"p", 1, (const uint8_t *)"s", 1, 0,
+                  act_result, ISHA_DIGESTLEN) == ERROR_INVALID_PARAMETER &&
+      pbkdf1Start(&ctx, (const uint8_t *)"p", 1, (const uint8_t *)"s", 1, 1,
+                  act_result, ISHA_DIGESTLEN + 1) == ERROR_INVALID_LENGTH &&
+      pbkdf1Start(NULL, (const uint8_t *)"p", 1, (const uint8_t *)"s", 1, 1,
+                  act_result, ISHA_DIGESTLEN) == ERROR_INVALID_PARAMETER) {
+    PRINTF("%s test %d: success\r\n", __FUNCTION__, num_tests + 1);
+    tests_passed++;
+  } else {
+    PRINTF("%s test %d: FAILURE\r\n", __FUNCTION__, num_tests + 1);
+  }
+
+  return (num_tests + 2 == tests_passed);
+}
+
+
+/*
+ * Tests pbkdf1Cached: results must always match pbkdf1, and the
+ * statistics must show checkpoints being used. Returns true if all
+ * tests pass, false otherwise. Diagnostic information is printed via
+ * PRINTF.
+ */
+bool test_pbkdf1_cache()
+{
+  typedef struct {
+    uint32_t iterations;
+    bool hit;
+    uint32_t saved;  // iterations expected to be skipped
+  } test_matrix_t;
+
+  // One (password, salt) pair, in this order; checkpoints fall every
+  // PBKDF1_CACHE_INTERVAL iterations and at each c requested
+  test_matrix_t tests[] =
+    { {100, false, 0},
+      {200, true, 99},
+      {150, true, 99},
+      {100, true, 99},
+      {1, false, 0},
+      {5000, true, 199},
+      {3000, true, 2 * PBKDF1_CACHE_INTERVAL - 1},
+      {5001, true, 4999}
+    };
+  const int num_tests = sizeof(tests) / sizeof(test_matrix_t);
+  static const char *passwords[] = {"password", "Boulder", "", "hunter2", "swordfish", "letmein"};
+  static const char *salts[] = {"mysalt", "Buffaloes"};
+  static Pbkdf1Cache cache;
+  int tests_passed = 0;
+  uint8_t exp_result[ISHA_DIGESTLEN];
+  uint8_t act_result[ISHA_DIGESTLEN];
+  error_t exp_ret, act_ret;
+
+  pbkdf1CacheClear(&cache);
+
+  for (int i=0; i<num_tests; i++) {
+    Pbkdf1CacheStats before = *pbkdf1CacheGetStats(&cache);
+    const Pbkdf1CacheStats *after;
+
+    pbkdf1((const uint8_t *)"Boulder", 7, (const uint8_t *)"Buffaloes", 9,
+           tests[i].iterations, exp_result, ISHA_DIGESTLEN);
+    act_ret = pbkdf1Cached(&cache, (const uint8_t *)"Boulder", 7,
+                           (const uint8_t *)"Buffaloes", 9, tests[i].iterations,
+                           act_result, ISHA_DIGESTLEN);
+    after = pbkdf1CacheGetStats(&cache);
+
+    if (act_ret == NO_ERROR && cmp_bin(act_result, exp_result, ISHA_DIGESTLEN) &&
+        after->hits == before.hits + tests[i].hit &&
+        after->misses == before.misses + !tests[i].hit &&
+        after->iterationsSaved == before.iterationsSaved + tests[i].saved) {
+      PRINTF("%s test %d: success\r\n", __FUNCTION__, i);
+      tests_passed++;
+    } else {
+      PRINTF("%s test %d: FAILURE\r\n", __FUNCTION__, i);
+    }
+  }
+
+  // More (password, salt) pairs than entries, in a scrambled order of
+  // iteration counts, so that entries and checkpoints get evicted
+  {
+    bool ok = true;
+    uint32_t lcg = 12345;
+
+    for (int i=0; ok && i<40; i++) {
+      int pass = i % 6;
+      int salt = (i / 6) % 2;
+      uint32_t c;
+
+      lcg = lcg * 1103515245 + 12345;
+      c = 1 + (lcg >> 16) % 3000;
+
+      exp_ret = pbkdf1((const uint8_t *)passwords[pass], strlen(passwords[pass]),
+                       (const uint8_t *)salts[salt], strlen(salts[salt]), c,
+                       exp_result, 16);
+      act_ret = pbkdf1Cached(&cache, (const uint8_t *)passwords[pass], strlen(passwords[pass]),
+                             (const uint8_t *)salts[salt], strlen(salts[salt]), c,
+                             act_result, 16);
+      ok = (act_ret == exp_ret) && cmp_bin(act_result, exp_result, 16);
+    }
+
+    if (ok && pbkdf1CacheGetStats(&cache)->hits > 0) {
+      PRINTF("%s test %d: success\r\n", __FUNCTION__, num_tests);
+      tests_passed++;
+    } else {
+      PRINTF("%s test %d: FAILURE\r\n", __FUNCTION__, num_tests);
+    }
+  }
+
+  // Errors are the same as pbkdf1, and clearing forgets everything
+  act_ret = pbkdf1Cached(&cache, (const uint8_t *)"Boulder", 7,
+                         (const uint8_t *)"Buffaloes", 9, 0, act_result, ISHA_DIGESTLEN);
+  pbkdf1CacheClear(&cache);
+  if (act_ret == ERROR_INVALID_PARAMETER &&
+      pbkdf1Cached(&cache, (const uint8_t *)"Boulder", 7, (const uint8_t *)"Buffaloes", 9,
+                   21, act_result, ISHA_DIGESTLEN + 1) == ERROR_INVALID_LENGTH &&
+      pbkdf1Cached(&cache, (const uint8_t *)"Boulder", 7, (const uint8_t *)"Buffaloes", 9,
+                   100, act_result, ISHA_DIGESTLEN) == NO_ERROR &&
+      pbkdf1CacheGetStats(&cache)->misses == 1 && pbkdf1CacheGetStats(&cache)->hits == 0) {
+    PRINTF("%s test %d: success\r\n", __FUNCTION__, num_tests + 1);
+    tests_passed++;
+  } else {
+    PRINTF("%s test %d: FAILURE\r\n", __FUNCTION__, num_tests + 1);
+  }
+
+  pbkdf1CacheClear(&cache);
+  return (num_tests + 2 == tests_passed);
+}
+
+
+/*
+ * Tests HMAC-ISHA, with both the one-shot hmacCompute and a context
+ * reused for several messages. Returns true if all tests pass, false
+ * otherwise. Diagnostic information is printed via PRINTF.
+ */
+bool test_hmac()
+{
+  typedef struct {
+    const char *key;
+    size_t key_len;
+    const char *msg;
+    const char *hexdigest;
+  } test_matrix_t;
+
+  test_matrix_t tests[] =
+    { {"key", 3, "The quick brown fox jumps over the lazy dog",
+       "0FB9636B4068331C96D5D9D80D1686D620EA201A"},
+      {"", 0, "", "EF32DA2712AD85E75E8C639F73217709ECD1BA68"},
+      {"\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b", 20,
+       "Hi There", "CEA1FEE1D827B0AF2EC232CE7450A23BA35F7328"},
+      // Longer than a block, so the key is hashed first
+      {"\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa"
+       "\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa"
+       "\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa"
+       "\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa", 80,
+       "Test Using Larger Than Block-Size Key - Hash Key First",
+       "1AEFDDE9526C518B75742662FE73A4945DDA84CF"}
+    };
+  const int num_tests = sizeof(tests) / sizeof(test_matrix_t);
+  int tests_passed = 0;
+  uint8_t exp_digest[ISHA_DIGESTLEN];
+  uint8_t act_digest[ISHA_DIGESTLEN];
+  HmacContext ctx;
+
+  for (int i=0; i<num_tests; i++) {
+    bool ok;
+
+    hexstr_to_bytes(exp_digest, tests[i].hexdigest, ISHA_DIGESTLEN);
+
+    ok = hmacCompute(&ishaHashAlgo, tests[i].key, tests[i].key_len, tests[i].msg,
+                     strlen(tests[i].msg), act_digest) == NO_ERROR &&
+      cmp_bin(act_digest, exp_digest, ISHA_DIGESTLEN);
+
+    // The same MAC twice from one context, starting from the cloned
+    // midstates the second time
+    ok = ok && hmacInit(&ctx, &ishaHashAlgo, tests[i].key, tests[i].key_len) == NO_ERROR;
+    for (int pass=0; ok && pass<2; pass++) {
+      hmacUpdate(&ctx, tests[i].msg, strlen(tests[i].msg));
+      hmacFinal(&ctx, act_digest);
+      ok = cmp_bin(act_digest, exp_digest, ISHA_DIGESTLEN);
+    }
+
+    if (ok) {
+      PRINTF("%s test %d: success\r\n", __FUNCTION__, i);
+      tests_passed++;
+    } else {
+      PRINTF("%s test %d: FAILURE\r\n", __FUNCTION__, i);
+    }
+  }
+
+  return (num_tests == tests_passed);
+}
+
+
+/*
+ * Tests PBKDF2-HMAC-ISHA. Returns true if all tests pass, false
+ * otherwise. Diagnostic information is printed via PRINTF.
+ */
+bool test_pbkdf2()
+{
+  typedef struct {
+    const char *pass;
+    size_t pass_len;
+    const char *salt;
+    size_t salt_len;
+    uint32_t iterations;
+    size_t dk_len;
+    const char *hex_result;  // expected result, as a hex string
+  } test_matrix_t;
+
+  test_matrix_t tests[] =
+    { {"password", 8, "salt", 4, 1, 20, "FB0F3A9FEC80530CA75F718E4AC2B2EC368A0140"},
+      {"password", 8, "salt", 4, 2, 20, "D192FABB2E02E662FEA3352A076A23B97BEA0CB5"},
+      {"password", 8, "salt", 4, 4096, 20, "A1D5A69BFBE3741A52A7E604F48FA46DCBDF8406"},
+      {"passwordPASSWORDpassword", 24, "saltSALTsaltSALTsaltSALTsaltSALTsalt", 36, 4096, 25,
+       "060C3A689EBE30EC4C9A20661DF9C46AE34BD8B616C4B73D04"},
+      {"pass\0word", 9, "sa\0lt", 5, 4096, 16, "949A7AF0A55E0F1D85B3BC39E13E896A"},
+      {"Boulder", 7, "Buffaloes", 9, 1000, 40,
+       "DC43EF7EB392B7C9F0E3BDA7CC017CAE150C2A2D5C1975BAD43EFEB025C9ED7FABBB89767E8AD870"}
+    };
+  const int num_tests = sizeof(tests) / sizeof(test_matrix_t);
+  int tests_passed = 0;
+  uint8_t exp_result[64];
+  uint8_t act_result[64];
+  // A digest too big for the buffers HMAC and PBKDF2 keep on the stack
+  HashAlgo wide = ishaHashAlgo;
+
+  wide.digestSize = MAX_HASH_DIGEST_SIZE + 1;
+
+  for (int i=0; i<num_tests; i++) {
+    assert(tests[i].dk_len <= sizeof(exp_result));
+    hexstr_to_bytes(exp_result, tests[i].hex_result, tests[i].dk_len);
+
+    error_t ret = pbkdf2(&ishaHashAlgo, (const uint8_t *)tests[i].pass, tests[i].pass_len,
+        (const uint8_t *)tests[i].salt, tests[i].salt_len, tests[i].iterations,
+        act_result, tests[i].dk_len);
+
+    if (ret == NO_ERROR && cmp_bin(act_result, exp_result, tests[i].dk_len)) {
+      PRINTF("%s test %d: success\r\n", __FUNCTION__, i);
+      tests_passed++;
+    } else {
+      PRINTF("%s test %d: FAILURE\r\n", __FUNCTION__, i);
+    }
+  }
+
+  // Bad parameters
+  if (pbkdf2(&ishaHashAlgo, (const uint8_t *)"p", 1, (const uint8_t *)"s", 1, 0,
+             act_result, 20) == ERROR_INVALID_PARAMETER &&
+      pbkdf2(NULL, (const uint8_t *)"p", 1, (const uint8_t *)"s", 1, 1,
+             act_result, 20) == ERROR_INVALID_PARAMETER &&
+      pbkdf2(&wide, (const uint8_t *)"p", 1, (const uint8_t *)"s", 1, 1,
+             act_result, 20) == ERROR_UNSUPPORTED_HASH_ALGO) {
+    PRINTF("%s test %d: success\r\n", __FUNCTION__, num_tests);
+    tests_passed++;
+  } else {
+    PRINTF("%s test %d: FAILURE\r\n", __FUNCTION__, num_tests);
+  }
+
+  return (num_tests + 1 == tests_passed);
+}
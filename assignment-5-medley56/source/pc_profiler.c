@@ -1,131 +1,155 @@
-/*
- * profiler.c
- *
- *  Created on: Aug 2, 2023
- *      Author: lpandit
- */
-
-#include "MKL25Z4.h"
-#include "fsl_debug_console.h"
-#include "pc_profiler.h"
-#include "isha.h"
-
-bool pc_profiling_on = false;
-
-// Count variables for counting systick events that occur in each function of interest
-uint32_t ISHAProcessMessageBlockCountPC, ISHAPadMessageCountPC,
-		ISHAResetCountPC, ISHAInputCountPC, ISHAResultCountPC;
-uint32_t UnknownCountPC;
-
-// Struct type that stores the start and end address for a function
-typedef struct {
-	uint32_t start;
-	uint32_t end;
-} AddressRange;
-
-// Struct to store the address range for each function of interest
-AddressRange ISHAProcessMessageBlockAddr, ISHAPadMessageAddr, ISHAResetAddr,
-		ISHAInputAddr, ISHAResultAddr;
-
-/*
- * Store the address ranges for each of the functions of interest so
- * that we don't have to call GetFunctionAddress on every systick IRQ
- */
-void store_pc_ranges(void) {
-	PRINTF("Storing address ranges for each function of interest...\r\n");
-	uint32_t start, end;
-	GetFunctionAddress("ISHAProcessMessageBlock", &start, &end);
-	ISHAProcessMessageBlockAddr = (AddressRange ) { start, end };
-	PRINTF("ISHAProcessMessageBlock start=%u, end=%u\r\n",
-			ISHAProcessMessageBlockAddr.start, ISHAProcessMessageBlockAddr.end);
-	GetFunctionAddress("ISHAPadMessage", &start, &end);
-	ISHAPadMessageAddr = (AddressRange ) { start, end };
-	PRINTF("ISHAPadMessage start=%u, end=%u\r\n", ISHAPadMessageAddr.start,
-			ISHAPadMessageAddr.end);
-	GetFunctionAddress("ISHAReset", &start, &end);
-	ISHAResetAddr = (AddressRange ) { start, end };
-	PRINTF("ISHAReset start=%u, end=%u\r\n", ISHAResetAddr.start,
-			ISHAResetAddr.end);
-	GetFunctionAddress("ISHAInput", &start, &end);
-	ISHAInputAddr = (AddressRange ) { start, end };
-	PRINTF("ISHAInput start=%u, end=%u\r\n", ISHAInputAddr.start,
-			ISHAInputAddr.end);
-	GetFunctionAddress("ISHAResult", &start, &end);
-	ISHAResultAddr = (AddressRange ) { start, end };
-	PRINTF("ISHAResult start=%u, end=%u\r\n", ISHAResultAddr.start,
-			ISHAResultAddr.end);
-}
-
-/*
- * Check the given PC value and determine which function it likely
- * belongs to.
- *
- * Parameters
- *   pc - Pointer to a uint32_t that stores a PC value.
- */
-void pc_profile_check(uint32_t *pc) {
-	// Compare pc value to the range of addresses for each function in the ISHA module
-	//PRINTF("%u\r\n", *pc);
-	if (*pc >= ISHAProcessMessageBlockAddr.start
-			&& *pc < ISHAProcessMessageBlockAddr.end) {
-		ISHAProcessMessageBlockCountPC++;
-		return;
-	}
-
-	if (*pc >= ISHAPadMessageAddr.start && *pc < ISHAPadMessageAddr.end) {
-		ISHAPadMessageCountPC++;
-		return;
-	}
-
-	if (*pc >= ISHAResetAddr.start && *pc < ISHAResetAddr.end) {
-		ISHAResetCountPC++;
-		return;
-	}
-
-	if (*pc >= ISHAInputAddr.start && *pc < ISHAInputAddr.end) {
-		ISHAInputCountPC++;
-		return;
-	}
-
-	if (*pc >= ISHAResultAddr.start && *pc < ISHAResultAddr.end) {
-		ISHAResultCountPC++;
-		return;
-	}
-
-	// If our PC doesn't match any of the relevant function address ranges,
-	// increment the unknown state counter
-	UnknownCountPC++;
-}
-
-/*
- * Turn the profiler on for call counting.
- */
-void pc_profile_on(void) {
-	// Store the start and end locations for each function once
-	store_pc_ranges();
-	pc_profiling_on = true;
-}
-
-/*
- * Turn the profiler off for call counting.
- */
-void pc_profile_off(void) {
-	pc_profiling_on = false;
-}
-
-/*
- * Print a summary of profiler calls for following functions.
- *
- */
-void print_pc_profiler_summary(void) {
-	PRINTF("PC profiling results (Call count indicates the number of PC samples taken in the function):\r\n");
-	PRINTF("Function: ISHAProcessMessageBlock    Call count: %u\r\n",
-			ISHAProcessMessageBlockCountPC);
-	PRINTF("Function: ISHAPadMessage             Call count: %u\r\n", ISHAPadMessageCountPC);
-	PRINTF("Function: ISHAReset                  Call count: %u\r\n", ISHAResetCountPC);
-	PRINTF("Function: ISHAInput                  Call count: %u\r\n", ISHAInputCountPC);
-	PRINTF("Function: ISHAResult                 Call count: %u\r\n", ISHAResultCountPC);
-	PRINTF("Function: Unknown                    Call count: %u\r\n", UnknownCountPC);
-	PRINTF("End of PC profiling results\r\n");
-}
-
+/*
+ * profiler.c
+ *
+ *  Created on: Aug 2, 2023
+ *      Author: lpandit
+ */
+
+#include <string.h>
+
+#include "fsl_debug_console.h"
+#include "pc_profiler.h"
+
+bool pc_profiling_on = false;
+
+// Table that samples are bucketed against, and its histogram
+static const pc_symbol_t *table;
+static size_t table_len;
+static uint32_t *counts;
+
+// Samples outside every function of the table
+static uint32_t unknown_count;
+
+void pc_profile_init(const pc_symbol_t *t, size_t len, uint32_t *c) {
+	table = t;
+	table_len = len;
+	counts = c;
+	pc_profile_reset();
+}
+
+/*
+ * Binary search for the last entry with start <= pc. The loop always
+ * runs log2(len) times and its only data-dependent choice is a select,
+ * so the time spent in SysTick_Handler does not depend on where the
+ * sample landed.
+ */
+int pc_symtab_lookup(const pc_symbol_t *symbols, size_t len, uint32_t pc) {
+	const pc_symbol_t *base = symbols;
+	size_t n = len;
+
+	if (n == 0) {
+		return -1;
+	}
+
+	while (n > 1) {
+		size_t half = n / 2;
+		base = (base[half].start <= pc) ? base + half : base;
+		n -= half;
+	}
+
+	if (pc < base->start || pc >= base->end) {
+		return -1;  // before the first function, or in a gap
+	}
+	return (int) (base - symbols);
+}
+
+int pc_profile_lookup(uint32_t pc) {
+	return pc_symtab_lookup(table, table_len, pc);
+}
+
+void pc_profile_sample(uint32_t pc) {
+	int i = pc_profile_lookup(pc);
+
+	if (i < 0) {
+		unknown_count++;
+	} else {
+		counts[i]++;
+	}
+}
+
+void pc_profile_reset(void) {
+	for (size_t i = 0; i < table_len; i++) {
+		counts[i] = 0;
+	}
+	unknown_count = 0;
+}
+
+uint32_t pc_profile_unknown(void) {
+	return unknown_count;
+}
+
+/*
+ * Warns if pc_symtab.c was not generated from this build. The table
+ * only matches the image if the entry for pc_profile_on sits where the
+ * linker actually put pc_profile_on.
+ */
+static void check_symtab(void) {
+	uint32_t addr = (uint32_t) (uintptr_t) pc_profile_on & ~1u;  // Thumb bit
+
+	if (pc_symtab_len == 0) {
+		PRINTF("pc_symtab.c is empty; the post-build step did not run\r\n");
+		return;
+	}
+	for (size_t i = 0; i < pc_symtab_len; i++) {
+		if (strcmp(pc_symtab[i].name, "pc_profile_on") == 0) {
+			if (pc_symtab[i].start != addr) {
+				break;
+			}
+			return;
+		}
+	}
+	PRINTF("pc_symtab.c does not match this build; rebuild\r\n");
+}
+
+/*
+ * Turn the profiler on for sampling.
+ */
+void pc_profile_on(void) {
+	check_symtab();
+	pc_profile_init(pc_symtab, pc_symtab_len, pc_symtab_counts);
+	pc_profiling_on = true;
+}
+
+/*
+ * Turn the profiler off for sampling.
+ */
+void pc_profile_off(void) {
+	pc_profiling_on = false;
+}
+
+/*
+ * Prints count as a percentage of total, to one decimal place
+ */
+static void print_share(const char *name, uint32_t count, uint32_t total) {
+	uint32_t tenths = (uint32_t) (((uint64_t) count * 1000 + total / 2) / total);
+
+	PRINTF("%5u.%u%%  %8u  %s\r\n", tenths / 10, tenths % 10, count, name);
+}
+
+/*
+ * Print a flat profile of the functions that were sampled, in address
+ * order. host/pc_replay prints the same profile sorted by count.
+ */
+void print_pc_profiler_summary(void) {
+	uint32_t total = unknown_count;
+
+	for (size_t i = 0; i < table_len; i++) {
+		total += counts[i];
+	}
+
+	PRINTF("PC profiling results (%u samples):\r\n", total);
+	if (total == 0) {
+		PRINTF("End of PC profiling results\r\n");
+		return;
+	}
+	PRINTF("     %%   samples  function\r\n");
+	for (size_t i = 0; i < table_len; i++) {
+		if (counts[i] != 0) {
+			print_share(table[i].name, counts[i], total);
+		}
+	}
+	if (unknown_count != 0) {
+		print_share("(unknown)", unknown_count, total);
+	}
+	PRINTF("End of PC profiling results\r\n");
+}
@@ -1,47 +1,102 @@
-/*
- * profiler.h
- *
- *  Created on: May 24, 2023
- *      Author: lpandit
- *
- *
- */
-#include "stdbool.h"
-#include "stdint.h"
-
-#ifndef _PC_PROFILER_H_
-#define _PC_PROFILER_H_
-
-/* Flag to indicate if pc profiling is on */
-extern bool pc_profiling_on;
-
-/*
- * Check if the program count pc belongs to one of the isha functions.
- *
- * Parameters:
- *   pc   - Program Counter
- */
-void pc_profile_check(uint32_t *pc);
-
-/*
- * Turn the pc profiler on for call counting.
- */
-void pc_profile_on(void);
-
-/*
- * Turn the pc profiler off for call counting.
- */
-void pc_profile_off(void);
-
-
-/*
- * Print a summary of profiler calls for following functions.
- *
- * ISHAProcessMessageBlock
- * ISHAPadMessage
- * ISHAReset
- * ISHAResult
- * ISHAInput
- */
-void print_pc_profiler_summary(void);
-#endif
+/*
+ * profiler.h
+ *
+ *  Created on: May 24, 2023
+ *      Author: lpandit
+ *
+ *
+ */
+#include "stdbool.h"
+#include "stddef.h"
+#include "stdint.h"
+
+#ifndef _PC_PROFILER_H_
+#define _PC_PROFILER_H_
+
+/*
+ * One function of the image: samples with start <= pc < end are
+ * counted against it. Tables are sorted by start and do not overlap.
+ */
+typedef struct {
+	uint32_t start;
+	uint32_t end;
+	const char *name;
+} pc_symbol_t;
+
+/*
+ * Symbol table of the firmware image, generated into pc_symtab.c by
+ * host/pc_symtab_gen from the nm output of the linked .axf
+ */
+extern const pc_symbol_t pc_symtab[];
+extern const size_t pc_symtab_len;
+extern uint32_t pc_symtab_counts[];
+
+/* Flag to indicate if pc profiling is on */
+extern bool pc_profiling_on;
+
+/*
+ * Selects the symbol table that samples are bucketed against and
+ * clears the histogram.
+ *
+ * Parameters:
+ *   table   - Symbols sorted by start address, not overlapping
+ *   len     - Number of entries in table
+ *   counts  - Histogram, len entries (out)
+ */
+void pc_profile_init(const pc_symbol_t *table, size_t len, uint32_t *counts);
+
+/*
+ * Returns the index of the entry of table containing pc, or -1 if pc is
+ * outside every entry.
+ *
+ * Parameters:
+ *   table   - Symbols sorted by start address, not overlapping
+ *   len     - Number of entries in table
+ *   pc      - Program Counter
+ */
+int pc_symtab_lookup(const pc_symbol_t *table, size_t len, uint32_t pc);
+
+/*
+ * Returns the index of the entry of the table given to pc_profile_init
+ * containing pc, or -1 if pc is outside every entry.
+ *
+ * Parameters:
+ *   pc   - Program Counter
+ */
+int pc_profile_lookup(uint32_t pc);
+
+/*
+ * Counts one sample against the function containing pc. Called from
+ * SysTick_Handler while pc_profiling_on is set.
+ *
+ * Parameters:
+ *   pc   - Program Counter
+ */
+void pc_profile_sample(uint32_t pc);
+
+/*
+ * Clears the histogram and the unknown count.
+ */
+void pc_profile_reset(void);
+
+/*
+ * Returns the number of samples that fell outside every table entry.
+ */
+uint32_t pc_profile_unknown(void);
+
+/*
+ * Turn the pc profiler on for sampling, using the generated pc_symtab.
+ */
+void pc_profile_on(void);
+
+/*
+ * Turn the pc profiler off for sampling.
+ */
+void pc_profile_off(void);
+
+/*
+ * Print a flat profile: every function with at least one sample, its
+ * sample count and its share of all samples.
+ */
+void print_pc_profiler_summary(void);
+#endif
@@ -0,0 +1,13 @@
+/*
+ * pc_symtab.c
+ *
+ * Generated by host/pc_symtab_gen from the nm output of the linked
+ * image. Do not edit: the post-build step (host/pc_symtab_update.sh)
+ * regenerates it after every link, and relinks when it changed.
+ */
+
+#include "pc_profiler.h"
+
+const pc_symbol_t pc_symtab[1];
+const size_t pc_symtab_len = 0;
+uint32_t pc_symtab_counts[1];
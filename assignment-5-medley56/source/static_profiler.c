@@ -1,44 +1,177 @@
-/*
- * File gives the implementation of the static profiler functions.
- *
- *  Created on: Aug 2, 2023
- *      Author: lpandit
- */
-
-#include "MKL25Z4.h"
-#include "fsl_debug_console.h"
-#include "static_profiler.h"
-
-/* Declarations of the counter and profiling flag */
-uint32_t ISHAProcessMessageBlockCount, ISHAPadMessageCount, ISHAResetCount, ISHAInputCount, ISHAResultCount;
-bool static_profiling_on ;
-
-/*
- * Turns the static profiler on.
- */
-void static_profile_on(void)
-{
-	static_profiling_on = true;
-}
-
-/*
- * Turns the static profiler off.
- */
-void static_profile_off(void)
-{
-	static_profiling_on = false;
-}
-
-/*
- *  Prints the summary of the profiling.
- */
-void print_static_profiler_summary(void)
-{
-	PRINTF("Static profiling results:\r\n");
-	PRINTF("Function: ISHAProcessMessageBlock    Call count: %u\r\n", ISHAProcessMessageBlockCount);
-	PRINTF("Function: ISHAPadMessage             Call count: %u\r\n", ISHAPadMessageCount);
-	PRINTF("Function: ISHAReset                  Call count: %u\r\n", ISHAResetCount);
-	PRINTF("Function: ISHAInput                  Call count: %u\r\n", ISHAInputCount);
-	PRINTF("Function: ISHAResult                 Call count: %u\r\n", ISHAResultCount);
-	PRINTF("End of static profiling results\r\n");
-}
+/*
+ * File gives the implementation of the static profiler functions.
+ *
+ *  Created on: Aug 2, 2023
+ *      Author: lpandit
+ */
+
+#include <stddef.h>
+
+#include "fsl_debug_console.h"
+#include "static_profiler.h"
+#include "ticktime.h"
+
+/* A profiled call that has not returned yet */
+typedef struct {
+	profile_id_t id;
+	uint32_t start;     // clock at entry
+	uint32_t children;  // inclusive cycles of profiled callees so far
+} profile_frame_t;
+
+#define STATIC_PROFILE_NAME(fn) #fn,
+static const char *const names[PROFILE_NUM_FUNCTIONS] = {
+	STATIC_PROFILE_FUNCTIONS(STATIC_PROFILE_NAME)
+};
+#undef STATIC_PROFILE_NAME
+
+static profile_stats_t stats[PROFILE_NUM_FUNCTIONS];
+
+static profile_frame_t stack[STATIC_PROFILE_MAX_DEPTH];
+static int depth;
+static uint32_t skipped;     // nesting below the deepest stack frame
+static uint32_t too_deep;    // calls not timed because the stack was full
+static uint32_t unbalanced;  // exits that did not match the innermost entry
+
+static static_profile_clock_t profile_clock = ticktime_cycles;
+
+bool static_profiling_on ;
+
+/*
+ * Turns the static profiler on.
+ */
+void static_profile_on(void)
+{
+	// Calls in progress from an earlier run will never see their exit
+	depth = 0;
+	skipped = 0;
+	static_profiling_on = true;
+}
+
+/*
+ * Turns the static profiler off.
+ */
+void static_profile_off(void)
+{
+	static_profiling_on = false;
+}
+
+void static_profile_reset(void)
+{
+	for (int i = 0; i < PROFILE_NUM_FUNCTIONS; i++) {
+		stats[i] = (profile_stats_t) { 0 };
+	}
+	depth = 0;
+	skipped = 0;
+	too_deep = 0;
+	unbalanced = 0;
+}
+
+void static_profile_set_clock(static_profile_clock_t clock)
+{
+	profile_clock = clock;
+}
+
+void static_profile_enter(profile_id_t id)
+{
+	profile_frame_t *frame;
+
+	if (skipped > 0 || depth == STATIC_PROFILE_MAX_DEPTH) {
+		skipped++;
+		too_deep++;
+		return;
+	}
+
+	frame = &stack[depth++];
+	frame->id = id;
+	frame->children = 0;
+	// Last, so the bookkeeping above is not charged to the function
+	frame->start = profile_clock();
+}
+
+void static_profile_exit(profile_id_t id)
+{
+	uint32_t end = profile_clock();
+	uint32_t elapsed;
+	profile_frame_t *frame;
+	profile_stats_t *s;
+
+	if (skipped > 0) {
+		skipped--;
+		return;
+	}
+	// An exit without its entry, e.g. from a call that was already in
+	// progress when the profiler was turned on
+	if (depth == 0 || stack[depth - 1].id != id) {
+		unbalanced++;
+		return;
+	}
+
+	frame = &stack[--depth];
+	elapsed = end - frame->start;  // modulo 2^32, so wrapping is fine
+
+	s = &stats[id];
+	if (s->calls == 0 || elapsed < s->min) {
+		s->min = elapsed;
+	}
+	if (elapsed > s->max) {
+		s->max = elapsed;
+	}
+	s->calls++;
+	s->cycles += elapsed;
+	s->selfCycles += (elapsed > frame->children) ? elapsed - frame->children : 0;
+
+	if (depth > 0) {
+		stack[depth - 1].children += elapsed;
+	}
+}
+
+const profile_stats_t* static_profile_stats(profile_id_t id)
+{
+	return &stats[id];
+}
+
+/*
+ * Formats v in decimal into buf, which must hold 21 characters. The
+ * integer-only PRINTF has no 64-bit conversions.
+ */
+static const char* format_u64(char *buf, uint64_t v)
+{
+	char *p = buf + 20;
+
+	*p = '\0';
+	do {
+		*--p = (char) ('0' + v % 10);
+		v /= 10;
+	} while (v != 0);
+	return p;
+}
+
+/*
+ *  Prints the summary of the profiling.
+ */
+void print_static_profiler_summary(void)
+{
+	char total[21], self[21];
+	uint32_t calls = 0;
+
+	PRINTF("Static profiling results (inclusive and self cycles):\r\n");
+	PRINTF("%-24s %8s %12s %12s %8s %8s %8s\r\n", "Function", "Calls",
+			"Cycles", "Self", "Min", "Mean", "Max");
+	for (int i = 0; i < PROFILE_NUM_FUNCTIONS; i++) {
+		const profile_stats_t *s = &stats[i];
+		uint32_t mean = s->calls ? (uint32_t) (s->cycles / s->calls) : 0;
+
+		PRINTF("%-24s %8u %12s %12s %8u %8u %8u\r\n", names[i], s->calls,
+				format_u64(total, s->cycles), format_u64(self, s->selfCycles),
+				s->min, mean, s->max);
+		calls += s->calls;
+	}
+	if (calls == 0) {
+		PRINTF("No calls recorded; is STATIC_PROFILING defined?\r\n");
+	}
+	if (too_deep > 0 || unbalanced > 0) {
+		PRINTF("Untimed: %u nested too deep, %u unbalanced exits\r\n",
+				too_deep, unbalanced);
+	}
+	PRINTF("End of static profiling results\r\n");
+}
@@ -1,38 +1,127 @@
-/*
- * Header file for the static profiler functions.
- *
- *  Created on: Aug 2, 2023
- *      Author: lpandit
- */
-
-#include "stdint.h"
-#include "stdbool.h"
-
-#ifndef STATIC_PROFILER_H_
-#define STATIC_PROFILER_H_
-
-
-/* Count values for number of times each function is called when the profiler is turned on. */
-extern uint32_t ISHAProcessMessageBlockCount, ISHAPadMessageCount, ISHAResetCount, ISHAInputCount, ISHAResultCount;
-
-/* Flag to indicate if the profiler is on */
-extern bool static_profiling_on ;
-
-/*
- * Turns the static profiling on.
- *
- */
-void static_profile_on(void);
-
-/*
- *  Turns the static profiling off.
- */
-void static_profile_off(void);
-
-/*
- *  Prints a summary of the static profiling.
- */
-void print_static_profiler_summary(void);
-
-
-#endif /* STATIC_PROFILER_H_ */
+/*
+ * Header file for the static profiler functions.
+ *
+ *  Created on: Aug 2, 2023
+ *      Author: lpandit
+ */
+
+#include "stdint.h"
+#include "stdbool.h"
+
+#ifndef STATIC_PROFILER_H_
+#define STATIC_PROFILER_H_
+
+/*
+ * Functions instrumented with PROFILE_ENTER/PROFILE_EXIT. Add a line
+ * here to profile another function; the summary lists them in this
+ * order.
+ */
+#define STATIC_PROFILE_FUNCTIONS(X) \
+	X(pbkdf1) \
+	X(pbkdf1Start) \
+	X(pbkdf1Step) \
+	X(ISHAReset) \
+	X(ISHAInput) \
+	X(ISHAResult) \
+	X(ISHAPadMessage) \
+	X(ISHAProcessMessageBlock) \
+	X(ISHAIterateDigest)
+
+#define STATIC_PROFILE_ID(fn) PROFILE_ID_##fn,
+typedef enum {
+	STATIC_PROFILE_FUNCTIONS(STATIC_PROFILE_ID)
+	PROFILE_NUM_FUNCTIONS
+} profile_id_t;
+#undef STATIC_PROFILE_ID
+
+/* Deepest nesting of profiled functions that is timed */
+#define STATIC_PROFILE_MAX_DEPTH 8
+
+/*
+ * Statistics for one function. Inclusive cycles run from PROFILE_ENTER
+ * to PROFILE_EXIT; self cycles leave out the inclusive cycles of the
+ * profiled functions it called.
+ */
+typedef struct {
+	uint32_t calls;
+	uint64_t cycles;
+	uint64_t selfCycles;
+	uint32_t min;
+	uint32_t max;
+} profile_stats_t;
+
+/*
+ * PROFILE_ENTER(fn) goes at the top of fn and PROFILE_EXIT(fn) before
+ * every return. Without STATIC_PROFILING defined they compile to
+ * nothing.
+ */
+#ifdef STATIC_PROFILING
+#define PROFILE_ENTER(fn) \
+	do { \
+		if (static_profiling_on) \
+			static_profile_enter(PROFILE_ID_##fn); \
+	} while (0)
+#define PROFILE_EXIT(fn) \
+	do { \
+		if (static_profiling_on) \
+			static_profile_exit(PROFILE_ID_##fn); \
+	} while (0)
+#else
+#define PROFILE_ENTER(fn) ((void) 0)
+#define PROFILE_EXIT(fn)  ((void) 0)
+#endif
+
+/* Clock that timestamps entry and exit, in cycles */
+typedef uint32_t (*static_profile_clock_t)(void);
+
+/* Flag to indicate if the profiler is on */
+extern bool static_profiling_on ;
+
+/*
+ * Turns the static profiling on. Statistics keep accumulating from
+ * earlier runs until static_profile_reset() is called.
+ *
+ */
+void static_profile_on(void);
+
+/*
+ *  Turns the static profiling off.
+ */
+void static_profile_off(void);
+
+/*
+ * Clears the statistics of every function.
+ */
+void static_profile_reset(void);
+
+/*
+ * Replaces the clock used for timestamps. The default is
+ * ticktime_cycles().
+ *
+ * Parameters:
+ *   clock  - Returns the current time in cycles, wrapping at 2^32
+ */
+void static_profile_set_clock(static_profile_clock_t clock);
+
+/*
+ * Records entry to / exit from a profiled function. Use the
+ * PROFILE_ENTER and PROFILE_EXIT macros rather than calling these.
+ *
+ * Parameters:
+ *   id  - The function
+ */
+void static_profile_enter(profile_id_t id);
+void static_profile_exit(profile_id_t id);
+
+/*
+ * Returns the statistics of one function.
+ */
+const profile_stats_t* static_profile_stats(profile_id_t id);
+
+/*
+ *  Prints a summary of the static profiling.
+ */
+void print_static_profiler_summary(void);
+
+
+#endif /* STATIC_PROFILER_H_ */
@@ -1,60 +1,114 @@
-/**
- * @file    ticktime.c
- * @brief   Code to map SysTick timer into msec counter
- * @author  Howdy Pierce, howdy.pierce@colorado.edu
- */
-
-#include "MKL25Z4.h"
-#include "core_cm0plus.h"
-#include "ticktime.h"
-#include "fsl_debug_console.h"
-#include "pc_profiler.h"
-
-#define MS_PER_S 1000
-#define TICKS_PER_SECOND 10000
-static volatile ticktime_t g_now = 0;
-static ticktime_t g_timer = 0;
-
-uint32_t prev_pc;
-
-void init_ticktime(void) {
-	// set control & status register to use 48 MHz/16 = 3 MHz
-	// clock. Then interrupt 10000 times per second
-	SysTick->LOAD = (48000000 / 16) / (TICKS_PER_SECOND);
-	NVIC_SetPriority(SysTick_IRQn, 3);
-	NVIC_ClearPendingIRQ(SysTick_IRQn);
-	NVIC_EnableIRQ(SysTick_IRQn);
-	SysTick->VAL = 0;
-	SysTick->CTRL &= ~(SysTick_CTRL_CLKSOURCE_Msk);
-	SysTick->CTRL |= SysTick_CTRL_TICKINT_Msk | SysTick_CTRL_ENABLE_Msk;
-
-	g_now = 0;
-	g_timer = 0;
-}
-
-void SysTick_Handler(void) {
-	// Store PC value
-	asm("ldr %0, [sp, #32]" // Load the value from memory address (sp + 24) into 'prev_pc'
-			: "=r"(prev_pc)// Store value in global variable
-	);
-	//PRINTF("TICK!\r\n");
-	g_now++;  // Increment tick counter
-	if (pc_profiling_on) {
-		//PRINTF("Previous PC address: %u\r\n", prev_pc);
-		pc_profile_check(&prev_pc);
-	}
-}
-
-ticktime_t now(void) {
-	// [ticks] * [ms/s] / [ticks/s] = [ms]
-	return (g_now * MS_PER_S) / TICKS_PER_SECOND;
-}
-
-void reset_timer(void) {
-	g_timer = g_now;
-}
-
-ticktime_t get_timer(void) {
-	// [ticks] * [ms/s] / [ticks/s] = [ms]
-	return ((g_now - g_timer) * MS_PER_S) / TICKS_PER_SECOND;
-}
+/**
+ * @file    ticktime.c
+ * @brief   Code to map SysTick timer into msec counter
+ * @author  Howdy Pierce, howdy.pierce@colorado.edu
+ */
+
+#include "MKL25Z4.h"
+#include "core_cm0plus.h"
+#include "ticktime.h"
+#include "fsl_debug_console.h"
+#include "pc_profiler.h"
+#include "callgraph.h"
+#include "monotonic.h"
+#include "mtb_dump.h"
+
+#define MS_PER_S 1000
+#define TICKS_PER_SECOND 10000
+#define CORE_CLOCK_HZ 48000000
+#define CYCLES_PER_TICK (CORE_CLOCK_HZ / TICKS_PER_SECOND)
+static volatile ticktime_t g_now = 0;
+static ticktime_t g_timer = 0;
+static monotonic_clock_t g_clock;
+
+extern void _vStackTop(void);  // from the linker script
+
+static uint32_t systick_counter(void) {
+	return SysTick->VAL;
+}
+
+static bool systick_pending(void) {
+	return (SCB->ICSR & SCB_ICSR_PENDSTSET_Msk) != 0;
+}
+
+void init_ticktime(void) {
+	// set control & status register to use the 48 MHz core clock, so
+	// that VAL counts cycles. Then interrupt 10000 times per second
+	SysTick->LOAD = CYCLES_PER_TICK - 1;
+	NVIC_SetPriority(SysTick_IRQn, 3);
+	NVIC_ClearPendingIRQ(SysTick_IRQn);
+	NVIC_EnableIRQ(SysTick_IRQn);
+	SysTick->VAL = 0;
+	SysTick->CTRL |= SysTick_CTRL_CLKSOURCE_Msk | SysTick_CTRL_TICKINT_Msk
+			| SysTick_CTRL_ENABLE_Msk;
+
+	g_now = 0;
+	g_timer = 0;
+	monotonic_init(&g_clock, CYCLES_PER_TICK, CORE_CLOCK_HZ, systick_counter,
+			systick_pending);
+}
+
+/*
+ * SysTick body, called by SysTick_Handler with the exception frame:
+ * r0-r3, r12, lr, pc and xPSR of the interrupted code
+ */
+__attribute__((used)) void ticktime_isr(uint32_t *frame) {
+	g_now++;  // Increment tick counter
+	monotonic_tick(&g_clock);
+	if (pc_profiling_on) {
+		pc_profile_sample(frame[CALLGRAPH_FRAME_PC]);
+	}
+	if (callgraph_on) {
+		callgraph_sample(frame, (const uint32_t*) &_vStackTop);
+	}
+	mtb_tick();
+}
+
+/*
+ * Finds the exception frame on whichever stack it was pushed to, per
+ * bit 2 of EXC_RETURN in lr, and tail-calls ticktime_isr with it. lr
+ * is left untouched, so ticktime_isr returns from the exception. Being
+ * naked, the frame is not offset by a compiler-generated prologue.
+ */
+__attribute__((naked)) void SysTick_Handler(void) {
+	__asm volatile (
+			"movs r0, #4            \n"
+			"mov  r1, lr            \n"
+			"tst  r0, r1            \n"
+			"beq  1f                \n"
+			"mrs  r0, psp           \n"
+			"b    2f                \n"
+			"1:                     \n"
+			"mrs  r0, msp           \n"
+			"2:                     \n"
+			"ldr  r1, =ticktime_isr \n"
+			"bx   r1                \n"
+			".ltorg                 \n"
+	);
+}
+
+ticktime_t now(void) {
+	// [ticks] * [ms/s] / [ticks/s] = [ms]
+	return (g_now * MS_PER_S) / TICKS_PER_SECOND;
+}
+
+void reset_timer(void) {
+	g_timer = g_now;
+}
+
+ticktime_t get_timer(void) {
+	// [ticks] * [ms/s] / [ticks/s] = [ms]
+	return ((g_now - g_timer) * MS_PER_S) / TICKS_PER_SECOND;
+}
+
+uint32_t ticktime_cycles(void) {
+	return monotonic_now32(&g_clock);
+}
+
+uint64_t ticktime_cycles64(void) {
+	return monotonic_now(&g_clock);
+}
+
+uint64_t ticktime_cycles_to_us(uint64_t cycles) {
+	return monotonic_to_us(&g_clock, cycles);
+}
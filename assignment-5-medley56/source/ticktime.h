@@ -1,37 +1,57 @@
-/**
- * @file    ticktime.h
- * @brief   Map SysTick timer into msec counter
- * @author  Howdy Pierce, howdy.pierce@colorado.edu
- */
-
-#ifndef _TICKTIME_H_
-#define _TICKTIME_H_
-
-typedef uint32_t ticktime_t;  // time since boot, in ticks. One tick is defined
-							  // by TICKS_PER_SECOND in ticktime.c
-
-/*
- * Initializes the ticktime counters. Immediately after this function
- * returns, a call to now() will return 0, and a call to get_timer()
- * will return 0.
- */
-void init_ticktime(void);
-
-/*
- * Returns time since init_ticktime() was called, in ms
- */
-ticktime_t now(void);
-
-/*
- * Resets the timer. Immediately after this function returns, a call
- * to get_timer() will return 0.
- */
-void reset_timer(void);
-
-/*
- * Returns time since the latter of init_ticktime() or reset_timer()
- * was called, in ms
- */
-ticktime_t get_timer(void);
-
-#endif /* _TICKTIME_H_ */
+/**
+ * @file    ticktime.h
+ * @brief   Map SysTick timer into msec counter
+ * @author  Howdy Pierce, howdy.pierce@colorado.edu
+ */
+
+#ifndef _TICKTIME_H_
+#define _TICKTIME_H_
+
+#include <stdint.h>
+
+typedef uint32_t ticktime_t;  // time since boot, in ticks. One tick is defined
+							  // by TICKS_PER_SECOND in ticktime.c
+
+/*
+ * Initializes the ticktime counters. Immediately after this function
+ * returns, a call to now() will return 0, and a call to get_timer()
+ * will return 0.
+ */
+void init_ticktime(void);
+
+/*
+ * Returns time since init_ticktime() was called, in ms
+ */
+ticktime_t now(void);
+
+/*
+ * Resets the timer. Immediately after this function returns, a call
+ * to get_timer() will return 0.
+ */
+void reset_timer(void);
+
+/*
+ * Returns time since the latter of init_ticktime() or reset_timer()
+ * was called, in ms
+ */
+ticktime_t get_timer(void);
+
+/*
+ * Returns core clock cycles since init_ticktime() was called, modulo
+ * 2^32 (about 89 seconds at 48 MHz). Differences of two readings are
+ * valid across the wrap.
+ */
+uint32_t ticktime_cycles(void);
+
+/*
+ * Returns core clock cycles since init_ticktime() was called. Does not
+ * wrap in practice (12000 years at 48 MHz).
+ */
+uint64_t ticktime_cycles64(void);
+
+/*
+ * Converts a number of core clock cycles to us, rounding down
+ */
+uint64_t ticktime_cycles_to_us(uint64_t cycles);
+
+#endif /* _TICKTIME_H_ */
@@ -0,0 +1,331 @@
+/*
+ * autocorrelate_bench.c
+ *
+ * Host benchmark of autocorrelate_detect_period (direct) against
+ * autocorrelate_detect_period_fft (O(n log n)) for 256-8192 samples,
+ * and of the direct method against the original implementation, which
+ * chose the sample format and converted both samples for every
+ * multiply, in each sample format.
+ *
+ * The direct method stops at the first peak, so it costs O(n * period)
+ * when there is a period to find and O(n^2) when there is not. Both
+ * cases are timed: the sines of the TESTING harness in autocorrelate.c
+ * (periods 12, 24, ... 240, in each of the four sample formats), and
+ * white noise in the four formats.
+ *
+ * One operation is detecting all the sines, or all the noise, at one
+ * buffer size.
+ * Each operation is warmed up and then timed over several samples, each
+ * long enough for clock resolution not to matter; the median and the
+ * median absolute deviation (MAD) are reported. Both methods are first
+ * checked to find the period (within the harness's slop) whenever the
+ * other one does, and the direct method to find the same periods as the
+ * original.
+ *
+ * Usage: autocorrelate_bench [-s samples] [-q]
+ *   -q  only run the checks, for make test
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <unistd.h>
+
+#include "autocorrelate.h"
+#include "bench_util.h"
+#include "fp_trig.h"
+
+#define MIN_SIZE        256
+#define MAX_SIZE        8192
+#define FIRST_PERIOD    12
+#define LAST_PERIOD     240
+#define NUM_PERIODS     (LAST_PERIOD / FIRST_PERIOD)
+#define NUM_FORMATS     4
+#define SLOP            2
+#define DEFAULT_SAMPLES 7
+#define MAX_SAMPLES     101
+#define SAMPLE_SECONDS  0.02
+
+#define ALL_FORMATS     (-1)
+
+// The lag kernel autocorrelate.c was built with
+#if !defined(AUTOCORRELATE_NO_SIMD) && defined(__AVX2__)
+#define KERNEL "AVX2"
+#elif !defined(AUTOCORRELATE_NO_SIMD) && defined(__SSE2__)
+#define KERNEL "SSE2"
+#else
+#define KERNEL "scalar"
+#endif
+
+static const char *const format_names[NUM_FORMATS] = {
+	[kAC_12bps_unsigned] = "12u", [kAC_16bps_unsigned] = "16u",
+	[kAC_12bps_signed] = "12s", [kAC_16bps_signed] = "16s"
+};
+
+typedef int (*detect_fn_t)(void *samples, uint32_t nsamp,
+		autocorrelate_sample_format_t format);
+
+// Test signals, one per period and format, and noise in each format
+static uint16_t signals[NUM_PERIODS][NUM_FORMATS][MAX_SIZE];
+static uint16_t noise[NUM_FORMATS][MAX_SIZE];
+static int32_t work[2 * MAX_SIZE];
+static volatile int sink;
+
+// The same signals as the TESTING harness, in all four formats
+static void make_signals(void) {
+	for (int p = 0; p < NUM_PERIODS; p++) {
+		int period = FIRST_PERIOD * (p + 1);
+
+		for (int i = 0; i < MAX_SIZE; i++) {
+			int16_t s12 = fp_sin(i * TWO_PI / period);
+			uint16_t u12 = s12 + TRIG_SCALE_FACTOR;
+
+			signals[p][kAC_12bps_signed][i] = (uint16_t) s12;
+			signals[p][kAC_12bps_unsigned][i] = u12;
+			signals[p][kAC_16bps_signed][i] = (uint16_t) (s12 << 4);
+			signals[p][kAC_16bps_unsigned][i] = u12 << 4;
+		}
+	}
+	for (int i = 0; i < MAX_SIZE; i++) {
+		uint16_t r = rng();
+
+		noise[kAC_12bps_signed][i] = (uint16_t) ((int16_t) r >> 4);
+		noise[kAC_12bps_unsigned][i] = r >> 4;
+		noise[kAC_16bps_signed][i] = r;
+		noise[kAC_16bps_unsigned][i] = r;
+	}
+}
+
+/*
+ * autocorrelate_detect_period as it was before the sample formats got
+ * their own loops, kept as the baseline
+ */
+static int detect_original(void *samples, uint32_t nsamp,
+		autocorrelate_sample_format_t format) {
+	int32_t sum = 0;
+	int prev_sum = 0;
+	int32_t thresh = 0;
+	bool slope_positive = false;
+	int32_t s1 = 0;
+	int32_t s2 = 0;
+
+	for (int i = 0; i < nsamp; i++) {
+		prev_sum = sum;
+		sum = 0;
+		for (int k = 0; k < nsamp - i; k++) {
+			switch (format) {
+			case kAC_12bps_unsigned:
+				s1 = (int32_t) *((uint16_t *) samples + k) - (1 << 11);
+				s2 = (int32_t) *((uint16_t *) samples + k + i) - (1 << 11);
+				sum += (s1 * s2) >> 12;
+				break;
+			case kAC_16bps_unsigned:
+				s1 = (int32_t) *((uint16_t *) samples + k) - (1 << 15);
+				s2 = (int32_t) *((uint16_t *) samples + k + i) - (1 << 15);
+				sum += (s1 * s2) >> 16;
+				break;
+			case kAC_12bps_signed:
+			case kAC_16bps_signed:
+				s1 = *((int16_t *) samples + k);
+				s2 = *((int16_t *) samples + k + i);
+				sum += (s1 * s2) >> (format == kAC_12bps_signed ? 12 : 16);
+				break;
+			}
+		}
+		if (i == 0) {
+			thresh = sum / 2;
+		} else if ((sum > thresh) && (sum - prev_sum > 0)) {
+			slope_positive = true;
+		} else if (slope_positive && (sum - prev_sum) <= 0) {
+			return i - 1;
+		}
+	}
+	return -1;
+}
+
+static int detect_direct(void *samples, uint32_t nsamp,
+		autocorrelate_sample_format_t format) {
+	return autocorrelate_detect_period(samples, nsamp, format);
+}
+
+static int detect_fft(void *samples, uint32_t nsamp,
+		autocorrelate_sample_format_t format) {
+	return autocorrelate_detect_period_fft(samples, nsamp, format, work,
+			sizeof(work) / sizeof(work[0]));
+}
+
+static bool found(int res, int period) {
+	return period - res <= SLOP && res - period <= SLOP;
+}
+
+/*
+ * Checks that the FFT path finds every period the direct one finds at
+ * this size, and counts the periods each one finds
+ */
+static bool check_size(uint32_t nsamp, int *direct_found, int *fft_found) {
+	bool ok = true;
+
+	*direct_found = *fft_found = 0;
+	for (int p = 0; p < NUM_PERIODS; p++) {
+		int period = FIRST_PERIOD * (p + 1);
+
+		for (int f = 0; f < NUM_FORMATS; f++) {
+			int o = detect_original(signals[p][f], nsamp, f);
+			int d = detect_direct(signals[p][f], nsamp, f);
+			int x = detect_fft(signals[p][f], nsamp, f);
+
+			*direct_found += found(d, period);
+			*fft_found += found(x, period);
+			if (found(d, period) != found(x, period)) {
+				printf("MISMATCH: %u samples, period %d, format %d: "
+						"direct %d, fft %d\n", (unsigned) nsamp, period, f, d, x);
+				ok = false;
+			}
+			if (found(o, period) != found(d, period)) {
+				printf("MISMATCH: %u samples, period %d, format %d: "
+						"original %d, direct %d\n", (unsigned) nsamp, period, f, o,
+						d);
+				ok = false;
+			}
+		}
+	}
+	return ok;
+}
+
+static void run_all(detect_fn_t detect, uint32_t nsamp, bool use_noise,
+		int format) {
+	for (int f = 0; f < NUM_FORMATS; f++) {
+		if (format != ALL_FORMATS && f != format) {
+			continue;
+		}
+		if (use_noise) {
+			sink = detect(noise[f], nsamp, f);
+			continue;
+		}
+		for (int p = 0; p < NUM_PERIODS; p++) {
+			sink = detect(signals[p][f], nsamp, f);
+		}
+	}
+}
+
+/*
+ * Returns the median time of one run over all the sines or all the
+ * noise, in one format or ALL_FORMATS, in microseconds, and its MAD
+ */
+static double time_method(detect_fn_t detect, uint32_t nsamp, bool use_noise,
+		int format, int samples, double *mad) {
+	double times[MAX_SAMPLES], dev[MAX_SAMPLES];
+	uint64_t reps = 1;
+	double t, med;
+
+	// Warm up, and find enough repetitions for one sample
+	for (;;) {
+		t = now();
+		for (uint64_t r = 0; r < reps; r++) {
+			run_all(detect, nsamp, use_noise, format);
+		}
+		t = now() - t;
+		if (t >= SAMPLE_SECONDS) {
+			break;
+		}
+		reps *= 2;
+	}
+
+	for (int s = 0; s < samples; s++) {
+		t = now();
+		for (uint64_t r = 0; r < reps; r++) {
+			run_all(detect, nsamp, use_noise, format);
+		}
+		times[s] = (now() - t) / reps * 1e6;
+	}
+	med = median(times, samples);
+	for (int s = 0; s < samples; s++) {
+		dev[s] = (times[s] > med) ? times[s] - med : med - times[s];
+	}
+	*mad = median(dev, samples);
+	return med;
+}
+
+int main(int argc, char *argv[]) {
+	int samples = DEFAULT_SAMPLES;
+	bool quick = false;
+	bool ok = true;
+	int opt;
+
+	while ((opt = getopt(argc, argv, "s:q")) != -1) {
+		switch (opt) {
+		case 's':
+			samples = atoi(optarg);
+			break;
+		case 'q':
+			quick = true;
+			break;
+		default:
+			fprintf(stderr, "usage: %s [-s samples] [-q]\n", argv[0]);
+			return 2;
+		}
+	}
+	if (samples < 1 || samples > MAX_SAMPLES) {
+		fprintf(stderr, "%s: samples must be 1-%d\n", argv[0], MAX_SAMPLES);
+		return 2;
+	}
+
+	make_signals();
+
+	if (!quick) {
+		printf("Microseconds per run: %d sines, or noise, in each of %d formats\n",
+				NUM_PERIODS, NUM_FORMATS);
+		printf("%7s %11s %11s %8s %6s %12s %11s %8s\n", "samples", "sine direct",
+				"sine fft", "speedup", "found", "noise direct", "noise fft",
+				"speedup");
+	}
+	for (uint32_t nsamp = MIN_SIZE; nsamp <= MAX_SIZE; nsamp *= 2) {
+		int direct_found, fft_found;
+		double sine_direct, sine_fft, noise_direct, noise_fft, mad;
+
+		ok &= check_size(nsamp, &direct_found, &fft_found);
+		if (quick) {
+			continue;
+		}
+		sine_direct = time_method(detect_direct, nsamp, false, ALL_FORMATS,
+				samples, &mad);
+		sine_fft = time_method(detect_fft, nsamp, false, ALL_FORMATS,
+				samples, &mad);
+		noise_direct = time_method(detect_direct, nsamp, true, ALL_FORMATS,
+				samples, &mad);
+		noise_fft = time_method(detect_fft, nsamp, true, ALL_FORMATS,
+				samples, &mad);
+		printf("%7u %11.0f %11.0f %7.2fx %3d/%d %12.0f %11.0f %7.2fx\n",
+				(unsigned) nsamp, sine_direct, sine_fft, sine_direct / sine_fft,
+				fft_found, NUM_PERIODS * NUM_FORMATS, noise_direct, noise_fft,
+				noise_direct / noise_fft);
+	}
+
+	if (!quick) {
+		printf("\nMicroseconds per run: %d sines in one format, direct method "
+				"(%s) against the original\n", NUM_PERIODS, KERNEL);
+		printf("%7s %6s %11s %11s %8s\n", "samples", "format", "original",
+				"direct", "speedup");
+	}
+	for (uint32_t nsamp = MIN_SIZE; nsamp <= MAX_SIZE && !quick; nsamp *= 2) {
+		for (int f = 0; f < NUM_FORMATS; f++) {
+			double original, direct, mad;
+
+			original = time_method(detect_original, nsamp, false, f, samples,
+					&mad);
+			direct = time_method(detect_direct, nsamp, false, f, samples, &mad);
+			printf("%7u %6s %11.1f %11.1f %7.2fx\n", (unsigned) nsamp,
+					format_names[f], original, direct, original / direct);
+		}
+	}
+
+	if (!ok) {
+		printf("autocorrelate_bench: methods disagree\n");
+		return 1;
+	}
+	if (quick) {
+		printf("autocorrelate_bench: original, direct and FFT methods agree\n");
+	}
+	return 0;
+}
@@ -0,0 +1,62 @@
+/*
+ * bench_util.c
+ *
+ * What the host benchmarks share; see bench_util.h.
+ */
+
+#include <math.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "bench_util.h"
+
+const char *const wave_names[NUM_WAVES] = { "square", "sine", "triangle" };
+
+double now(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+uint32_t rng(void) {
+	static uint32_t state = 2463534242u;
+	state ^= state << 13;
+	state ^= state >> 17;
+	state ^= state << 5;
+	return state;
+}
+
+int cmp_double(const void *a, const void *b) {
+	double x = *(const double *) a, y = *(const double *) b;
+	return (x > y) - (x < y);
+}
+
+double median(double *v, int n) {
+	qsort(v, n, sizeof(*v), cmp_double);
+	return (n % 2) ? v[n / 2] : (v[n / 2 - 1] + v[n / 2]) / 2;
+}
+
+double wave_value(int wave, double phase) {
+	double f = phase - floor(phase);
+
+	switch (wave) {
+	case SQUARE:
+		return (f < 0.5) ? -1.0 : 1.0;
+	case SINE:
+		return sin(2 * M_PI * f);
+	default:
+		return (f < 0.5) ? 4 * f - 1 : 3 - 4 * f;
+	}
+}
+
+uint16_t adc_code(double v, int32_t noise) {
+	int32_t code = (int32_t) lround(2047.5 + 2047.5 * v) << 4;
+
+	code += (int32_t) (rng() % (2 * (uint32_t) noise + 1)) - noise;
+	if (code < 0) {
+		code = 0;
+	} else if (code > UINT16_MAX) {
+		code = UINT16_MAX;
+	}
+	return (uint16_t) code;
+}
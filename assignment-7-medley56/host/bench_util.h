@@ -0,0 +1,51 @@
+/*
+ * bench_util.h
+ *
+ * What the host benchmarks share: a clock, a repeatable random number
+ * generator, medians, and the test waves as the board's ADC would
+ * capture them from the DAC.
+ */
+
+#ifndef BENCH_UTIL_H_
+#define BENCH_UTIL_H_
+
+#include <stdint.h>
+
+enum { SQUARE, SINE, TRIANGLE, NUM_WAVES };
+
+extern const char *const wave_names[NUM_WAVES];
+
+/*
+ * Monotonic time, in seconds
+ */
+double now(void);
+
+/*
+ * Returns a pseudo-random 32-bit value (xorshift), so that runs are
+ * repeatable
+ */
+uint32_t rng(void);
+
+/*
+ * qsort comparison of two doubles, ascending
+ */
+int cmp_double(const void *a, const void *b);
+
+/*
+ * Sorts the n values in v and returns their median
+ */
+double median(double *v, int n);
+
+/*
+ * The wave at phase (in cycles), -1 to 1
+ */
+double wave_value(int wave, double phase);
+
+/*
+ * A wave value of -1 to 1 as the DAC code 0-4095 scaled to the 16-bit
+ * ADC, plus uniform noise of up to noise codes either way, clipped as
+ * the ADC would
+ */
+uint16_t adc_code(double v, int32_t noise);
+
+#endif /* BENCH_UTIL_H_ */
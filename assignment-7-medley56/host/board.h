@@ -0,0 +1,13 @@
+/*
+ * board.h
+ *
+ * Host stand-in for board/board.h: the firmware only includes it for
+ * the device registers.
+ */
+
+#ifndef _BOARD_H_
+#define _BOARD_H_
+
+#include "fsl_device_registers.h"
+
+#endif /* _BOARD_H_ */
@@ -0,0 +1,195 @@
+/*
+ * dac_playback_test.c
+ *
+ * Runs the DAC playback in ../source/dma.c against the register model
+ * in kl25z_sim.c, in each of its modes:
+ *
+ *   - restart: a waveform table of any size, restarted by the DMA
+ *     interrupt after every pass, as the 960-sample tables are
+ *   - ring: a power-of-two table the DMA wraps around by itself, with
+ *     an interrupt only when the 20-bit byte count runs out
+ *   - stream: the DDS ping-pong buffer, refilled a half at a time
+ *
+ * Every TPM0 overflow must put the next sample in the DAC. With the
+ * handler run some samples late, it prints the interrupt rate and the
+ * samples that don't arrive in time (output gaps), per second.
+ */
+
+#include <assert.h>
+#include <stdio.h>
+
+#include "dma.h"
+#include "kl25z_sim.h"
+#include "waveforms.h"
+
+#define RING_SIZE      1024
+#define STREAM_SIZE    1024  // as dac.c streams DDS
+#define SECONDS        12  // over two byte count reloads in ring mode
+#define MAX_LATENCY    4
+
+static uint16_t ring[RING_SIZE] __attribute__((aligned(RING_SIZE * 2)));
+static uint16_t stream[STREAM_SIZE] __attribute__((aligned(STREAM_SIZE * 2)));
+static uint32_t stream_next;  // the next value the refill writes
+
+typedef struct {
+	const char *name;
+	void (*start)(void);
+	uint16_t (*expected)(uint32_t i);  // sample i of the output
+} mode_t;
+
+static void start_restart(void) {
+	const waveform_t *w = &waveforms[SINE_MODE];
+
+	Init_DMA_For_Playback(w->samples, w->num_samples);
+}
+
+static uint16_t expected_restart(uint32_t i) {
+	const waveform_t *w = &waveforms[SINE_MODE];
+
+	return w->samples[i % w->num_samples];
+}
+
+static void start_ring(void) {
+	for (uint32_t i = 0; i < RING_SIZE; i++) {
+		ring[i] = (uint16_t) ((i * 7919) & DAC_HIGH);
+	}
+	Init_DMA_For_Ring_Playback(ring, RING_SIZE);
+}
+
+static uint16_t expected_ring(uint32_t i) {
+	return ring[i % RING_SIZE];
+}
+
+static void refill(uint16_t *samples, uint32_t count) {
+	for (uint32_t i = 0; i < count; i++) {
+		samples[i] = (uint16_t) (stream_next++ & DAC_HIGH);
+	}
+}
+
+static void start_stream(void) {
+	stream_next = 0;
+	Init_DMA_For_Streaming(stream, STREAM_SIZE, refill);
+}
+
+static uint16_t expected_stream(uint32_t i) {
+	return (uint16_t) (i & DAC_HIGH);
+}
+
+static const mode_t modes[] = {
+	{ "restart", start_restart, expected_restart },
+	{ "ring",    start_ring,    expected_ring },
+	{ "stream",  start_stream,  expected_stream },
+};
+
+/*
+ * Plays for SECONDS, running the DMA handler late_by samples after
+ * the byte count runs out. Returns the number of samples that were not
+ * in the DAC on time, and checks that all of them were if none missed.
+ */
+static uint32_t play(const mode_t *mode, uint32_t late_by, uint32_t *irqs) {
+	uint32_t n, due = 0, wrong = 0;
+
+	sim_reset();
+	Init_TPM0(21);
+	mode->start();
+	Start_DMA_Playback();
+	Start_TPM0();
+	sim_hold_irqs(true);
+
+	n = SECONDS * Get_TPM0_Sample_Rate();
+	for (uint32_t i = 0; i < n; i++) {
+		sim_tpm0_overflow();
+		if (due > 0 && --due == 0) {
+			sim_run_irqs();
+		}
+		if (due == 0 && (DMA0->DMA[0].DSR_BCR & DMA_DSR_BCR_DONE_MASK)) {
+			due = late_by;
+			if (due == 0) {
+				sim_run_irqs();
+			}
+		}
+		if (sim_dac0_output() != mode->expected(i - sim_stats()->tpm0_missed)) {
+			wrong++;
+		}
+	}
+
+	assert(sim_stats()->tpm0_requests == n);
+	assert((DMA0->DMA[0].DSR_BCR & DMA_DSR_BCR_CE_MASK) == 0);
+	if (sim_stats()->tpm0_missed == 0) {
+		assert(wrong == 0);
+	}
+	*irqs = sim_stats()->irqs;
+	return sim_stats()->tpm0_missed;
+}
+
+/*
+ * Switching to a table that can be a ring plays it as one, and back
+ */
+static void test_switch(void) {
+	const waveform_t *w = &waveforms[TRIANGLE_MODE];
+
+	sim_reset();
+	Init_TPM0(21);
+	start_restart();
+	Start_DMA_Playback();
+	Start_TPM0();
+
+	Switch_DMA_Playback(ring, RING_SIZE);
+	assert(DMA0->DMA[0].DCR & DMA_DCR_SMOD_MASK);
+	for (uint32_t i = 0; i < 3 * RING_SIZE; i++) {
+		sim_tpm0_overflow();
+		assert(sim_dac0_output() == ring[i % RING_SIZE]);
+	}
+	assert(sim_stats()->irqs == 0);
+
+	Switch_DMA_Playback(w->samples, w->num_samples);
+	assert(!(DMA0->DMA[0].DCR & DMA_DCR_SMOD_MASK));
+	for (uint32_t i = 0; i < 3 * w->num_samples; i++) {
+		sim_tpm0_overflow();
+		assert(sim_dac0_output() == w->samples[i % w->num_samples]);
+	}
+	assert(sim_stats()->irqs == 3);
+}
+
+int main(void) {
+	uint32_t rate;
+
+	sim_reset();
+	Init_TPM0(21);
+	rate = Get_TPM0_Sample_Rate();
+
+	printf("%u Hz for %d s, output gaps per second with the handler late by:\n",
+			rate, SECONDS);
+	printf("%-8s %9s", "mode", "ISRs/s");
+	for (uint32_t late_by = 0; late_by <= MAX_LATENCY; late_by++) {
+		printf(" %7u", late_by);
+	}
+	printf("\n");
+
+	for (size_t m = 0; m < sizeof(modes) / sizeof(modes[0]); m++) {
+		uint32_t irqs;
+		uint32_t missed = play(&modes[m], 0, &irqs);
+
+		printf("%-8s %9.2f", modes[m].name, (double) irqs / SECONDS);
+		for (uint32_t late_by = 0; late_by <= MAX_LATENCY; late_by++) {
+			uint32_t late_irqs;
+
+			missed = play(&modes[m], late_by, &late_irqs);
+			printf(" %7.2f", (double) missed / SECONDS);
+			// The TPM0 request waits a sample for the handler
+			if (late_by <= 1) {
+				assert(missed == 0);
+			}
+		}
+		printf("\n");
+		// No more than an interrupt per pass, or per 5.5 s in ring mode
+		if (modes[m].start == start_ring) {
+			assert(irqs <= SECONDS / 5);
+		}
+	}
+
+	test_switch();
+
+	printf("dac_playback_test: every sample played\n");
+	return 0;
+}
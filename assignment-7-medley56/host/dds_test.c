@@ -0,0 +1,303 @@
+/*
+ * dds_test.c
+ *
+ * Checks ../source/dds.c: the spectral purity of the sine (SINAD
+ * against the ideal sine at the same phases, and SFDR from a windowed
+ * FFT), the frequency accuracy over the audio range measured from
+ * the output, and that changes of frequency, amplitude and waveform
+ * keep the phase going, in blocks of any size.
+ */
+
+#include <assert.h>
+#include <complex.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "dds.h"
+#include "waveforms.h"
+
+#define SAMPLE_RATE (48000000U / (21U * 24U + 1U))  // TPM0 as set up by main()
+#define FFT_BITS 14
+#define FFT_LEN (1U << FFT_BITS)
+#define CARRIER_BINS 6  // the Blackman-Harris main lobe is 4 bins either side
+#define MAX_SAMPLES (2U * SAMPLE_RATE)  // two seconds
+
+#define MIN_SINAD_DB 73.0  // 12-bit quantization alone is 74 dB
+#define MIN_SFDR_DB 85.0
+#define MAX_FREQUENCY_ERROR 2e-6  // relative, measured from the output
+
+static uint16_t out[MAX_SAMPLES];
+static double complex spectrum[FFT_LEN];
+
+/*
+ * Fills n samples in blocks of the given size
+ */
+static void fill(dds_t *dds, uint16_t *samples, uint32_t n, uint32_t block) {
+	for (uint32_t i = 0; i < n; i += block) {
+		dds_fill(dds, samples + i, n - i < block ? n - i : block);
+	}
+}
+
+/*
+ * Starts a tone at full amplitude, skipping the ramp up from silence
+ */
+static void start(dds_t *dds, uint32_t frequency_mhz) {
+	dds_init(dds, SAMPLE_RATE);
+	dds_set_frequency(dds, frequency_mhz);
+	dds_set_amplitude(dds, DAC_MIDL);
+	dds->amplitude = DAC_MIDL;
+}
+
+/*
+ * The ideal waveform at a phase, in DAC codes before rounding
+ */
+static double ideal(uint32_t mode, uint32_t phase, double amplitude) {
+	double cycles = phase / 4294967296.0;
+
+	if (mode == SQUARE_MODE) {
+		return DAC_MIDH + (cycles < 0.5 ? amplitude : -amplitude);
+	} else if (mode == TRIANGLE_MODE) {
+		double t = fmod(cycles + 0.25, 1.0);
+
+		return DAC_MIDH + amplitude * (t < 0.5 ? 4 * t - 1 : 3 - 4 * t);
+	}
+	return DAC_MIDH + amplitude * sin(2 * M_PI * cycles);
+}
+
+static void fft(double complex *x, uint32_t n) {
+	for (uint32_t i = 1, j = 0; i < n; i++) {
+		uint32_t bit = n >> 1;
+
+		for (; j & bit; bit >>= 1) {
+			j ^= bit;
+		}
+		j |= bit;
+		if (i < j) {
+			double complex t = x[i];
+			x[i] = x[j];
+			x[j] = t;
+		}
+	}
+	for (uint32_t len = 2; len <= n; len <<= 1) {
+		double complex w = cexp(-2 * M_PI * I / len);
+
+		for (uint32_t i = 0; i < n; i += len) {
+			double complex wk = 1;
+
+			for (uint32_t k = 0; k < len / 2; k++) {
+				double complex u = x[i + k];
+				double complex v = x[i + k + len / 2] * wk;
+
+				x[i + k] = u + v;
+				x[i + k + len / 2] = u - v;
+				wk *= w;
+			}
+		}
+	}
+}
+
+/*
+ * Spurious-free dynamic range of FFT_LEN samples: the carrier against
+ * the largest other component, DC excluded, in dB
+ */
+static double sfdr_db(const uint16_t *x) {
+	double carrier = 0, spur = 0;
+	uint32_t peak = 0;
+
+	for (uint32_t i = 0; i < FFT_LEN; i++) {
+		double a = 2 * M_PI * i / FFT_LEN;
+		double window = 0.35875 - 0.48829 * cos(a) + 0.14128 * cos(2 * a)
+				- 0.01168 * cos(3 * a);
+
+		spectrum[i] = ((double) x[i] - DAC_MIDH) * window;
+	}
+	fft(spectrum, FFT_LEN);
+	for (uint32_t k = 1; k < FFT_LEN / 2; k++) {
+		if (cabs(spectrum[k]) > carrier) {
+			carrier = cabs(spectrum[k]);
+			peak = k;
+		}
+	}
+	for (uint32_t k = CARRIER_BINS; k < FFT_LEN / 2; k++) {
+		if (abs((int) k - (int) peak) > CARRIER_BINS && cabs(spectrum[k]) > spur) {
+			spur = cabs(spectrum[k]);
+		}
+	}
+	return 20 * log10(carrier / spur);
+}
+
+/*
+ * Full-scale sines at frequencies with no whole number of samples per
+ * period: the error against the ideal sine must be no more than the
+ * DAC's quantization, and no spur may stand out of it
+ */
+static void test_purity(void) {
+	static const uint32_t frequencies_mhz[] = {
+		100000, 440000, 523251, 997300, 1234500, 3141593, 7777777, 12345678
+	};
+	dds_t dds;
+
+	for (size_t f = 0; f < sizeof(frequencies_mhz) / sizeof(frequencies_mhz[0]); f++) {
+		double err_sq = 0, sinad, sfdr;
+		uint32_t phase = 0;
+
+		start(&dds, frequencies_mhz[f]);
+		fill(&dds, out, FFT_LEN, 128);
+
+		for (uint32_t i = 0; i < FFT_LEN; i++) {
+			double e = out[i] - ideal(SINE_MODE, phase, DAC_MIDL);
+
+			err_sq += e * e;
+			phase += dds.increment;
+		}
+		sinad = 20 * log10(DAC_MIDL / sqrt(2) / sqrt(err_sq / FFT_LEN));
+		sfdr = sfdr_db(out);
+		printf("%9.3f Hz: SINAD %.1f dB, SFDR %.1f dB\n",
+				frequencies_mhz[f] / 1000.0, sinad, sfdr);
+		assert(sinad >= MIN_SINAD_DB);
+		assert(sfdr >= MIN_SFDR_DB);
+	}
+}
+
+/*
+ * Frequency from the rising mid-scale crossings of n samples,
+ * interpolated between samples
+ */
+static double measure_frequency(const uint16_t *x, uint32_t n) {
+	double first = -1, last = -1;
+	uint32_t crossings = 0;
+
+	for (uint32_t i = 1; i < n; i++) {
+		double a = (double) x[i - 1] - DAC_MIDH, b = (double) x[i] - DAC_MIDH;
+
+		if (a < 0 && b >= 0) {
+			last = i - 1 + a / (a - b);
+			if (crossings++ == 0) {
+				first = last;
+			}
+		}
+	}
+	assert(crossings >= 2);
+	return (crossings - 1) * (double) SAMPLE_RATE / (last - first);
+}
+
+static void test_frequency(void) {
+	const double resolution_mhz = SAMPLE_RATE * 1000.0 / 4294967296.0;
+	dds_t dds;
+
+	srand(1);
+	for (int k = 0; k < 40; k++) {
+		// Log-spaced from 20 Hz to 20 kHz, at arbitrary millihertz
+		uint32_t f = (uint32_t) (20000 * pow(1000, k / 39.0)) + (uint32_t) rand() % 1000;
+		double measured;
+
+		start(&dds, f);
+		assert(fabs((double) dds_frequency(&dds) - f) <= resolution_mhz / 2 + 1);
+
+		fill(&dds, out, MAX_SAMPLES, 128);
+		measured = measure_frequency(out, MAX_SAMPLES);
+		assert(fabs(measured * 1000 / f - 1) <= MAX_FREQUENCY_ERROR);
+	}
+}
+
+/*
+ * Changes everything at block boundaries of odd sizes: the output must
+ * follow the ideal waveform at the accumulated phase throughout, with
+ * no step in phase at any change
+ */
+static void test_continuity(void) {
+	static const struct {
+		uint32_t mode, frequency_mhz, amplitude, block, n;
+	} steps[] = {
+		{ SINE_MODE,     440000,  DAC_MIDL,     128, 1000 },
+		{ SINE_MODE,     659255,  DAC_MIDL,     7,   777 },
+		{ TRIANGLE_MODE, 659255,  DAC_MIDL,     1,   100 },
+		{ TRIANGLE_MODE, 1234500, DAC_MIDL,     33,  2000 },
+		{ SQUARE_MODE,   311127,  DAC_MIDL,     128, 1500 },
+		{ SINE_MODE,     311127,  DAC_MIDL,     100, 900 },
+	};
+	dds_t dds;
+	uint32_t phase = 0;
+
+	start(&dds, 0);
+	for (size_t s = 0; s < sizeof(steps) / sizeof(steps[0]); s++) {
+		dds_set_tone(&dds, steps[s].mode, steps[s].frequency_mhz, steps[s].amplitude);
+		fill(&dds, out, steps[s].n, steps[s].block);
+
+		for (uint32_t i = 0; i < steps[s].n; i++) {
+			assert(fabs(out[i] - ideal(steps[s].mode, phase, steps[s].amplitude)) <= 1.0);
+			phase += dds.increment;
+		}
+		assert(dds.phase == phase);
+	}
+}
+
+/*
+ * A staged tone plays from the next block whole, not before, and a
+ * tone staged again in the meantime replaces it
+ */
+static void test_staged_tone(void) {
+	dds_t dds;
+	dds_t expected;
+
+	start(&dds, 440000);
+	start(&expected, 0);
+	dds_set_mode(&expected, TRIANGLE_MODE);
+	dds_set_frequency(&expected, 1234500);
+	dds_set_amplitude(&expected, DAC_MIDL / 2);
+
+	dds_set_tone(&dds, SQUARE_MODE, 311127, DAC_MIDL);
+	dds_set_tone(&dds, TRIANGLE_MODE, 1234500, DAC_MIDL / 2);
+	assert(dds.mode == SINE_MODE && dds.target_amplitude == DAC_MIDL);
+	assert(dds_frequency(&dds) == 440000);
+
+	dds_fill(&dds, out, 1);
+	assert(dds.mode == TRIANGLE_MODE && dds.target_amplitude == DAC_MIDL / 2);
+	assert(dds.increment == expected.increment);
+	assert(!dds.staged);
+}
+
+/*
+ * An amplitude change ramps over the next block instead of stepping
+ */
+static void test_amplitude_ramp(void) {
+	const uint32_t block = 128;
+	const uint32_t f = 100000;  // 100 Hz moves at most 14 codes a sample
+	dds_t dds;
+	uint32_t max_step = 0;
+
+	start(&dds, f);
+	dds.amplitude = DAC_MIDL / 8;
+	dds_set_amplitude(&dds, DAC_MIDL / 8);
+	fill(&dds, out, 5 * block, block);
+	dds_set_amplitude(&dds, DAC_MIDL);
+	fill(&dds, out + 5 * block, 5 * block, block);
+	dds_set_amplitude(&dds, 0);
+	fill(&dds, out + 10 * block, 5 * block, block);
+
+	for (uint32_t i = 1; i < 15 * block; i++) {
+		uint32_t step = (uint32_t) abs((int) out[i] - (int) out[i - 1]);
+
+		if (step > max_step) {
+			max_step = step;
+		}
+	}
+	// Slope of a full-scale 100 Hz sine, plus the ramp's step and rounding
+	assert(max_step <= (uint32_t) ceil(DAC_MIDL * 2 * M_PI * f / 1000 / SAMPLE_RATE)
+			+ DAC_MIDL / block + 2);
+	// Silent at the end, and clamped to full scale
+	assert(out[15 * block - 1] == DAC_MIDH);
+	dds_set_amplitude(&dds, 10 * DAC_MIDL);
+	assert(dds.target_amplitude == DAC_MIDL);
+}
+
+int main(void) {
+	test_purity();
+	test_frequency();
+	test_continuity();
+	test_staged_tone();
+	test_amplitude_ramp();
+	printf("dds_test: purity, frequency and phase continuity within limits\n");
+	return 0;
+}
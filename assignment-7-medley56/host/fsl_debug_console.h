@@ -0,0 +1,15 @@
+/*
+ * fsl_debug_console.h
+ *
+ * Host stand-in for utilities/fsl_debug_console.h: PRINTF goes to
+ * stdout.
+ */
+
+#ifndef _FSL_DEBUGCONSOLE_H_
+#define _FSL_DEBUGCONSOLE_H_
+
+#include <stdio.h>
+
+#define PRINTF printf
+
+#endif /* _FSL_DEBUGCONSOLE_H_ */
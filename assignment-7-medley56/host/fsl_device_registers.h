@@ -0,0 +1,66 @@
+/*
+ * fsl_device_registers.h
+ *
+ * Host stand-in for CMSIS/fsl_device_registers.h. It takes the register
+ * layouts and bit fields from the real MKL25Z4.h, but points ADC0, DAC0,
+ * DMA0, DMAMUX0, SIM, TPM0 and TPM1 at ordinary variables that
+ * kl25z_sim.c acts on, and replaces the Cortex-M0+ core header (whose
+ * NVIC functions write to the real NVIC address) with the NVIC model in
+ * kl25z_sim.c. Nothing interrupts the firmware on the host, so masking
+ * interrupts does nothing.
+ *
+ * Build with -no-pie so that static buffers have 32-bit addresses, as
+ * the DMA address registers are 32 bits wide.
+ */
+
+#ifndef __FSL_DEVICE_REGISTERS_H__
+#define __FSL_DEVICE_REGISTERS_H__
+
+#include <stdint.h>
+
+// What MKL25Z4.h needs from core_cm0plus.h, without the rest of it
+#define __CORE_CM0PLUS_H_GENERIC
+#define __CORE_CM0PLUS_H_DEPENDANT
+#define __I   volatile const
+#define __O   volatile
+#define __IO  volatile
+
+#define CPU_MKL25Z128VLK4
+#define KL25Z4_SERIES
+
+#include "MKL25Z4.h"
+
+#undef ADC0
+#undef DAC0
+#undef DMA0
+#undef DMAMUX0
+#undef SIM
+#undef TPM0
+#undef TPM1
+
+extern ADC_Type sim_adc0;
+extern DAC_Type sim_dac0;
+extern DMA_Type sim_dma0;
+extern DMAMUX_Type sim_dmamux0;
+extern SIM_Type sim_sim;
+extern TPM_Type sim_tpm0;
+extern TPM_Type sim_tpm1;
+
+#define ADC0     (&sim_adc0)
+#define DAC0     (&sim_dac0)
+#define DMA0     (&sim_dma0)
+#define DMAMUX0  (&sim_dmamux0)
+#define SIM      (&sim_sim)
+#define TPM0     (&sim_tpm0)
+#define TPM1     (&sim_tpm1)
+
+void NVIC_EnableIRQ(IRQn_Type irq);
+void NVIC_DisableIRQ(IRQn_Type irq);
+void NVIC_ClearPendingIRQ(IRQn_Type irq);
+void NVIC_SetPriority(IRQn_Type irq, uint32_t priority);
+
+static inline uint32_t __get_PRIMASK(void) { return 0; }
+static inline void __set_PRIMASK(uint32_t primask) { (void) primask; }
+static inline void __disable_irq(void) { }
+
+#endif /* __FSL_DEVICE_REGISTERS_H__ */
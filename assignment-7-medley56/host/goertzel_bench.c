@@ -0,0 +1,328 @@
+/*
+ * goertzel_bench.c
+ *
+ * Host benchmark of the Goertzel filter bank in goertzel.c against
+ * autocorrelate_detect_period, on identical 960-sample captures at
+ * 48 kHz. The question is the board's: which of 400, 600 and 800 Hz is
+ * playing, if any? For the autocorrelation, a tone is present if the
+ * period it finds is within TOLERANCE of the tone's.
+ *
+ * The captures are the board's square, sine and triangle waves at each
+ * target frequency, and at frequencies that are not targets, plus
+ * silence, with uniform noise of increasing amplitude. It measures:
+ *
+ *   - accuracy: the share of captures each method gets right
+ *   - the bank's SNR figure for the sine, against the true SNR
+ *   - time per capture, for the bank, the direct autocorrelation and
+ *     the FFT one
+ *   - in streaming mode, the delay from a change of tone to its
+ *     detection, with the bank updated every GOERTZEL_STREAM_BLOCK
+ *     samples, fed in chunks of 128
+ *
+ * Usage: goertzel_bench [-q]
+ *   -q  only run the checks, for make test
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <math.h>
+#include <unistd.h>
+
+#include "autocorrelate.h"
+#include "bench_util.h"
+#include "goertzel.h"
+
+#define SAMPLE_RATE     48000
+#define CAPTURE         960    // 20 ms, whole cycles of each target
+#define TRIALS          40
+#define TOLERANCE       0.05
+#define STREAM_BLOCK    240    // 2, 3 and 4 cycles of the targets
+#define STREAM_CHUNK    128
+#define STEP_SAMPLES    4800   // 100 ms per tone when streaming
+#define TIME_SECONDS    0.2
+
+// Limits for -q
+#define MIN_ACCURACY    0.99   // bank, up to MAX_CLEAN_NOISE
+#define MAX_CLEAN_NOISE 8192
+#define MAX_SNR_ERR_DB  1.0
+#define MIN_CLEAN_SNR_DB 40.0
+#define MAX_AMPLITUDE_ERR 0.02
+#define MAX_STREAM_MS   (2 * STREAM_BLOCK * 1000.0 / SAMPLE_RATE)
+
+static const uint32_t targets[] = { 400, 600, 800 };
+#define NUM_TARGETS (sizeof(targets) / sizeof(targets[0]))
+
+// Target tones, tones that are not targets, and 0 for silence
+static const uint32_t frequencies[] = { 400, 600, 800, 500, 1000, 300, 0 };
+#define NUM_FREQUENCIES (sizeof(frequencies) / sizeof(frequencies[0]))
+
+// Peak noise, in 16-bit ADC codes
+static const int32_t noise_levels[] = { 64, 2048, 8192, 16384, 32768 };
+#define NUM_NOISE_LEVELS (sizeof(noise_levels) / sizeof(noise_levels[0]))
+
+static uint16_t capture[CAPTURE];
+static int32_t work[2048];  // autocorrelate_fft_work_len(CAPTURE)
+static volatile int sink;
+
+/*
+ * Fills the capture at a random phase; returns the true SNR of the
+ * tone against the rest (noise and clipping), in dB
+ */
+static double make_capture(int wave, uint32_t frequency, int32_t noise) {
+	double phase = (rng() % 1000) / 1000.0;
+	double signal = 0, error = 0;
+
+	for (int i = 0; i < CAPTURE; i++) {
+		double p = phase + (double) frequency * i / SAMPLE_RATE;
+		double v = frequency ? wave_value(wave, p) : 0;
+		double ideal = 2047.5 * 16 * v;
+
+		capture[i] = adc_code(v, noise);
+		signal += ideal * ideal;
+		error += pow(capture[i] - 2047.5 * 16 - ideal, 2);
+	}
+	return 10 * log10(signal / error);
+}
+
+/*
+ * The index of the target the tone is, or -1
+ */
+static int expected_target(uint32_t frequency) {
+	for (size_t t = 0; t < NUM_TARGETS; t++) {
+		if (targets[t] == frequency) {
+			return (int) t;
+		}
+	}
+	return -1;
+}
+
+static int detect_autocorrelate(void) {
+	int period;
+
+	period = autocorrelate_detect_period(capture, CAPTURE, kAC_16bps_unsigned);
+	if (period <= 0) {
+		return -1;
+	}
+	for (size_t t = 0; t < NUM_TARGETS; t++) {
+		double expected = (double) SAMPLE_RATE / targets[t];
+
+		if (fabs(period - expected) <= TOLERANCE * expected) {
+			return (int) t;
+		}
+	}
+	return -1;
+}
+
+static int detect_fft(void) {
+	return autocorrelate_detect_period_fft(capture, CAPTURE, kAC_16bps_unsigned,
+			work, sizeof(work) / sizeof(work[0]));
+}
+
+static int detect_goertzel(goertzel_t *g) {
+	goertzel_reset(g);
+	goertzel_process(g, capture, CAPTURE);
+	return goertzel_detect(g);
+}
+
+/*
+ * Checks the bank's amplitude and SNR for full-scale sines, nearly
+ * clean and with some noise. Clean, the SNR only has to come out high:
+ * beyond about 45 dB, the rounding in the filters shows.
+ */
+static bool check_figures(goertzel_t *g) {
+	static const int32_t noise[] = { 64, 4096 };
+	bool ok = true;
+
+	for (size_t n = 0; n < sizeof(noise) / sizeof(noise[0]); n++) {
+		for (size_t t = 0; t < NUM_TARGETS; t++) {
+			double snr = make_capture(SINE, targets[t], noise[n]);
+			double snr_est;
+			double amp_err;
+
+			detect_goertzel(g);
+			snr_est = (double) g->tones[t].snr_db / (1 << GOERTZEL_SNR_FRAC_BITS);
+			amp_err = fabs(g->tones[t].amplitude / (2047.5 * 16) - 1);
+			printf("%4u Hz sine, noise %5d: amplitude %u (%.2f%% off), SNR %.1f dB "
+					"(true %.1f dB), share %.3f\n", targets[t], noise[n],
+					g->tones[t].amplitude, amp_err * 100, snr_est, snr,
+					g->tones[t].share_q16 / 65536.0);
+			if (amp_err > MAX_AMPLITUDE_ERR || (snr < MIN_CLEAN_SNR_DB ?
+					fabs(snr_est - snr) > MAX_SNR_ERR_DB : snr_est < MIN_CLEAN_SNR_DB)) {
+				printf("FAIL: %u Hz amplitude or SNR off\n", targets[t]);
+				ok = false;
+			}
+		}
+	}
+	return ok;
+}
+
+/*
+ * Runs every capture at one noise level through both methods, and
+ * returns the share each got right. The SNR estimate of the bank for
+ * the sines at the targets, and the true one, are averaged.
+ */
+static void accuracy(goertzel_t *g, int32_t noise, double *bank,
+		double *autocorrelation, double *snr_est, double *snr_true) {
+	uint32_t total = 0, bank_right = 0, ac_right = 0, sines = 0;
+
+	*snr_est = *snr_true = 0;
+	for (int w = 0; w < NUM_WAVES; w++) {
+		for (size_t f = 0; f < NUM_FREQUENCIES; f++) {
+			int expected = expected_target(frequencies[f]);
+
+			for (int trial = 0; trial < TRIALS; trial++) {
+				double snr = make_capture(w, frequencies[f], noise);
+
+				bank_right += detect_goertzel(g) == expected;
+				ac_right += detect_autocorrelate() == expected;
+				total++;
+				if (w == SINE && expected >= 0) {
+					*snr_est += (double) g->tones[expected].snr_db
+							/ (1 << GOERTZEL_SNR_FRAC_BITS);
+					*snr_true += snr;
+					sines++;
+				}
+			}
+		}
+	}
+	*bank = (double) bank_right / total;
+	*autocorrelation = (double) ac_right / total;
+	*snr_est /= sines;
+	*snr_true /= sines;
+}
+
+/*
+ * Streams the targets, then silence, then the first target again,
+ * through a bank updated every STREAM_BLOCK samples. Returns the worst
+ * delay from a change to its detection, in milliseconds, or INFINITY.
+ */
+static double stream_latency(goertzel_t *g, int wave, uint32_t *updates) {
+	static const uint32_t steps[] = { 400, 600, 800, 0, 400 };
+	size_t num_steps = sizeof(steps) / sizeof(steps[0]);
+	size_t n = num_steps * STEP_SAMPLES;
+	uint16_t *signal = malloc(n * sizeof(*signal));
+	double phase = 0, worst = 0;
+	size_t detected_at = SIZE_MAX;
+
+	for (size_t i = 0; i < n; i++) {
+		uint32_t f = steps[i / STEP_SAMPLES];
+
+		signal[i] = adc_code(f ? wave_value(wave, phase) : 0, 64);
+		phase += (double) f / SAMPLE_RATE;
+	}
+
+	goertzel_init(g, SAMPLE_RATE, STREAM_BLOCK, targets, NUM_TARGETS);
+	*updates = 0;
+	for (size_t start = 0; start < n; start += STREAM_CHUNK) {
+		size_t len = (n - start < STREAM_CHUNK) ? n - start : STREAM_CHUNK;
+		size_t step = start / STEP_SAMPLES;
+		size_t end = start + len;
+
+		*updates += goertzel_process(g, signal + start, len);
+		if (goertzel_detect(g) == expected_target(steps[step])
+				&& detected_at == SIZE_MAX) {
+			detected_at = end;
+		}
+		// The end of a step: how long did it take?
+		if (end / STEP_SAMPLES != step || end == n) {
+			double ms = (detected_at == SIZE_MAX) ? INFINITY :
+					(detected_at - step * STEP_SAMPLES) * 1000.0 / SAMPLE_RATE;
+
+			worst = fmax(worst, ms);
+			detected_at = SIZE_MAX;
+		}
+	}
+	free(signal);
+	return worst;
+}
+
+/*
+ * Microseconds per capture
+ */
+static double time_per_capture(int (*detect)(void), goertzel_t *g) {
+	uint32_t reps = 0;
+	double t = now();
+
+	while (now() - t < TIME_SECONDS) {
+		sink = detect ? detect() : detect_goertzel(g);
+		reps++;
+	}
+	return (now() - t) / reps * 1e6;
+}
+
+int main(int argc, char *argv[]) {
+	static goertzel_t g;
+	bool quick = false;
+	bool ok = true;
+	int opt;
+
+	while ((opt = getopt(argc, argv, "q")) != -1) {
+		switch (opt) {
+		case 'q':
+			quick = true;
+			break;
+		default:
+			fprintf(stderr, "usage: %s [-q]\n", argv[0]);
+			return 2;
+		}
+	}
+
+	goertzel_init(&g, SAMPLE_RATE, CAPTURE, targets, NUM_TARGETS);
+	ok &= check_figures(&g);
+
+	printf("%d captures of %d samples per noise level, tones %u, %u and %u Hz\n",
+			NUM_WAVES * (int) NUM_FREQUENCIES * TRIALS, CAPTURE, targets[0],
+			targets[1], targets[2]);
+	printf("%11s %9s %11s %14s %14s\n", "peak noise", "bank", "autocorr",
+			"sine SNR est", "sine SNR true");
+	for (size_t n = 0; n < NUM_NOISE_LEVELS; n++) {
+		double bank, autocorrelation, snr_est, snr_true;
+
+		accuracy(&g, noise_levels[n], &bank, &autocorrelation, &snr_est, &snr_true);
+		printf("%11d %8.1f%% %10.1f%% %11.1f dB %11.1f dB\n", noise_levels[n],
+				bank * 100, autocorrelation * 100, snr_est, snr_true);
+		if (noise_levels[n] <= MAX_CLEAN_NOISE && bank < MIN_ACCURACY) {
+			printf("FAIL: bank accuracy at noise %d\n", noise_levels[n]);
+			ok = false;
+		}
+	}
+
+	printf("Streaming, blocks of %d samples (%.1f ms) fed %d at a time\n",
+			STREAM_BLOCK, STREAM_BLOCK * 1000.0 / SAMPLE_RATE, STREAM_CHUNK);
+	for (int w = 0; w < NUM_WAVES; w++) {
+		uint32_t updates;
+		double worst = stream_latency(&g, w, &updates);
+
+		printf("%-9s worst delay to detect a change %.2f ms, %u updates\n",
+				wave_names[w], worst, updates);
+		if (worst > MAX_STREAM_MS || updates != 5 * STEP_SAMPLES / STREAM_BLOCK) {
+			printf("FAIL: %s streaming\n", wave_names[w]);
+			ok = false;
+		}
+	}
+
+	if (!quick) {
+		goertzel_init(&g, SAMPLE_RATE, CAPTURE, targets, NUM_TARGETS);
+		printf("Microseconds per capture     tone    silence\n");
+		make_capture(SINE, 600, 64);
+		double bank_tone = time_per_capture(NULL, &g);
+		double direct_tone = time_per_capture(detect_autocorrelate, NULL);
+		double fft_tone = time_per_capture(detect_fft, NULL);
+		make_capture(SINE, 0, 64);
+		printf("Goertzel bank (%d tones) %9.1f %10.1f\n", (int) NUM_TARGETS, bank_tone,
+				time_per_capture(NULL, &g));
+		printf("autocorrelation, direct  %9.1f %10.1f\n", direct_tone,
+				time_per_capture(detect_autocorrelate, NULL));
+		printf("autocorrelation, FFT     %9.1f %10.1f\n", fft_tone,
+				time_per_capture(detect_fft, NULL));
+	}
+
+	if (!ok) {
+		printf("goertzel_bench: FAILED\n");
+		return 1;
+	}
+	printf("goertzel_bench: all checks within limits\n");
+	return 0;
+}
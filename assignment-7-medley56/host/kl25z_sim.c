@@ -0,0 +1,268 @@
+/*
+ * kl25z_sim.c
+ *
+ * Host model of TPM1-triggered ADC0 conversions, TPM0 DMA requests, the
+ * DAC0 data register, the DMAMUX and the DMA controller, acting on the register variables declared in the host
+ * fsl_device_registers.h. Register writes are plain memory writes, so
+ * write-1-to-clear bits such as DSR_BCR[DONE] are not modelled: the
+ * firmware has to write the byte count after clearing DONE anyway.
+ */
+
+#include <stddef.h>
+#include <string.h>
+
+#include "kl25z_sim.h"
+
+#define DMAMUX_SOURCE_ADC0  40U
+#define DMAMUX_SOURCE_TPM0  54U
+#define ADC0TRGSEL_TPM1     9U
+#define DMA_SIZE_16BIT      2U
+#define NUM_DMA_CHANNELS    4
+
+ADC_Type sim_adc0;
+DAC_Type sim_dac0;
+DMA_Type sim_dma0;
+DMAMUX_Type sim_dmamux0;
+SIM_Type sim_sim;
+TPM_Type sim_tpm0;
+TPM_Type sim_tpm1;
+
+// The firmware under test defines the handlers it uses
+void DMA0_IRQHandler(void) __attribute__((weak));
+void DMA1_IRQHandler(void) __attribute__((weak));
+void DMA2_IRQHandler(void) __attribute__((weak));
+void DMA3_IRQHandler(void) __attribute__((weak));
+
+static uint32_t nvic_enabled;
+static uint32_t nvic_pending;
+static bool hold;
+static bool tpm0_request;
+static sim_stats_t stats;
+
+static void take_irqs(void);
+
+void sim_reset(void) {
+	memset(&sim_adc0, 0, sizeof(sim_adc0));
+	memset(&sim_dac0, 0, sizeof(sim_dac0));
+	memset(&sim_dma0, 0, sizeof(sim_dma0));
+	memset(&sim_dmamux0, 0, sizeof(sim_dmamux0));
+	memset(&sim_sim, 0, sizeof(sim_sim));
+	memset(&sim_tpm0, 0, sizeof(sim_tpm0));
+	memset(&sim_tpm1, 0, sizeof(sim_tpm1));
+	sim_adc0.SC1[0] = ADC_SC1_ADCH(31);  // reset value: module disabled
+	nvic_enabled = 0;
+	nvic_pending = 0;
+	hold = false;
+	tpm0_request = false;
+	stats = (sim_stats_t) { 0 };
+}
+
+void NVIC_EnableIRQ(IRQn_Type irq) {
+	nvic_enabled |= 1U << irq;
+	take_irqs();
+}
+
+void NVIC_DisableIRQ(IRQn_Type irq) {
+	nvic_enabled &= ~(1U << irq);
+}
+
+void NVIC_ClearPendingIRQ(IRQn_Type irq) {
+	nvic_pending &= ~(1U << irq);
+}
+
+void NVIC_SetPriority(IRQn_Type irq, uint32_t priority) {
+	(void) irq;
+	(void) priority;
+}
+
+bool sim_irq_enabled(IRQn_Type irq) {
+	return (nvic_enabled & (1U << irq)) != 0;
+}
+
+const sim_stats_t *sim_stats(void) {
+	return &stats;
+}
+
+static void raise_irq(IRQn_Type irq) {
+	nvic_pending |= 1U << irq;
+	if (!hold) {
+		take_irqs();
+	}
+}
+
+/*
+ * Next address of an incrementing pointer, wrapping within an aligned
+ * buffer of 16 << (mod - 1) bytes if mod is not 0 (SMOD/DMOD)
+ */
+static uint32_t advance(uint32_t addr, uint32_t step, uint32_t mod) {
+	uint32_t size;
+
+	if (mod == 0) {
+		return addr + step;
+	}
+	size = 16U << (mod - 1);
+	return (addr & ~(size - 1)) | ((addr + step) & (size - 1));
+}
+
+/*
+ * One transfer on a channel whose request is asserted. Returns false if
+ * the channel does not take it: not enabled, or its count has run out.
+ */
+static bool dma_transfer(int ch) {
+	volatile uint32_t *dsr_bcr = &sim_dma0.DMA[ch].DSR_BCR;
+	uint32_t dcr = sim_dma0.DMA[ch].DCR;
+	uint32_t bcr = *dsr_bcr & DMA_DSR_BCR_BCR_MASK;
+	uint32_t sar = sim_dma0.DMA[ch].SAR;
+	uint32_t dar = sim_dma0.DMA[ch].DAR;
+	uint16_t v;
+
+	if (!(sim_sim.SCGC7 & SIM_SCGC7_DMA_MASK) || !(dcr & DMA_DCR_ERQ_MASK)
+			|| bcr == 0) {
+		return false;
+	}
+	// Only 16-bit transfers are modelled; anything else is flagged as a
+	// configuration error
+	if (((dcr & DMA_DCR_SSIZE_MASK) >> DMA_DCR_SSIZE_SHIFT) != DMA_SIZE_16BIT
+			|| ((dcr & DMA_DCR_DSIZE_MASK) >> DMA_DCR_DSIZE_SHIFT) != DMA_SIZE_16BIT
+			|| bcr % 2 != 0 || sar % 2 != 0 || dar % 2 != 0) {
+		*dsr_bcr |= DMA_DSR_BCR_CE_MASK | DMA_DSR_BCR_DONE_MASK;
+		return false;
+	}
+
+	v = *(volatile uint16_t *) (uintptr_t) sar;
+	if (sar == (uint32_t) (uintptr_t) &sim_adc0.R[0]) {
+		sim_adc0.SC1[0] &= ~ADC_SC1_COCO_MASK;  // reading R clears COCO
+	}
+	*(volatile uint16_t *) (uintptr_t) dar = v;
+	stats.transfers++;
+
+	if (dcr & DMA_DCR_SINC_MASK) {
+		sim_dma0.DMA[ch].SAR = advance(sar, 2,
+				(dcr & DMA_DCR_SMOD_MASK) >> DMA_DCR_SMOD_SHIFT);
+	}
+	if (dcr & DMA_DCR_DINC_MASK) {
+		sim_dma0.DMA[ch].DAR = advance(dar, 2,
+				(dcr & DMA_DCR_DMOD_MASK) >> DMA_DCR_DMOD_SHIFT);
+	}
+	bcr -= 2;
+	*dsr_bcr = (*dsr_bcr & ~DMA_DSR_BCR_BCR_MASK) | bcr;
+	if (bcr == 0) {
+		*dsr_bcr |= DMA_DSR_BCR_DONE_MASK;
+		if (dcr & DMA_DCR_EINT_MASK) {
+			raise_irq((IRQn_Type) (DMA0_IRQn + ch));
+		}
+	}
+	return true;
+}
+
+/*
+ * A peripheral asserts its DMA request: the first enabled DMAMUX
+ * channel routing that source takes it. Returns false if none did.
+ */
+static bool dma_request(uint32_t source) {
+	if (!(sim_sim.SCGC6 & SIM_SCGC6_DMAMUX_MASK)) {
+		return false;
+	}
+	for (int ch = 0; ch < NUM_DMA_CHANNELS; ch++) {
+		uint8_t chcfg = sim_dmamux0.CHCFG[ch];
+
+		if ((chcfg & DMAMUX_CHCFG_ENBL_MASK)
+				&& (chcfg & DMAMUX_CHCFG_SOURCE_MASK) == source) {
+			return dma_transfer(ch);
+		}
+	}
+	return false;
+}
+
+// ADC0 holds its DMA request for as long as COCO is set
+static void adc_request(void) {
+	if ((sim_adc0.SC1[0] & ADC_SC1_COCO_MASK)
+			&& (sim_adc0.SC2 & ADC_SC2_DMAEN_MASK)) {
+		dma_request(DMAMUX_SOURCE_ADC0);
+	}
+}
+
+// TPM0 holds its DMA request (and TOF) until the DMA acknowledges it,
+// which is before the transfer can raise an interrupt
+static void tpm0_dma_request(void) {
+	if (tpm0_request) {
+		tpm0_request = false;
+		tpm0_request = !dma_request(DMAMUX_SOURCE_TPM0);
+	}
+}
+
+static void take_irqs(void) {
+	static void (*const handlers[NUM_DMA_CHANNELS])(void) = {
+		DMA0_IRQHandler, DMA1_IRQHandler, DMA2_IRQHandler, DMA3_IRQHandler
+	};
+
+	for (int ch = 0; ch < NUM_DMA_CHANNELS; ch++) {
+		uint32_t bit = 1U << (DMA0_IRQn + ch);
+
+		if ((nvic_pending & nvic_enabled & bit) && handlers[ch] != NULL) {
+			nvic_pending &= ~bit;
+			stats.irqs++;
+			handlers[ch]();
+			// A request held while the count was exhausted goes through now
+			adc_request();
+			tpm0_dma_request();
+		}
+	}
+}
+
+void sim_hold_irqs(bool h) {
+	hold = h;
+}
+
+void sim_run_irqs(void) {
+	take_irqs();
+}
+
+void sim_tpm1_overflow(uint16_t analog) {
+	uint32_t mode;
+
+	if (!(sim_sim.SCGC6 & SIM_SCGC6_TPM1_MASK)
+			|| (sim_tpm1.SC & TPM_SC_CMOD_MASK) == 0) {
+		return;
+	}
+	// TPM1 overflow reaches ADC0 only as its alternate hardware trigger
+	if (!(sim_sim.SCGC6 & SIM_SCGC6_ADC0_MASK)
+			|| !(sim_sim.SOPT7 & SIM_SOPT7_ADC0ALTTRGEN_MASK)
+			|| ((sim_sim.SOPT7 & SIM_SOPT7_ADC0TRGSEL_MASK)
+					>> SIM_SOPT7_ADC0TRGSEL_SHIFT) != ADC0TRGSEL_TPM1
+			|| !(sim_adc0.SC2 & ADC_SC2_ADTRG_MASK)
+			|| (sim_adc0.SC1[0] & ADC_SC1_ADCH_MASK) == ADC_SC1_ADCH(31)) {
+		return;
+	}
+
+	stats.triggers++;
+	if (sim_adc0.SC1[0] & ADC_SC1_COCO_MASK) {
+		stats.overwritten++;
+	}
+	// MODE: 0 8-bit, 1 12-bit, 2 10-bit, 3 16-bit, right justified
+	mode = (sim_adc0.CFG1 & ADC_CFG1_MODE_MASK) >> ADC_CFG1_MODE_SHIFT;
+	*(volatile uint32_t *) &sim_adc0.R[0] =  // read-only to the firmware
+			analog >> ((const int[]) { 8, 4, 6, 0 })[mode];
+	sim_adc0.SC1[0] |= ADC_SC1_COCO_MASK;
+	adc_request();
+}
+
+void sim_tpm0_overflow(void) {
+	if (!(sim_sim.SCGC6 & SIM_SCGC6_TPM0_MASK)
+			|| (sim_tpm0.SC & TPM_SC_CMOD_MASK) == 0
+			|| !(sim_tpm0.SC & TPM_SC_DMA_MASK)) {
+		return;
+	}
+
+	stats.tpm0_requests++;
+	if (tpm0_request) {
+		stats.tpm0_missed++;
+	}
+	tpm0_request = true;
+	tpm0_dma_request();
+}
+
+uint16_t sim_dac0_output(void) {
+	return (uint16_t) (((sim_dac0.DAT[0].DATH & DAC_DATH_DATA1_MASK) << 8)
+			| sim_dac0.DAT[0].DATL);
+}
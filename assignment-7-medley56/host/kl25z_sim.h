@@ -0,0 +1,69 @@
+/*
+ * kl25z_sim.h
+ *
+ * Host model of the parts of the KL25Z that the ADC capture and the DAC
+ * playback use: TPM1 overflow as the ADC0 hardware trigger, ADC0
+ * conversions, TPM0 overflow as a DMA request, the DAC0 data register,
+ * the DMAMUX, the four DMA channels and their NVIC interrupts. The model
+ * only moves data if the registers are set up the way the hardware needs
+ * them.
+ */
+
+#ifndef KL25Z_SIM_H_
+#define KL25Z_SIM_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "fsl_device_registers.h"
+
+typedef struct {
+	uint32_t triggers;     // TPM1 overflows that started a conversion
+	uint32_t overwritten;  // results replaced before the DMA read them
+	uint32_t transfers;    // DMA transfers, all channels
+	uint32_t irqs;         // DMA interrupts taken, all channels
+	uint32_t tpm0_requests;  // TPM0 overflows that requested a DMA transfer
+	uint32_t tpm0_missed;    // of which the DMA had not taken the previous one
+} sim_stats_t;
+
+/*
+ * Clears every register, the NVIC and the statistics
+ */
+void sim_reset(void);
+
+/*
+ * One overflow of TPM1. If TPM1 is running and is the ADC0 hardware
+ * trigger, ADC0 converts analog (the 16-bit result), and its DMA
+ * request is serviced by the DMA channel the DMAMUX routes it to,
+ * including the channel's interrupt when its byte count runs out.
+ */
+void sim_tpm1_overflow(uint16_t analog);
+
+/*
+ * One overflow of TPM0. If TPM0 is running with DMA requests enabled,
+ * the DMA channel the DMAMUX routes it to makes one transfer, as soon
+ * as it can. The request stays asserted until then; an overflow while
+ * it still is counts as missed, as the DAC sample due then never came.
+ */
+void sim_tpm0_overflow(void);
+
+/*
+ * The 12-bit code in the DAC0 data register, i.e. what it outputs
+ */
+uint16_t sim_dac0_output(void);
+
+/*
+ * Holds DMA interrupts pending (true) instead of taking them at once,
+ * to model a handler that runs late; sim_run_irqs() takes them.
+ */
+void sim_hold_irqs(bool hold);
+void sim_run_irqs(void);
+
+/*
+ * Is the interrupt enabled in the NVIC?
+ */
+bool sim_irq_enabled(IRQn_Type irq);
+
+const sim_stats_t *sim_stats(void);
+
+#endif /* KL25Z_SIM_H_ */
@@ -0,0 +1,212 @@
+/*
+ * period_bench.c
+ *
+ * Host accuracy sweep of autocorrelate_detect_period_frac, the period
+ * to a fraction of a sample, against autocorrelate_detect_period, the
+ * period in whole samples, on the board's 1024-sample captures at
+ * 48 kHz.
+ *
+ * The captures are square, sine and triangle waves at NUM_FREQUENCIES
+ * frequencies spread logarithmically over 150-3000 Hz (periods of 320
+ * down to 16 samples, mostly not whole), each at several phases, with
+ * uniform noise of increasing amplitude. For each wave and noise level
+ * it reports the median and worst error of the frequency from each,
+ * the sampling rate over the period, and how often neither finds a
+ * period. It also checks that the FFT version agrees with the direct
+ * one, and times both.
+ *
+ * Usage: period_bench [-q]
+ *   -q  only run the checks, for make test
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <math.h>
+#include <unistd.h>
+
+#include "autocorrelate.h"
+#include "bench_util.h"
+
+#define SAMPLE_RATE     48000
+#define CAPTURE         1024
+#define NUM_FREQUENCIES 64
+#define MIN_FREQUENCY   150.0
+#define MAX_FREQUENCY   3000.0
+#define PHASES          4
+#define NUM_RESULTS     (NUM_FREQUENCIES * PHASES)
+#define TIME_SECONDS    0.2
+
+// Limits for -q, up to MAX_CLEAN_NOISE: the worst frequency error of
+// the fractional period (the square wave's, whose correlation peaks in
+// a corner that a parabola fits worst), and how much better its median
+// must be
+#define MAX_CLEAN_NOISE 2048
+#define MAX_FRAC_ERR    0.006
+#define MIN_GAIN        4.0
+// The FFT and direct versions round differently, in 1/256 sample
+#define MAX_FFT_DIFF    8
+
+// Peak noise, in 16-bit ADC codes
+static const int32_t noise_levels[] = { 64, 2048, 8192, 16384 };
+#define NUM_NOISE_LEVELS (sizeof(noise_levels) / sizeof(noise_levels[0]))
+
+static uint16_t capture[CAPTURE];
+static int32_t work[2 * CAPTURE];
+static volatile int32_t sink;
+
+/*
+ * Fills the capture with the wave as the DAC code 0-4095 scaled to the
+ * 16-bit ADC, plus noise, clipped as the ADC would
+ */
+static void make_capture(int wave, double frequency, double phase, int32_t noise) {
+	for (int i = 0; i < CAPTURE; i++) {
+		capture[i] = adc_code(wave_value(wave, phase + frequency * i / SAMPLE_RATE), noise);
+	}
+}
+
+static double frequency_at(int f) {
+	return MIN_FREQUENCY * pow(MAX_FREQUENCY / MIN_FREQUENCY, (double) f / (NUM_FREQUENCIES - 1));
+}
+
+/*
+ * Runs every frequency and phase of a wave at one noise level. Fills
+ * in the relative frequency errors of the whole and fractional periods,
+ * and returns how many captures gave no period. Sets *fft_diff to the
+ * largest difference between the direct and FFT fractional periods.
+ */
+static int sweep(int wave, int32_t noise, double *whole_err, double *frac_err,
+		int32_t *fft_diff) {
+	int missed = 0;
+
+	*fft_diff = 0;
+	for (int f = 0; f < NUM_FREQUENCIES; f++) {
+		double frequency = frequency_at(f);
+
+		for (int p = 0; p < PHASES; p++) {
+			int r = f * PHASES + p;
+			int period;
+			int32_t frac, fft_frac;
+
+			make_capture(wave, frequency, (double) p / PHASES + 0.1, noise);
+			period = autocorrelate_detect_period(capture, CAPTURE, kAC_16bps_unsigned);
+			frac = autocorrelate_detect_period_frac(capture, CAPTURE, kAC_16bps_unsigned);
+			fft_frac = autocorrelate_detect_period_fft_frac(capture, CAPTURE,
+					kAC_16bps_unsigned, work, sizeof(work) / sizeof(work[0]));
+			if (period <= 0 || frac <= 0) {
+				missed++;
+				whole_err[r] = frac_err[r] = INFINITY;
+				continue;
+			}
+			whole_err[r] = fabs((double) SAMPLE_RATE / period / frequency - 1);
+			frac_err[r] = fabs((double) (SAMPLE_RATE << AUTOCORRELATE_FRAC_BITS) / frac
+					/ frequency - 1);
+			if (abs(fft_frac - frac) > *fft_diff) {
+				*fft_diff = abs(fft_frac - frac);
+			}
+		}
+	}
+	return missed;
+}
+
+static double worst(const double *v, int n) {
+	double w = 0;
+
+	for (int i = 0; i < n; i++) {
+		w = fmax(w, v[i]);
+	}
+	return w;
+}
+
+static void run_whole(void) {
+	sink = autocorrelate_detect_period(capture, CAPTURE, kAC_16bps_unsigned);
+}
+
+static void run_frac(void) {
+	sink = autocorrelate_detect_period_frac(capture, CAPTURE, kAC_16bps_unsigned);
+}
+
+static void run_fft(void) {
+	sink = autocorrelate_detect_period_fft(capture, CAPTURE, kAC_16bps_unsigned,
+			work, sizeof(work) / sizeof(work[0]));
+}
+
+static void run_fft_frac(void) {
+	sink = autocorrelate_detect_period_fft_frac(capture, CAPTURE, kAC_16bps_unsigned,
+			work, sizeof(work) / sizeof(work[0]));
+}
+
+/*
+ * Microseconds per capture
+ */
+static double time_per_capture(void (*run)(void)) {
+	uint32_t reps = 0;
+	double t = now();
+
+	while (now() - t < TIME_SECONDS) {
+		run();
+		reps++;
+	}
+	return (now() - t) / reps * 1e6;
+}
+
+int main(int argc, char *argv[]) {
+	static double whole_err[NUM_RESULTS], frac_err[NUM_RESULTS];
+	bool quick = false;
+	bool ok = true;
+	int opt;
+
+	while ((opt = getopt(argc, argv, "q")) != -1) {
+		switch (opt) {
+		case 'q':
+			quick = true;
+			break;
+		default:
+			fprintf(stderr, "usage: %s [-q]\n", argv[0]);
+			return 2;
+		}
+	}
+
+	printf("Frequency error, %d frequencies over %.0f-%.0f Hz x %d phases, %d samples\n",
+			NUM_FREQUENCIES, MIN_FREQUENCY, MAX_FREQUENCY, PHASES, CAPTURE);
+	printf("%-9s %6s %9s %9s %9s %9s %7s %9s\n", "wave", "noise", "whole med",
+			"worst", "frac med", "worst", "missed", "fft diff");
+	for (int w = 0; w < NUM_WAVES; w++) {
+		for (size_t n = 0; n < NUM_NOISE_LEVELS; n++) {
+			int32_t fft_diff;
+			int missed = sweep(w, noise_levels[n], whole_err, frac_err, &fft_diff);
+			double whole_worst = worst(whole_err, NUM_RESULTS);
+			double frac_worst = worst(frac_err, NUM_RESULTS);
+			double whole_med = median(whole_err, NUM_RESULTS);
+			double frac_med = median(frac_err, NUM_RESULTS);
+
+			printf("%-9s %6d %8.3f%% %8.3f%% %8.3f%% %8.3f%% %7d %9.2f\n", wave_names[w],
+					noise_levels[n], whole_med * 100, whole_worst * 100, frac_med * 100,
+					frac_worst * 100, missed, (double) fft_diff / (1 << AUTOCORRELATE_FRAC_BITS));
+			if (noise_levels[n] <= MAX_CLEAN_NOISE && (missed > 0
+					|| frac_worst > MAX_FRAC_ERR || frac_med * MIN_GAIN > whole_med
+					|| fft_diff > MAX_FFT_DIFF)) {
+				printf("FAIL: %s at noise %d\n", wave_names[w], noise_levels[n]);
+				ok = false;
+			}
+		}
+	}
+
+	if (!quick) {
+		printf("Microseconds per capture, 600 Hz sine   whole   fraction\n");
+		make_capture(SINE, 600, 0.1, 64);
+		printf("autocorrelation, direct              %8.1f %10.1f\n",
+				time_per_capture(run_whole), time_per_capture(run_frac));
+		printf("autocorrelation, FFT                 %8.1f %10.1f\n",
+				time_per_capture(run_fft), time_per_capture(run_fft_frac));
+	}
+
+	if (!ok) {
+		printf("period_bench: FAILED\n");
+		return 1;
+	}
+	printf("period_bench: all checks within limits\n");
+	return 0;
+}
@@ -0,0 +1,294 @@
+/*
+ * pitch_bench.c
+ *
+ * Host harness for the streaming pitch detector in pitch.c. It feeds
+ * synthetic ADC samples at 48 kHz, a block at a time, and measures:
+ *
+ *   - latency: after each frequency step, the time until the estimate
+ *     settles within TOLERANCE of the new frequency and stays there
+ *   - tracking: the error of every estimate during a chirp, against
+ *     the frequency in the middle of the detector's window
+ *   - CPU: host time per input sample, against recomputing
+ *     autocorrelate_detect_period over the last 1024 samples every
+ *     block, which is what a fresh estimate per block would cost with
+ *     the one-shot detector
+ *
+ * The signals are the board's square, sine and triangle waves: a 12-bit
+ * DAC read back by the 16-bit ADC, with a few LSBs of noise.
+ *
+ * Usage: pitch_bench [-b block] [-q]
+ *   -b  samples per block, default 128
+ *   -q  only run the checks, for make test
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <math.h>
+#include <unistd.h>
+
+#include "autocorrelate.h"
+#include "bench_util.h"
+#include "pitch.h"
+
+#define SAMPLE_RATE     48000
+#define STEP_SECONDS    0.25
+#define CHIRP_SECONDS   2.0
+#define CHIRP_LOW       250.0
+#define CHIRP_HIGH      2500.0
+#define TOLERANCE       0.02   // settled within 2%
+#define NOISE_LSB       64     // peak ADC noise, in 16-bit LSBs
+#define ONESHOT_SAMPLES 1024
+#define CPU_SECONDS     10.0
+#define MAX_BLOCK       4096
+
+// Limits for -q; the latency limit grows by two blocks
+#define MAX_LATENCY_MS  10.0
+#define MAX_MEDIAN_ERR  0.005
+#define MAX_P95_ERR     0.03
+#define MIN_VOICED      0.95
+
+// Frequency steps, covering the board's 400, 600 and 800 Hz
+static const double steps[] = { 400, 600, 800, 400, 250, 1500, 800 };
+#define NUM_STEPS (sizeof(steps) / sizeof(steps[0]))
+
+static uint16_t *signal;
+static double *freq;  // instantaneous frequency of each sample
+static uint32_t block = 128;
+static volatile int sink;
+
+/*
+ * Fills signal and freq with the steps, or with a logarithmic chirp,
+ * keeping the phase continuous. Returns the number of samples.
+ */
+static size_t make_steps(int wave) {
+	size_t per_step = (size_t) (STEP_SECONDS * SAMPLE_RATE);
+	double phase = 0;
+	size_t n = 0;
+
+	for (size_t s = 0; s < NUM_STEPS; s++) {
+		for (size_t i = 0; i < per_step; i++, n++) {
+			freq[n] = steps[s];
+			signal[n] = adc_code(wave_value(wave, phase), NOISE_LSB);
+			phase += steps[s] / SAMPLE_RATE;
+		}
+	}
+	return n;
+}
+
+static size_t make_chirp(int wave) {
+	size_t n = (size_t) (CHIRP_SECONDS * SAMPLE_RATE);
+	double phase = 0;
+
+	for (size_t i = 0; i < n; i++) {
+		freq[i] = CHIRP_LOW * pow(CHIRP_HIGH / CHIRP_LOW, (double) i / n);
+		signal[i] = adc_code(wave_value(wave, phase), NOISE_LSB);
+		phase += freq[i] / SAMPLE_RATE;
+	}
+	return n;
+}
+
+static double to_hz(int32_t period) {
+	return (double) SAMPLE_RATE * (1 << PITCH_FRAC_BITS) / period;
+}
+
+static bool settled(int32_t period, double target) {
+	return period > 0 && fabs(to_hz(period) - target) <= TOLERANCE * target;
+}
+
+/*
+ * Runs the steps through the detector and returns the worst latency
+ * from a step to the estimate settling, in milliseconds, or INFINITY
+ * if some step never settled
+ */
+static double step_latency(int wave, double *mean_ms) {
+	static pitch_t p;
+	size_t n = make_steps(wave);
+	size_t per_step = n / NUM_STEPS;
+	size_t step = 0;
+	size_t settled_at = SIZE_MAX;  // end of the block since which it is settled
+	double worst = 0, total = 0;
+
+	pitch_reset(&p);
+	for (size_t start = 0; start <= n; start += block) {
+		size_t len = (n - start < block) ? n - start : block;
+		size_t end = start + len;
+		int32_t period;
+
+		// A block ending in the next step, or the end: how long after its
+		// step did the last one settle? The first step also fills the
+		// history from nothing, so it does not count.
+		if (len == 0 || (end - 1) / per_step != step) {
+			double ms = (settled_at == SIZE_MAX) ? INFINITY :
+					(settled_at - step * per_step) * 1000.0 / SAMPLE_RATE;
+
+			if (step > 0) {
+				worst = fmax(worst, ms);
+				total += ms;
+			}
+			if (len == 0) {
+				break;
+			}
+			step = (end - 1) / per_step;
+			settled_at = SIZE_MAX;
+		}
+
+		period = pitch_process(&p, signal + start, len);
+		if (!settled(period, steps[step])) {
+			settled_at = SIZE_MAX;
+		} else if (settled_at == SIZE_MAX) {
+			settled_at = end;
+		}
+	}
+	*mean_ms = total / (NUM_STEPS - 1);
+	return worst;
+}
+
+/*
+ * Runs the chirp through the detector and returns the fraction of
+ * blocks with an estimate, and the median and 95th percentile of the
+ * relative error of those estimates
+ */
+static double chirp_error(int wave, double *median, double *p95) {
+	static pitch_t p;
+	size_t n = make_chirp(wave);
+	size_t blocks = 0, voiced = 0;
+	double *err = malloc((n / block + 1) * sizeof(*err));
+
+	pitch_reset(&p);
+	for (size_t start = 0; start < n; start += block) {
+		size_t len = (n - start < block) ? n - start : block;
+		int32_t period = pitch_process(&p, signal + start, len);
+		size_t end = start + len;
+		size_t window = PITCH_WINDOW * PITCH_DECIMATION;
+
+		if (end < (PITCH_WINDOW + PITCH_MAX_LAG) * PITCH_DECIMATION) {
+			continue;
+		}
+		blocks++;
+		if (period > 0) {
+			// The window holds the last PITCH_WINDOW samples and the lag
+			// reaches one period further back
+			size_t mid = end - (window + (period >> PITCH_FRAC_BITS)) / 2;
+
+			err[voiced++] = fabs(to_hz(period) - freq[mid]) / freq[mid];
+		}
+	}
+	qsort(err, voiced, sizeof(*err), cmp_double);
+	*median = voiced ? err[voiced / 2] : INFINITY;
+	*p95 = voiced ? err[voiced * 95 / 100] : INFINITY;
+	free(err);
+	return (double) voiced / blocks;
+}
+
+/*
+ * Nanoseconds per input sample for the streaming detector, and for
+ * autocorrelating the last ONESHOT_SAMPLES samples after every block
+ */
+static void cpu_per_sample(double *streaming, double *oneshot) {
+	static pitch_t p;
+	size_t n = make_steps(SQUARE);
+	size_t total = 0;
+	double t;
+	uint16_t copy[ONESHOT_SAMPLES];
+
+	pitch_reset(&p);
+	t = now();
+	while (total < CPU_SECONDS * SAMPLE_RATE) {
+		for (size_t start = 0; start < n; start += block) {
+			size_t len = (n - start < block) ? n - start : block;
+
+			sink = pitch_process(&p, signal + start, len);
+		}
+		total += n;
+	}
+	*streaming = (now() - t) * 1e9 / total;
+
+	total = 0;
+	t = now();
+	for (size_t end = ONESHOT_SAMPLES; end <= n; end += block) {
+		for (size_t i = 0; i < ONESHOT_SAMPLES; i++) {
+			copy[i] = signal[end - ONESHOT_SAMPLES + i];
+		}
+		sink = autocorrelate_detect_period(copy, ONESHOT_SAMPLES,
+				kAC_16bps_unsigned);
+		total += block;
+	}
+	*oneshot = (now() - t) * 1e9 / total;
+}
+
+int main(int argc, char *argv[]) {
+	size_t max_n = (size_t) (fmax(NUM_STEPS * STEP_SECONDS, CHIRP_SECONDS)
+			* SAMPLE_RATE) + 1;
+	bool quick = false;
+	bool ok = true;
+	int opt;
+
+	while ((opt = getopt(argc, argv, "b:q")) != -1) {
+		switch (opt) {
+		case 'b':
+			block = (uint32_t) atoi(optarg);
+			break;
+		case 'q':
+			quick = true;
+			break;
+		default:
+			fprintf(stderr, "usage: %s [-b block] [-q]\n", argv[0]);
+			return 2;
+		}
+	}
+	if (block < 1 || block > MAX_BLOCK) {
+		fprintf(stderr, "%s: block must be 1-%d\n", argv[0], MAX_BLOCK);
+		return 2;
+	}
+
+	signal = malloc(max_n * sizeof(*signal));
+	freq = malloc(max_n * sizeof(*freq));
+	if (signal == NULL || freq == NULL) {
+		fprintf(stderr, "%s: out of memory\n", argv[0]);
+		return 1;
+	}
+
+	printf("Blocks of %u samples (%.2f ms) at %d Hz; detector at %d Hz, "
+			"%u-%u lags\n", (unsigned) block, block * 1000.0 / SAMPLE_RATE,
+			SAMPLE_RATE, SAMPLE_RATE / (int) PITCH_DECIMATION,
+			(unsigned) PITCH_MIN_LAG, (unsigned) PITCH_MAX_LAG);
+	printf("%-9s %12s %12s %9s %11s %11s\n", "wave", "worst step", "mean step",
+			"voiced", "median err", "95% err");
+	for (int w = 0; w < NUM_WAVES; w++) {
+		double worst, mean, voiced, median, p95;
+
+		worst = step_latency(w, &mean);
+		voiced = chirp_error(w, &median, &p95);
+		printf("%-9s %9.2f ms %9.2f ms %8.1f%% %10.2f%% %10.2f%%\n",
+				wave_names[w], worst, mean, voiced * 100, median * 100,
+				p95 * 100);
+		if (worst > MAX_LATENCY_MS + 2 * block * 1000.0 / SAMPLE_RATE
+				|| median > MAX_MEDIAN_ERR
+				|| p95 > MAX_P95_ERR || voiced < MIN_VOICED) {
+			printf("FAIL: %s exceeds the limits\n", wave_names[w]);
+			ok = false;
+		}
+	}
+
+	if (!quick) {
+		double streaming, oneshot;
+
+		cpu_per_sample(&streaming, &oneshot);
+		printf("CPU per input sample: %.1f ns streaming (%u lag updates), "
+				"%.1f ns autocorrelating the last %d every block\n", streaming,
+				(unsigned) (PITCH_MAX_LAG / PITCH_DECIMATION), oneshot,
+				ONESHOT_SAMPLES);
+	}
+
+	free(signal);
+	free(freq);
+	if (!ok) {
+		return 1;
+	}
+	if (quick) {
+		printf("pitch_bench: all waves within limits\n");
+	}
+	return 0;
+}
@@ -0,0 +1,226 @@
+/*
+ * trig_bench.c
+ *
+ * Host benchmark of the sine functions in ../source/fp_trig.c: the
+ * lookup table, CORDIC and the Taylor series, against the C library.
+ *
+ * Accuracy is measured by test_sin_function from ../source/test_sine.c,
+ * with the limits the board checks at startup, for each variant. The
+ * inverses are checked against asin and acos, and the batch functions
+ * against calling fp_sin and fp_cos one angle at a time.
+ *
+ * Throughput is the time per sine over NUM_ANGLES angles spread over
+ * several periods, one call per angle or a batch call for all of them.
+ * Each is warmed up and then timed over several samples; the median is
+ * reported. Times are for the host, not the M0+, which has no divider
+ * or FPU: that makes the Taylor series, with 64-bit divisions, and the
+ * C library, in software floating point, relatively slower still.
+ *
+ * Built twice: as is, and with FP_TRIG_CORDIC (no lookup tables).
+ *
+ * Usage: trig_bench [-s samples] [-q]
+ *   -q  only run the checks, for make test
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <math.h>
+#include <unistd.h>
+
+#include "bench_util.h"
+#include "fp_trig.h"
+#include "test_sine.h"
+
+#define NUM_ANGLES      4096
+#define DEFAULT_SAMPLES 7
+#define MAX_SAMPLES     101
+#define SAMPLE_SECONDS  0.02
+
+// Worst error of fp_asin, in scaled radians, away from and near +-1,
+// where asin is too steep for TRIG_SCALE_FACTOR steps of its input
+#define ASIN_MAX_ERR        2.0
+#define ASIN_STEEP_FROM     2000
+#define ASIN_STEEP_MAX_ERR  8.0
+
+#ifdef FP_TRIG_CORDIC
+#define BUILD "CORDIC"
+#else
+#define BUILD "lookup table"
+#endif
+
+typedef void (*sin_batch_fn_t)(void);
+
+static int32_t angles[NUM_ANGLES];
+static int32_t results[NUM_ANGLES];
+static volatile int32_t sink;
+
+static int32_t libm_sin(int32_t x) {
+	return (int32_t) lround(sin((double) x / TRIG_SCALE_FACTOR) * TRIG_SCALE_FACTOR);
+}
+
+/*
+ * Checks fp_asin and fp_acos against the C library over their whole
+ * input range, and prints the worst errors
+ */
+static bool check_inverses(void) {
+	double max_err = 0, steep_max_err = 0, acos_max_err = 0;
+
+	for (int32_t x = -TRIG_SCALE_FACTOR; x <= TRIG_SCALE_FACTOR; x++) {
+		double a = asin((double) x / TRIG_SCALE_FACTOR) * TRIG_SCALE_FACTOR;
+		double err = fabs(fp_asin(x) - a);
+		double acos_err = fabs(fp_acos(x) - (HALF_PI - a));
+
+		if (abs(x) >= ASIN_STEEP_FROM) {
+			steep_max_err = fmax(steep_max_err, err);
+		} else {
+			max_err = fmax(max_err, err);
+		}
+		acos_max_err = fmax(acos_max_err, acos_err - err);
+	}
+	printf("fp_asin: max_err=%f, %f from |x| = %d\n", max_err, steep_max_err,
+			ASIN_STEEP_FROM);
+	// fp_acos is fp_asin from HALF_PI, which is itself 0.31 out
+	return max_err <= ASIN_MAX_ERR && steep_max_err <= ASIN_STEEP_MAX_ERR
+			&& acos_max_err <= 0.5;
+}
+
+/*
+ * Checks the batch functions against fp_sin and fp_cos, and the degree
+ * conversion
+ */
+static bool check_batches(void) {
+	static const int32_t steps[] = { 1, 7, -7, 100, HALF_PI, TWO_PI - 1, -TWO_PI - 5,
+			3 * TWO_PI + 11 };
+	bool ok = true;
+
+	fp_sin_batch(angles, results, NUM_ANGLES);
+	for (int i = 0; i < NUM_ANGLES; i++) {
+		ok &= results[i] == fp_sin(angles[i]);
+	}
+	fp_cos_batch(angles, results, NUM_ANGLES);
+	for (int i = 0; i < NUM_ANGLES; i++) {
+		ok &= results[i] == fp_cos(angles[i]);
+	}
+	for (size_t s = 0; s < sizeof(steps) / sizeof(steps[0]); s++) {
+		int32_t x0 = (int32_t) (rng() % (8 * TWO_PI)) - 4 * TWO_PI;
+
+		fp_sin_ramp(x0, steps[s], results, NUM_ANGLES);
+		for (int i = 0; i < NUM_ANGLES; i++) {
+			ok &= results[i] == fp_sin(x0 + i * steps[s]);
+		}
+	}
+	ok &= fp_radians(90) == HALF_PI && fp_radians(-180) == -PI && fp_radians(360) == 2 * PI;
+	if (!ok) {
+		printf("MISMATCH: batch functions or fp_radians\n");
+	}
+	return ok;
+}
+
+static void each(int32_t (*fn)(int32_t)) {
+	for (int i = 0; i < NUM_ANGLES; i++) {
+		results[i] = fn(angles[i]);
+	}
+}
+
+static void run_lookup(void) { each(fp_sin); }
+static void run_cordic(void) { each(cordic_fp_sin); }
+static void run_taylor(void) { each(taylor_fp_sin); }
+static void run_libm(void) { each(libm_sin); }
+static void run_batch(void) { fp_sin_batch(angles, results, NUM_ANGLES); }
+static void run_ramp(void) { fp_sin_ramp(angles[0], 97, results, NUM_ANGLES); }
+
+/*
+ * Returns the median time per sine in nanoseconds
+ */
+static double time_method(sin_batch_fn_t run, int samples) {
+	double times[MAX_SAMPLES];
+	uint64_t reps = 1;
+	double t;
+
+	// Warm up, and find enough repetitions for one sample
+	for (;;) {
+		t = now();
+		for (uint64_t r = 0; r < reps; r++) {
+			run();
+			sink = results[r % NUM_ANGLES];
+		}
+		t = now() - t;
+		if (t >= SAMPLE_SECONDS) {
+			break;
+		}
+		reps *= 2;
+	}
+
+	for (int s = 0; s < samples; s++) {
+		t = now();
+		for (uint64_t r = 0; r < reps; r++) {
+			run();
+			sink = results[r % NUM_ANGLES];
+		}
+		times[s] = (now() - t) / reps / NUM_ANGLES * 1e9;
+	}
+	return median(times, samples);
+}
+
+int main(int argc, char *argv[]) {
+	static const struct {
+		const char *name;
+		sin_batch_fn_t run;
+	} methods[] = {
+		{ "fp_sin (" BUILD ")", run_lookup },
+		{ "cordic_fp_sin", run_cordic },
+		{ "taylor_fp_sin", run_taylor },
+		{ "C library sin", run_libm },
+		{ "fp_sin_batch", run_batch },
+		{ "fp_sin_ramp", run_ramp },
+	};
+	int samples = DEFAULT_SAMPLES;
+	bool quick = false;
+	bool ok = true;
+	int opt;
+
+	while ((opt = getopt(argc, argv, "s:q")) != -1) {
+		switch (opt) {
+		case 's':
+			samples = atoi(optarg);
+			break;
+		case 'q':
+			quick = true;
+			break;
+		default:
+			fprintf(stderr, "usage: %s [-s samples] [-q]\n", argv[0]);
+			return 2;
+		}
+	}
+	if (samples < 1 || samples > MAX_SAMPLES) {
+		fprintf(stderr, "%s: samples must be 1-%d\n", argv[0], MAX_SAMPLES);
+		return 2;
+	}
+
+	for (int i = 0; i < NUM_ANGLES; i++) {
+		angles[i] = (int32_t) (rng() % (8 * TWO_PI)) - 4 * TWO_PI;
+	}
+
+	printf("%s build\n", BUILD);
+	ok &= test_sin_function("fp_sin", fp_sin);
+	ok &= test_sin_function("cordic_fp_sin", cordic_fp_sin);
+	ok &= test_sin_function("taylor_fp_sin", taylor_fp_sin);
+	ok &= check_inverses();
+	ok &= check_batches();
+
+	if (!quick) {
+		printf("Nanoseconds per sine, %d angles over 8 periods\n", NUM_ANGLES);
+		for (size_t m = 0; m < sizeof(methods) / sizeof(methods[0]); m++) {
+			printf("%-24s %8.2f\n", methods[m].name, time_method(methods[m].run, samples));
+		}
+	}
+
+	if (!ok) {
+		printf("trig_bench: FAILED\n");
+		return 1;
+	}
+	printf("trig_bench: all variants within limits\n");
+	return 0;
+}
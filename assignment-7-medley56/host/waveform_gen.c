@@ -0,0 +1,120 @@
+/*
+ * waveform_gen.c
+ *
+ * Generates ../source/waveforms.c: the DAC waveform tables described
+ * by ../source/waveforms.h, as const arrays the firmware plays straight
+ * from flash, and the sine table the DDS engine interpolates. Run
+ * "make tables" after changing the parameters.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "waveforms.h"
+
+#define VALUES_PER_LINE 12
+#define SIGNED_VALUES_PER_LINE 10
+
+static uint16_t square[SQUARE_NUM_SAMPLES];
+static uint16_t sine[SINE_NUM_SAMPLES];
+static uint16_t triangle[TRIANGLE_NUM_SAMPLES];
+static int16_t dds_sine[DDS_TABLE_SIZE + 1];
+
+/*
+ * One period of each waveform, repeated to fill its table
+ */
+static void generate(void) {
+	for (uint32_t i = 0; i < SQUARE_NUM_SAMPLES; i++) {
+		// Low for the first half of each period, high for the second
+		square[i] = i % SQUARE_SAMPLES_PER_PERIOD < SQUARE_SAMPLES_PER_PERIOD / 2
+				? DAC_LOW : DAC_HIGH;
+	}
+	for (uint32_t i = 0; i < SINE_NUM_SAMPLES; i++) {
+		double theta = 2 * M_PI * (i % SINE_SAMPLES_PER_PERIOD) / SINE_SAMPLES_PER_PERIOD;
+
+		sine[i] = (uint16_t) (DAC_MIDH + lround(DAC_MIDL * sin(theta)));
+	}
+	for (uint32_t i = 0; i < TRIANGLE_NUM_SAMPLES; i++) {
+		uint32_t j = i % TRIANGLE_SAMPLES_PER_PERIOD;
+
+		// Up for the first half of each period and back down, mirrored
+		if (j >= TRIANGLE_SAMPLES_PER_PERIOD / 2) {
+			j = TRIANGLE_SAMPLES_PER_PERIOD - 1 - j;
+		}
+		triangle[i] = (uint16_t) ((j * DAC_HIGH * 2) / TRIANGLE_SAMPLES_PER_PERIOD);
+	}
+	// One whole period, and the first sample again so that interpolating
+	// past the last entry needs no wrap
+	for (uint32_t i = 0; i <= DDS_TABLE_SIZE; i++) {
+		dds_sine[i] = (int16_t) lround(DDS_TABLE_SCALE * sin(2 * M_PI * i / DDS_TABLE_SIZE));
+	}
+}
+
+static void write_table(FILE *f, const char *name, const uint16_t *table, uint32_t n) {
+	fprintf(f, "static const uint16_t %s[%u] = {", name, n);
+	for (uint32_t i = 0; i < n; i++) {
+		fprintf(f, "%s%4u,", i % VALUES_PER_LINE == 0 ? "\n\t" : " ", table[i]);
+	}
+	fprintf(f, "\n};\n\n");
+}
+
+static void write_signed_table(FILE *f, const char *name, const int16_t *table, uint32_t n) {
+	fprintf(f, "const int16_t %s[%u] = {", name, n);
+	for (uint32_t i = 0; i < n; i++) {
+		fprintf(f, "%s%6d,", i % SIGNED_VALUES_PER_LINE == 0 ? "\n\t" : " ", table[i]);
+	}
+	fprintf(f, "\n};\n\n");
+}
+
+static void write_file(FILE *f) {
+	fprintf(f, "/*\n"
+			" * waveforms.c\n"
+			" *\n"
+			" * Generated by host/waveform_gen from the parameters in\n"
+			" * waveforms.h; do not edit.\n"
+			" */\n\n"
+			"#include \"waveforms.h\"\n\n");
+	write_table(f, "square_table", square, SQUARE_NUM_SAMPLES);
+	write_table(f, "sine_table", sine, SINE_NUM_SAMPLES);
+	write_table(f, "triangle_table", triangle, TRIANGLE_NUM_SAMPLES);
+	write_signed_table(f, "dds_sine_table", dds_sine, DDS_TABLE_SIZE + 1);
+	fprintf(f, "const waveform_t waveforms[NUM_WAVEFORMS] = {\n"
+			"\t[SQUARE_MODE] = { \"SQUARE\", square_table, SQUARE_NUM_SAMPLES,\n"
+			"\t\tSQUARE_SAMPLES_PER_PERIOD, SQUARE_FREQUENCY },\n"
+			"\t[SINE_MODE] = { \"SINE\", sine_table, SINE_NUM_SAMPLES,\n"
+			"\t\tSINE_SAMPLES_PER_PERIOD, SINE_FREQUENCY },\n"
+			"\t[TRIANGLE_MODE] = { \"TRIANGLE\", triangle_table, TRIANGLE_NUM_SAMPLES,\n"
+			"\t\tTRIANGLE_SAMPLES_PER_PERIOD, TRIANGLE_FREQUENCY },\n"
+			"};\n");
+}
+
+int main(int argc, char *argv[]) {
+	const char *out = NULL;
+	FILE *f = stdout;
+	int opt;
+
+	while ((opt = getopt(argc, argv, "o:")) != -1) {
+		switch (opt) {
+		case 'o':
+			out = optarg;
+			break;
+		default:
+			fprintf(stderr, "usage: %s [-o file]\n", argv[0]);
+			return 2;
+		}
+	}
+
+	generate();
+	if (out != NULL && (f = fopen(out, "w")) == NULL) {
+		perror(out);
+		return 1;
+	}
+	write_file(f);
+	if (fclose(f) != 0) {
+		perror(out != NULL ? out : "stdout");
+		return 1;
+	}
+	return 0;
+}
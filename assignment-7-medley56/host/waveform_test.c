@@ -0,0 +1,93 @@
+/*
+ * waveform_test.c
+ *
+ * Checks the generated tables in ../source/waveforms.c: each is whole
+ * periods of the right shape within the DAC range, fits the DAC and ADC
+ * buffers, and autocorrelates to its period. The Makefile separately
+ * checks that the file is what waveform_gen generates now.
+ */
+
+#include <assert.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "autocorrelate.h"
+#include "dac.h"
+#include "waveforms.h"
+
+static void test_common(const waveform_t *w) {
+	uint32_t per = w->samples_per_period;
+	int period;
+
+	assert(w->samples != NULL && w->name != NULL);
+	assert(w->num_samples <= SAMPLE_BUFFER_MAX_SIZE);
+	assert(w->num_samples % per == 0);
+	assert(w->frequency * per == DAC_SAMPLE_RATE);
+
+	for (uint32_t i = 0; i < w->num_samples; i++) {
+		assert(w->samples[i] <= DAC_HIGH);
+		// Every period is the same, so the table loops seamlessly
+		assert(w->samples[i] == w->samples[i % per]);
+	}
+
+	period = autocorrelate_detect_period(w->samples, w->num_samples, kAC_12bps_unsigned);
+	// to within the whole lag the peak picking resolves: the triangle's
+	// broad peak comes out at 119
+	assert(abs(period - (int) per) <= 1);
+}
+
+static void test_square(const waveform_t *w) {
+	uint32_t per = w->samples_per_period;
+
+	for (uint32_t i = 0; i < per; i++) {
+		assert(w->samples[i] == (i < per / 2 ? DAC_LOW : DAC_HIGH));
+	}
+}
+
+/*
+ * The sine must be within half a code of the ideal one over the whole
+ * period: the second half used to come out negated, wrapping round to
+ * codes far above DAC_HIGH
+ */
+static void test_sine(const waveform_t *w) {
+	uint32_t per = w->samples_per_period;
+
+	for (uint32_t i = 0; i < per; i++) {
+		double ideal = DAC_MIDH + DAC_MIDL * sin(2 * M_PI * i / per);
+
+		assert(fabs(w->samples[i] - ideal) <= 0.5);
+	}
+	assert(w->samples[0] == DAC_MIDH);
+	assert(w->samples[per / 4] == DAC_HIGH);
+	assert(w->samples[3 * per / 4] == DAC_MIDH - DAC_MIDL);
+}
+
+static void test_triangle(const waveform_t *w) {
+	uint32_t per = w->samples_per_period;
+
+	assert(w->samples[0] == DAC_LOW);
+	for (uint32_t i = 1; i < per / 2; i++) {
+		// Rising in equal steps, to within rounding
+		uint32_t step = w->samples[i] - w->samples[i - 1];
+
+		assert(w->samples[i] > w->samples[i - 1]);
+		assert(step * per >= 2 * DAC_HIGH - per && step * per <= 2 * DAC_HIGH + per);
+		// and falling back down as its mirror image
+		assert(w->samples[per - 1 - i] == w->samples[i]);
+	}
+	// The top is within a step of full scale
+	assert(DAC_HIGH - w->samples[per / 2 - 1] <= 2 * DAC_HIGH / per + 1);
+}
+
+int main(void) {
+	for (uint32_t mode = 0; mode < NUM_WAVEFORMS; mode++) {
+		test_common(&waveforms[mode]);
+	}
+	test_square(&waveforms[SQUARE_MODE]);
+	test_sine(&waveforms[SINE_MODE]);
+	test_triangle(&waveforms[TRIANGLE_MODE]);
+
+	printf("waveform_test: all tables correct\n");
+	return 0;
+}
@@ -0,0 +1,164 @@
+/*
+ * wavestats_test.c
+ *
+ * Checks ../source/wavestats.c against two-pass double precision
+ * statistics: whole buffers, the same buffers split into merged
+ * partial results, and counts far beyond the 1024-sample capture.
+ */
+
+#include <assert.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "wavestats.h"
+
+#define MAX_SAMPLES 4096
+
+/* Mean and RMS values are rounded from 1/256 of a count */
+#define RMS_TOLERANCE (0.5 + 1.0 / 256)
+
+static uint16_t samples[MAX_SAMPLES];
+
+typedef struct {
+	double mean;
+	double variance;
+	double rms;
+	uint16_t min;
+	uint16_t max;
+} reference_t;
+
+static reference_t reference(const uint16_t *x, uint32_t n) {
+	reference_t ref = { 0, 0, 0, UINT16_MAX, 0 };
+	double sum_sq = 0;
+
+	for (uint32_t i = 0; i < n; i++) {
+		ref.mean += x[i];
+		sum_sq += (double) x[i] * x[i];
+		if (x[i] < ref.min) {
+			ref.min = x[i];
+		}
+		if (x[i] > ref.max) {
+			ref.max = x[i];
+		}
+	}
+	ref.mean /= n;
+	for (uint32_t i = 0; i < n; i++) {
+		ref.variance += (x[i] - ref.mean) * (x[i] - ref.mean);
+	}
+	ref.variance /= n;
+	ref.rms = sqrt(sum_sq / n);
+	return ref;
+}
+
+static void check(const wavestats_t *ws, const reference_t *ref, uint32_t n) {
+	wavestats_result_t res;
+
+	assert(wavestats_result(ws, &res) == 0);
+	assert(res.count == n);
+	assert(res.min == ref->min);
+	assert(res.max == ref->max);
+	assert(res.peak_to_peak == ref->max - ref->min);
+	assert(fabs(res.mean - ref->mean) <= 0.5);
+	assert(res.dc_offset == (int32_t) res.mean - (int32_t) WAVESTATS_MIDSCALE);
+	assert(fabs(res.variance - ref->variance) <= 0.5);
+	assert(fabs(res.rms - ref->rms) <= RMS_TOLERANCE);
+	assert(fabs(res.ac_rms - sqrt(ref->variance)) <= RMS_TOLERANCE);
+}
+
+/*
+ * Checks the statistics of x[0..n), added in one go and in random
+ * pieces merged together
+ */
+static void check_buffer(const uint16_t *x, uint32_t n) {
+	reference_t ref = reference(x, n);
+	wavestats_t whole, merged, part;
+
+	wavestats_reset(&whole);
+	wavestats_add(&whole, x, n);
+	check(&whole, &ref, n);
+
+	wavestats_reset(&merged);
+	for (uint32_t i = 0; i < n; ) {
+		uint32_t len = (uint32_t) rand() % (n - i + 1);
+
+		wavestats_reset(&part);
+		wavestats_add(&part, x + i, len);
+		wavestats_merge(&merged, &part);
+		i += len;
+	}
+	check(&merged, &ref, n);
+}
+
+static void test_waveforms(void) {
+	uint32_t n = MAX_SAMPLES;
+
+	// Uniform noise over the full scale
+	for (uint32_t i = 0; i < n; i++) {
+		samples[i] = (uint16_t) rand();
+	}
+	check_buffer(samples, n);
+
+	// Sines of different amplitudes and DC offsets, as the ADC sees
+	// the DAC output
+	for (int k = 0; k < 20; k++) {
+		double dc = 1000 + rand() % 63000;
+		double amplitude = fmin(dc, 65535 - dc) * (rand() % 1000) / 1000;
+
+		for (uint32_t i = 0; i < n; i++) {
+			samples[i] = (uint16_t) lround(dc + amplitude * sin(i * 0.0123 * (k + 1)));
+		}
+		check_buffer(samples, 1024);
+		check_buffer(samples, n - k);
+	}
+
+	// A constant, at the extremes and in between
+	for (uint32_t v = 0; v <= 65535; v += 65535 / 5) {
+		for (uint32_t i = 0; i < n; i++) {
+			samples[i] = (uint16_t) v;
+		}
+		check_buffer(samples, n);
+	}
+
+	// A full-scale square wave, and a single sample
+	for (uint32_t i = 0; i < n; i++) {
+		samples[i] = i & 1 ? 65535 : 0;
+	}
+	check_buffer(samples, n);
+	check_buffer(samples + 1, 1);
+}
+
+/*
+ * 2^28 full-scale samples: S1^2, and so n*S2 - S1^2, would be far
+ * beyond 64 bits
+ */
+static void test_long_run(void) {
+	const uint32_t blocks = 1U << 16;
+	const uint32_t n = 4096;
+	reference_t ref = { 0, 0, 0, 0, 65535 };
+	wavestats_t ws;
+	wavestats_result_t res;
+
+	for (uint32_t i = 0; i < n; i++) {
+		samples[i] = i % 4 == 0 ? 0 : 65535;
+	}
+	wavestats_reset(&ws);
+	for (uint32_t b = 0; b < blocks; b++) {
+		wavestats_add(&ws, samples, n);
+	}
+	ref.mean = 65535.0 * 3 / 4;
+	ref.variance = 65535.0 * 65535 * 3 / 16;
+	ref.rms = 65535 * sqrt(3.0 / 4);
+	check(&ws, &ref, blocks * n);
+
+	wavestats_reset(&ws);
+	assert(wavestats_result(&ws, &res) == -1);
+}
+
+int main(void) {
+	srand(1);
+	test_waveforms();
+	test_long_run();
+	printf("wavestats_test: all statistics match\n");
+	return 0;
+}
@@ -8,131 +8,219 @@
 
 #include "log.h"
 #include "autocorrelate.h"
+#include "pitch.h"
+#include "goertzel.h"
+#include "waveforms.h"
+#include "adc_capture.h"
+#include "wavestats.h"
 
-#define ADC_INPUT_CHANNEL (23U)
 #define ADC_SAMPLING_FREQ (48000U)  // 48kHz
 #define ADC_SAMPLING_PERIOD (21U)  // Sample every 21 microseconds (ideally 20.83us) for ~48kHz sampling
 #define SAMPLE_BUFFER_MAX_SIZE (1024U)  // 1024 samples in ADC sample buffer
 
+#define ADC_RING_SIZE (512U)  // Samples in the DMA ring buffer (1 KB), a power of two
+#define ADC_BLOCK_SIZE (128U)  // Samples per pitch estimate (2.7 ms), divides ADC_RING_SIZE / 2
+#define PITCH_LOG_CHANGE (50)  // Log the streaming estimate when it moves by 1/50 (2%)
+#define TONE_BLOCK_SIZE (240U)  // Samples per tone detection (5 ms), whole cycles of each waveform
+
 uint16_t adc_buffer_index = 0;
 uint16_t adc_sample_buffer[SAMPLE_BUFFER_MAX_SIZE] = {0};
+/* Statistics of the one-shot buffer, updated as it fills */
+static wavestats_t adc_sample_stats;
+/* Set by Reset_ADC_Sampling() to have the main loop start a new one-shot capture */
+static volatile bool adc_capture_restart = false;
+
+/* The DMA writes every sample into this ring buffer, one half while the main loop
+ * drains the other a block at a time into the streaming pitch detector. The head
+ * only ever grows (wrapping at 2^32), a half at a time; it is written by the DMA
+ * interrupt and read by the main loop. The DMA wraps with address modulo, so the
+ * ring is aligned to its size. */
+static uint16_t adc_ring[ADC_RING_SIZE] __attribute__((aligned(ADC_RING_SIZE * sizeof(uint16_t))));
+static volatile uint32_t adc_ring_head = 0;
+static uint32_t adc_ring_tail = 0;
+static uint32_t adc_ring_overruns = 0;
+static pitch_t pitch;
+static int32_t logged_period = -1;
+/* The Goertzel bank listens for the waveforms the DAC plays, in the same blocks */
+static const uint32_t tone_frequencies[NUM_WAVEFORMS] = {SQUARE_FREQUENCY, SINE_FREQUENCY, TRIANGLE_FREQUENCY};
+static goertzel_t tones;
+static int32_t logged_tone = -1;
 
+/*
+ * Define AUTOCORRELATE_FFT to find the period with the FFT instead of
+ * the direct sums. It takes 8 KB of workspace and is slower for the
+ * short periods played here (the direct method stops at the first
+ * peak), but its time does not grow with the period: with no clear
+ * period the direct method scans every lag, O(n^2), and holds up the
+ * main loop.
+ */
+#ifdef AUTOCORRELATE_FFT
+static int32_t autocorrelate_work[2 * SAMPLE_BUFFER_MAX_SIZE];
+#endif
 
-void Init_TPM1(uint32_t period_us)
-{
-	//turn on clock to TPM
-	SIM->SCGC6 |= SIM_SCGC6_TPM1_MASK;
-
-	//set clock source for tpm
-	SIM->SOPT2 |= SIM_SOPT2_TPMSRC(1) | SIM_SOPT2_PLLFLLSEL_MASK;
-
-	// disable TPM
-	TPM1->SC = 0;
-
-	//load the counter and mod
-	TPM1->MOD = TPM_MOD_MOD(period_us*24);
-
-	//set TPM to trigger DMA interrupts and to _not_ prescale the clock for better resolution
-	TPM1->SC = (TPM_SC_DMA_MASK | TPM_SC_PS(1));
-
-	// Enable TPM interrupts for measuring the signal with the ADC
-	TPM1->SC |= TPM_SC_TOIE_MASK;
 
-	// Configure NVIC
-	NVIC_SetPriority(TPM1_IRQn, 3); // 0, 64, 128 or 192
-	NVIC_ClearPendingIRQ(TPM1_IRQn);
-	NVIC_EnableIRQ(TPM1_IRQn);
+/*
+ * Called from the DMA interrupt each time half of the ring has filled: publish it to
+ * the main loop. This runs above the playback DMA, so it does nothing else; the main
+ * loop copies the samples and updates the statistics.
+ */
+static void ADC_Half_Full(const uint16_t *samples, uint32_t count)
+{
+	adc_ring_head += count;
 }
 
 
-void Start_TPM1(void)
+/*
+ * Copy a block into the one-shot buffer and add it to the statistics, until the
+ * buffer is full. Once it is, we're just waiting for systick to trigger and to
+ * analyze it.
+ */
+static void Capture_Block(const uint16_t *block, uint32_t count)
 {
-	// Enable counter
-	TPM1->SC |= TPM_SC_CMOD(1);
-}
+	uint16_t start = adc_buffer_index;
 
+	if (adc_capture_restart)
+	{
+		adc_capture_restart = false;
+		wavestats_reset(&adc_sample_stats);
+		adc_buffer_index = start = 0;
+	}
 
-void Init_ADC(void) {
-	SIM->SCGC6 |= (1UL << SIM_SCGC6_ADC0_SHIFT);
-	ADC0->CFG1 = ADC_CFG1_ADLPC_MASK | ADC_CFG1_ADIV(0) | ADC_CFG1_ADLSMP_MASK |
-		ADC_CFG1_MODE(3) | ADC_CFG1_ADICLK(0); // 16 bit conversion mode
+	for (uint32_t i = 0; i < count && adc_buffer_index < SAMPLE_BUFFER_MAX_SIZE; i++)
+	{
+		adc_sample_buffer[adc_buffer_index] = block[i];
+		adc_buffer_index++;
+	}
+	wavestats_add(&adc_sample_stats, &adc_sample_buffer[start], adc_buffer_index - start);
+}
 
-	ADC0->SC2 = ADC_SC2_REFSEL(0); // Select default voltage reference pins
 
-	/* And now initialize the timer that triggers an ADC sample (interrupt) */
-	Init_TPM1(ADC_SAMPLING_PERIOD);
-	/* Start the timer (and interrupts) */
-	Start_TPM1();
+void Init_ADC(void) {
+	pitch_reset(&pitch);
+	goertzel_init(&tones, ADC_SAMPLING_FREQ, TONE_BLOCK_SIZE, tone_frequencies, NUM_WAVEFORMS);
+	wavestats_reset(&adc_sample_stats);
+
+	/* TPM1 triggers the conversions and DMA stores them, with no interrupt per sample */
+	Init_ADC_Capture(adc_ring, ADC_RING_SIZE, ADC_SAMPLING_PERIOD, ADC_Half_Full);
+	/* Start the timer (and conversions) */
+	Start_ADC_Capture();
 }
 
 
-uint16_t Measure_Analog_Voltage(void)
+void Process_ADC_Samples(void)
 {
-	/* Measure the voltage on the ADC input pin, which is also the DAC output pin */
-	ADC0->SC1[0] = ADC_INPUT_CHANNEL;
+	uint32_t head = adc_ring_head;
 
-	/* Wait until the measurement is done */
-	while (!(ADC0->SC1[0] & ADC_SC1_COCO_MASK))
+	if (head - adc_ring_tail > ADC_RING_SIZE / 2)
 	{
-		// wait
-	};
-
-	return ADC0->R[0];
-}
-
+		/* We fell behind (e.g. while printing) and the DMA is overwriting
+		 * samples we have not read: the history has a gap, so start again from the
+		 * newest completed half, which the DMA is not touching */
+		adc_ring_overruns++;
+		adc_ring_tail = head - ADC_RING_SIZE / 2;
+		pitch_reset(&pitch);
+		goertzel_reset(&tones);
+		if (adc_buffer_index < SAMPLE_BUFFER_MAX_SIZE)
+		{
+			/* The one-shot capture has the gap too */
+			adc_capture_restart = true;
+		}
+	}
 
-void TPM1_IRQHandler(void) {
-	//clear pending IRQ
-	//LOG("Entering TPM1 IRQ Handler");
-	NVIC_ClearPendingIRQ(TPM1_IRQn);
-	TPM1->SC |= TPM_SC_TOF_MASK;
-	if (adc_buffer_index < SAMPLE_BUFFER_MAX_SIZE)
+	while (head - adc_ring_tail >= ADC_BLOCK_SIZE)
 	{
-		/* Unless we have filled the ADC sample buffer, measure the current voltage
-		 * and store it in the buffer */
-		adc_sample_buffer[adc_buffer_index] = Measure_Analog_Voltage();
-		adc_buffer_index++;
-	} else {
-		/* If we've filled the ADC sample buffer, we have our sample and
-		 * we're just waiting for systick to trigger and to analyze it */
-		NVIC_DisableIRQ(TPM1_IRQn);
+		/* The tail moves in whole blocks, so a block never wraps around the ring */
+		const uint16_t *block = &adc_ring[adc_ring_tail & (ADC_RING_SIZE - 1)];
+		Capture_Block(block, ADC_BLOCK_SIZE);
+		int32_t period = pitch_process(&pitch, block, ADC_BLOCK_SIZE);
+		uint32_t tone_blocks = goertzel_process(&tones, block, ADC_BLOCK_SIZE);
+		adc_ring_tail += ADC_BLOCK_SIZE;
+
+		int32_t tone = goertzel_detect(&tones);
+		if (tone_blocks > 0 && tone != logged_tone)
+		{
+			if (tone < 0)
+			{
+				LOG("streaming: no known tone");
+			}
+			else
+			{
+				LOG("streaming: tone %d Hz, snr=%d dB", tones.tones[tone].frequency,
+					tones.tones[tone].snr_db >> GOERTZEL_SNR_FRAC_BITS);
+			}
+			logged_tone = tone;
+		}
+
+		int32_t change = period - logged_period;
+		if (change < 0)
+		{
+			change = -change;
+		}
+		if ((period < 0) != (logged_period < 0) ||
+				(period >= 0 && change * PITCH_LOG_CHANGE > logged_period))
+		{
+			if (period < 0)
+			{
+				LOG("streaming: no fundamental frequency");
+			}
+			else
+			{
+				LOG("streaming: frequency=%d Hz", (ADC_SAMPLING_FREQ << PITCH_FRAC_BITS) / period);
+			}
+			logged_period = period;
+		}
 	}
 }
 
 
 void Summarize_Waveform(void)
 {
-	/* Ready to check results */
-	int samples_per_period = autocorrelate_detect_period(adc_sample_buffer, SAMPLE_BUFFER_MAX_SIZE, kAC_16bps_unsigned);
+	/* Ready to check results: the period to 1/256 of a sample, so the frequency
+	 * resolves to better than 0.1% rather than in steps of a sample (2% at 800 Hz) */
+#ifdef AUTOCORRELATE_FFT
+	int32_t samples_per_period = autocorrelate_detect_period_fft_frac(adc_sample_buffer,
+			SAMPLE_BUFFER_MAX_SIZE, kAC_16bps_unsigned, autocorrelate_work, 2 * SAMPLE_BUFFER_MAX_SIZE);
+#else
+	int32_t samples_per_period = autocorrelate_detect_period_frac(adc_sample_buffer, SAMPLE_BUFFER_MAX_SIZE,
+			kAC_16bps_unsigned);
+#endif
 	if (samples_per_period < 0)
 	{
 		LOG("ERROR: No fundamental frequency detected");
 		return;
 	}
 
-	uint16_t val = 0, min = 65535, max = 0, sum = 0, mean = 0;
-	for (int i=0; i<SAMPLE_BUFFER_MAX_SIZE; i++)
+	/* The statistics were accumulated as the samples arrived */
+	wavestats_result_t stats;
+	wavestats_result(&adc_sample_stats, &stats);
+	/* In tenths of a Hz, rounded */
+	uint32_t calculated_frequency = (((ADC_SAMPLING_FREQ * 10U) << AUTOCORRELATE_FRAC_BITS) + samples_per_period / 2)
+			/ samples_per_period;
+	LOG("period=%d.%02d samples, min=%d, max=%d, avg=%d, frequency=%d.%d Hz",
+		samples_per_period >> AUTOCORRELATE_FRAC_BITS,
+		((samples_per_period & ((1 << AUTOCORRELATE_FRAC_BITS) - 1)) * 100) >> AUTOCORRELATE_FRAC_BITS,
+		stats.min, stats.max, stats.mean, calculated_frequency / 10, calculated_frequency % 10);
+	LOG("peak-to-peak=%d, dc offset=%d, rms=%d, ac rms=%d, variance=%d",
+		stats.peak_to_peak, stats.dc_offset, stats.rms, stats.ac_rms, stats.variance);
+
+	int32_t streaming_period = pitch_period(&pitch);
+	LOG("streaming: frequency=%d Hz, %d ring overruns, %d DMA errors",
+		streaming_period < 0 ? 0 : (ADC_SAMPLING_FREQ << PITCH_FRAC_BITS) / streaming_period,
+		adc_ring_overruns, ADC_Capture_Errors());
+	for (uint32_t t = 0; t < tones.num_tones; t++)
 	{
-		val = adc_sample_buffer[i];
-		sum += val;
-		if (val < min)
-		{
-			min = val;
-		}
-		if (val > max)
-		{
-			max = val;
-		}
+		const goertzel_tone_t *tone = &tones.tones[t];
+
+		LOG("tone %d Hz: amplitude=%d, share=%d%%, snr=%d dB", tone->frequency, tone->amplitude,
+			(tone->share_q16 * 100) >> 16, tone->snr_db >> GOERTZEL_SNR_FRAC_BITS);
 	}
-	mean = sum / SAMPLE_BUFFER_MAX_SIZE;
-	uint16_t calculated_frequency = ADC_SAMPLING_FREQ / samples_per_period;
-	LOG("period=%d samples, min=%d, max=%d, avg=%d, frequency=%d Hz",
-		samples_per_period, min, max, mean, calculated_frequency);
 }
 
 
 void Reset_ADC_Sampling(void)
 {
-	adc_buffer_index = 0;
+	/* Process_ADC_Samples() clears the buffer and statistics before its
+	 * next block, so this cannot land partway through one */
+	adc_capture_restart = true;
 }
 
@@ -18,6 +18,12 @@
  */
 void Init_ADC(void);
 
+/*
+ * @brief Feed the samples the DMA has put in the ring buffer to the
+ * streaming pitch detector, a block at a time. Call from the main loop.
+ */
+void Process_ADC_Samples(void);
+
 /*
  * Print a summary of the current ADC sample buffer
  */
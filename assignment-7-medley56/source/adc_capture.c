@@ -0,0 +1,141 @@
+/*
+ * adc_capture.c
+ *
+ * Hardware-triggered ADC0 conversions, moved into a ping-pong buffer
+ * by DMA channel 1. See Ch 12 (SIM_SOPT7), 23 (DMA) and 28 (ADC) of
+ * the KL25 Reference Manual.
+ */
+
+#include <assert.h>
+#include <stddef.h>
+
+#include "fsl_device_registers.h"
+#include "adc_capture.h"
+
+#define ADC_INPUT_CHANNEL (23U)  // ADC0_SE23, the DAC0 output pin
+#define ADC_DMA_CHANNEL (1U)  // Channel 0 plays the DAC waveform
+#define ADC_DMAMUX_SOURCE (40U)  // ADC0 conversion complete, see Ch 3 of the Reference Manual
+#define ADC_TRIGGER_TPM1 (9U)  // SIM_SOPT7 ADC0TRGSEL: TPM1 overflow
+#define ADC_DMA_IRQ_PRIORITY (1U)  // Must re-arm within one sample period, see DMA1_IRQHandler
+
+static uint16_t *capture_buffer = NULL;
+static uint32_t half_count = 0;  // samples per half
+static uint32_t next_half = 0;  // the half the DMA fills next, 0 or 1
+static uint32_t capture_errors = 0;
+static adc_capture_callback_t capture_callback = NULL;
+
+
+/*
+ * DMOD value for a circular buffer of this many bytes: 1 is 16 bytes,
+ * and each step doubles it
+ */
+static uint32_t dma_modulo(uint32_t bytes)
+{
+	uint32_t mod = 1;
+
+	while ((16U << (mod - 1)) < bytes)
+	{
+		mod++;
+	}
+	return mod;
+}
+
+
+void Init_ADC_Capture(uint16_t *buffer, uint32_t count, uint32_t period_us,
+		adc_capture_callback_t callback)
+{
+	uint32_t bytes = count * sizeof(uint16_t);
+
+	// The DMA only wraps around a power-of-two buffer aligned to its size
+	assert(bytes >= 32 && bytes <= 16384 && (bytes & (bytes - 1)) == 0);
+	assert(((uintptr_t) buffer & (bytes - 1)) == 0);
+
+	capture_buffer = buffer;
+	half_count = count / 2;
+	next_half = 0;
+	capture_errors = 0;
+	capture_callback = callback;
+
+	// Gate clocks to TPM1, ADC0, DMA and DMAMUX
+	SIM->SCGC6 |= SIM_SCGC6_TPM1_MASK | SIM_SCGC6_ADC0_MASK | SIM_SCGC6_DMAMUX_MASK;
+	SIM->SCGC7 |= SIM_SCGC7_DMA_MASK;
+
+	/* TPM1 only paces the conversions: no interrupt, and no TPM DMA request */
+	SIM->SOPT2 |= SIM_SOPT2_TPMSRC(1) | SIM_SOPT2_PLLFLLSEL_MASK;
+	TPM1->SC = 0;
+	TPM1->MOD = TPM_MOD_MOD(period_us*24);
+	TPM1->SC = TPM_SC_PS(1);
+
+	/* Start ADC0 conversions on TPM1 overflow instead of PDB */
+	SIM->SOPT7 = SIM_SOPT7_ADC0ALTTRGEN_MASK | SIM_SOPT7_ADC0TRGSEL(ADC_TRIGGER_TPM1);
+
+	/* 16 bit conversions, long sample time, as before. Hardware trigger,
+	 * and a DMA request instead of spinning on COCO. Writing SC1A only
+	 * selects the channel when ADTRG is set. */
+	ADC0->CFG1 = ADC_CFG1_ADLPC_MASK | ADC_CFG1_ADIV(0) | ADC_CFG1_ADLSMP_MASK |
+		ADC_CFG1_MODE(3) | ADC_CFG1_ADICLK(0);
+	ADC0->SC2 = ADC_SC2_REFSEL(0) | ADC_SC2_ADTRG_MASK | ADC_SC2_DMAEN_MASK;
+	ADC0->SC3 = 0;
+	ADC0->SC1[0] = ADC_SC1_ADCH(ADC_INPUT_CHANNEL);
+
+	// Disable the DMA channel to allow configuration
+	DMAMUX0->CHCFG[ADC_DMA_CHANNEL] = 0;
+	DMA0->DMA[ADC_DMA_CHANNEL].DSR_BCR = DMA_DSR_BCR_DONE_MASK;
+
+	// One 16 bit result register to an incrementing destination that
+	// wraps around the buffer, one transfer per request, an interrupt
+	// after each half
+	DMA0->DMA[ADC_DMA_CHANNEL].SAR = DMA_SAR_SAR((uint32_t) (uintptr_t) &ADC0->R[0]);
+	DMA0->DMA[ADC_DMA_CHANNEL].DAR = DMA_DAR_DAR((uint32_t) (uintptr_t) buffer);
+	DMA0->DMA[ADC_DMA_CHANNEL].DSR_BCR = DMA_DSR_BCR_BCR(half_count * sizeof(uint16_t));
+	DMA0->DMA[ADC_DMA_CHANNEL].DCR = DMA_DCR_EINT_MASK | DMA_DCR_ERQ_MASK | DMA_DCR_CS_MASK |
+			DMA_DCR_SSIZE(2) | DMA_DCR_DSIZE(2) | DMA_DCR_DINC_MASK |
+			DMA_DCR_DMOD(dma_modulo(bytes));
+
+	NVIC_SetPriority(DMA1_IRQn, ADC_DMA_IRQ_PRIORITY);
+	NVIC_ClearPendingIRQ(DMA1_IRQn);
+	NVIC_EnableIRQ(DMA1_IRQn);
+
+	DMAMUX0->CHCFG[ADC_DMA_CHANNEL] = DMAMUX_CHCFG_SOURCE(ADC_DMAMUX_SOURCE) | DMAMUX_CHCFG_ENBL_MASK;
+}
+
+
+void Start_ADC_Capture(void)
+{
+	// Enable counter
+	TPM1->SC |= TPM_SC_CMOD(1);
+}
+
+
+uint32_t ADC_Capture_Errors(void)
+{
+	return capture_errors;
+}
+
+
+/*
+ * A half has filled. The DMA stops when its byte count runs out, so it
+ * is re-armed first: the conversion that completes meanwhile keeps its
+ * DMA request (COCO) asserted and is moved as soon as the count is
+ * back, so nothing is lost as long as this runs within one sampling
+ * period. DAR has already wrapped round to the other half.
+ */
+void DMA1_IRQHandler(void)
+{
+	uint32_t status = DMA0->DMA[ADC_DMA_CHANNEL].DSR_BCR;
+	const uint16_t *filled = capture_buffer + next_half * half_count;
+
+	if (status & (DMA_DSR_BCR_CE_MASK | DMA_DSR_BCR_BES_MASK | DMA_DSR_BCR_BED_MASK))
+	{
+		capture_errors++;
+	}
+	// Clear done (and the error flags), then reload the byte count
+	DMA0->DMA[ADC_DMA_CHANNEL].DSR_BCR = DMA_DSR_BCR_DONE_MASK;
+	DMA0->DMA[ADC_DMA_CHANNEL].DSR_BCR = DMA_DSR_BCR_BCR(half_count * sizeof(uint16_t));
+
+	next_half ^= 1;
+	if (capture_callback != NULL)
+	{
+		capture_callback(filled, half_count);
+	}
+}
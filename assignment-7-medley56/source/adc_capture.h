@@ -0,0 +1,47 @@
+/*
+ * adc_capture.h
+ *
+ * Continuous ADC capture with no per-sample CPU work: TPM1 overflows
+ * trigger ADC0 conversions in hardware (SIM_SOPT7), and DMA channel 1
+ * moves each result into a circular buffer made of two halves. The
+ * DMA interrupt fires once per half.
+ */
+
+#ifndef ADC_CAPTURE_H_
+#define ADC_CAPTURE_H_
+
+#include <stdint.h>
+
+/*
+ * Called from the DMA interrupt when a half of the buffer has filled.
+ * The DMA is filling the other half meanwhile, so the samples stay
+ * valid until the next call.
+ */
+typedef void (*adc_capture_callback_t)(const uint16_t *samples, uint32_t count);
+
+/*
+ * @brief Configure TPM1, ADC0 and DMA channel 1 for capture into buffer.
+ *
+ * Parameters:
+ *   buffer     Capture buffer. Its size in bytes must be a power of two
+ *              from 32 bytes to 16 KB, and it must be aligned to its size:
+ *              the DMA wraps around it with destination address modulo.
+ *   count      Number of samples in buffer
+ *   period_us  Sampling period in microseconds
+ *   callback   Called as each half of buffer fills
+ */
+void Init_ADC_Capture(uint16_t *buffer, uint32_t count, uint32_t period_us,
+		adc_capture_callback_t callback);
+
+/*
+ * @brief Start the TPM1 timer, and with it the conversions
+ */
+void Start_ADC_Capture(void);
+
+/*
+ * @brief Number of halves that finished with a DMA error (bus or
+ * configuration) since Init_ADC_Capture
+ */
+uint32_t ADC_Capture_Errors(void);
+
+#endif /* ADC_CAPTURE_H_ */
@@ -12,69 +12,604 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#include <stddef.h>
 #include <assert.h>
 
 #include "autocorrelate.h"
+#include "isqrt.h"
+
+
+/*
+ * The direct method works on centered signed samples. Unsigned samples
+ * are centered as they are read, by subtracting the midscale offset
+ * modulo 2^16; the offset is 0 for signed samples. The caller's buffer
+ * is never written.
+ */
+static const uint16_t midscale[] = {
+  [kAC_12bps_unsigned] = 1 << 11,
+  [kAC_16bps_unsigned] = 1 << 15,
+  [kAC_12bps_signed]   = 0,
+  [kAC_16bps_signed]   = 0,
+};
+
+
+/*
+ * The autocorrelation sums are shifted down by the sample width, as
+ * the products used to be, so the peak search sees the same scale
+ */
+static const int sum_shift[] = {
+  [kAC_12bps_unsigned] = 12,
+  [kAC_16bps_unsigned] = 16,
+  [kAC_12bps_signed]   = 12,
+  [kAC_16bps_signed]   = 16,
+};
+
+
+/*
+ * Sample k centered by offset
+ */
+static inline int32_t
+centered(const int16_t *x, uint32_t k, uint16_t offset)
+{
+  return (int16_t)((uint16_t)x[k] - offset);
+}
+
+
+/*
+ * State of the search for the first peak of the autocorrelation,
+ * fed one lag at a time, in order from lag 0
+ */
+typedef struct {
+  int64_t thresh;
+  int64_t sums[3];   // at lags i-2, i-1 and i
+  bool slope_positive;
+} peak_search_t;
+
+
+/*
+ * Feeds the autocorrelation sum at lag i to the peak search. Returns
+ * the lag of the peak once its crest has been passed, or -1 to keep
+ * going.
+ */
+static int
+peak_search_step(peak_search_t *ps, int i, int64_t sum)
+{
+  int64_t prev_sum = ps->sums[2];
+  int found = -1;
+
+  ps->sums[0] = ps->sums[1];
+  ps->sums[1] = prev_sum;
+  ps->sums[2] = sum;
+
+  if (i == 0) {
+    ps->thresh = sum / 2;
+    ps->slope_positive = false;
+
+  } else if ((sum > ps->thresh) && (sum - prev_sum > 0)) {
+    // slope is positive, so now enter mode where we're looking for
+    // negative slope
+    ps->slope_positive = true;
+
+  } else if (ps->slope_positive && (sum - prev_sum) <= 0) {
+    // We have crested the peak and started down the other
+    // side; actual peak was one sample back
+    found = i-1;
+  }
+
+  return found;
+}
+
+
+/*
+ * Rounds num / den to nearest, for den > 0
+ */
+static int64_t
+div_round(int64_t num, int64_t den)
+{
+  if (num < 0)
+    return (num - den / 2) / den;
+  return (num + den / 2) / den;
+}
+
+
+/*
+ * Sum of x[k] * x[k+lag] over the overlapping samples, each centered
+ * by offset. A product of two 16-bit samples takes 31 bits, so the sum
+ * is 64 bits wide.
+ *
+ * On the host this uses SSE2 or AVX2 (pmaddwd: 16-bit multiplies
+ * summed in pairs); on the M0+ it is plain C. The only pair sum that
+ * does not fit in 32 bits is 2 * (-32768)^2 = 2^31, which pmaddwd
+ * returns as INT32_MIN; no genuine pair sum is that negative, so it is
+ * widened as positive.
+ */
+#if !defined(AUTOCORRELATE_NO_SIMD) && defined(__AVX2__)
+#include <immintrin.h>
+
+static int64_t
+lag_dot(const int16_t *x, uint32_t nsamp, uint32_t lag, uint16_t offset)
+{
+  uint32_t len = nsamp - lag;
+  uint32_t k = 0;
+  int64_t lanes[4];
+  int64_t sum;
+  const __m256i min = _mm256_set1_epi32(INT32_MIN);
+  const __m256i off = _mm256_set1_epi16((int16_t)offset);
+  __m256i acc0 = _mm256_setzero_si256();
+  __m256i acc1 = _mm256_setzero_si256();
+
+  for (; k + 16 <= len; k += 16) {
+    __m256i a = _mm256_sub_epi16(_mm256_loadu_si256((const __m256i *)(x + k)), off);
+    __m256i b = _mm256_sub_epi16(_mm256_loadu_si256((const __m256i *)(x + k + lag)), off);
+    __m256i p = _mm256_madd_epi16(a, b);
+    __m256i sign = _mm256_andnot_si256(_mm256_cmpeq_epi32(p, min),
+        _mm256_srai_epi32(p, 31));
+
+    acc0 = _mm256_add_epi64(acc0, _mm256_unpacklo_epi32(p, sign));
+    acc1 = _mm256_add_epi64(acc1, _mm256_unpackhi_epi32(p, sign));
+  }
+  _mm256_storeu_si256((__m256i *)lanes, _mm256_add_epi64(acc0, acc1));
+  sum = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+
+  for (; k < len; k++)
+    sum += centered(x, k, offset) * centered(x, k+lag, offset);
+  return sum;
+}
+
+#elif !defined(AUTOCORRELATE_NO_SIMD) && defined(__SSE2__)
+#include <emmintrin.h>
+
+static int64_t
+lag_dot(const int16_t *x, uint32_t nsamp, uint32_t lag, uint16_t offset)
+{
+  uint32_t len = nsamp - lag;
+  uint32_t k = 0;
+  int64_t lanes[2];
+  int64_t sum;
+  const __m128i min = _mm_set1_epi32(INT32_MIN);
+  const __m128i off = _mm_set1_epi16((int16_t)offset);
+  __m128i acc0 = _mm_setzero_si128();
+  __m128i acc1 = _mm_setzero_si128();
+
+  for (; k + 8 <= len; k += 8) {
+    __m128i a = _mm_sub_epi16(_mm_loadu_si128((const __m128i *)(x + k)), off);
+    __m128i b = _mm_sub_epi16(_mm_loadu_si128((const __m128i *)(x + k + lag)), off);
+    __m128i p = _mm_madd_epi16(a, b);
+    __m128i sign = _mm_andnot_si128(_mm_cmpeq_epi32(p, min),
+        _mm_srai_epi32(p, 31));
+
+    acc0 = _mm_add_epi64(acc0, _mm_unpacklo_epi32(p, sign));
+    acc1 = _mm_add_epi64(acc1, _mm_unpackhi_epi32(p, sign));
+  }
+  _mm_storeu_si128((__m128i *)lanes, _mm_add_epi64(acc0, acc1));
+  sum = lanes[0] + lanes[1];
+
+  for (; k < len; k++)
+    sum += centered(x, k, offset) * centered(x, k+lag, offset);
+  return sum;
+}
+
+#else
+
+static int64_t
+lag_dot(const int16_t *x, uint32_t nsamp, uint32_t lag, uint16_t offset)
+{
+  int64_t sum = 0;
+
+  for (uint32_t k=0; k < nsamp - lag; k++)
+    sum += centered(x, k, offset) * centered(x, k+lag, offset);
+  return sum;
+}
+
+#endif
+
+
+/*
+ * The autocorrelation sum at lag, normalized by the energy of the two
+ * stretches of nsamp - lag samples (centered by offset) it multiplies, with
+ * NCCF_BITS fractional bits (less sum_shift - ENERGY_SHIFT).
+ *
+ * The raw sums droop towards longer lags, as they have fewer terms,
+ * and wobble with where the capture starts and stops in the cycle.
+ * Both pull the peak off the true period, by up to a sample at a
+ * period of 200 out of 1024 samples. Normalized, the correlation is 1
+ * at exactly the period of a steady wave, wherever it starts.
+ */
+#define NCCF_BITS     24
+#define ENERGY_SHIFT  4   // energies keep 4 more bits than the sums
+
+static int64_t
+nccf(const int16_t *x, uint32_t nsamp, uint16_t offset, int shift, int lag,
+    int64_t sum)
+{
+  uint64_t head = (uint64_t)lag_dot(x, nsamp - lag, 0, offset) >> (shift - ENERGY_SHIFT);
+  uint64_t tail = (uint64_t)lag_dot(x + lag, nsamp - lag, 0, offset) >> (shift - ENERGY_SHIFT);
+  uint32_t norm = isqrt64(head * tail);
+
+  return norm ? (sum << NCCF_BITS) / norm : 0;
+}
+
+
+/*
+ * The peak at lag peak, with AUTOCORRELATE_FRAC_BITS fractional bits,
+ * from the vertex of the parabola through the sums a, b and c at
+ * peak - 1, peak and peak + 1
+ */
+static int32_t
+peak_vertex(int peak, int64_t a, int64_t b, int64_t c)
+{
+  int64_t curvature = 2 * b - a - c;
+  int64_t offset = 0;
+  const int64_t half = 1 << (AUTOCORRELATE_FRAC_BITS - 1);
+
+  // (c - a) / (2 (2b - a - c)), within half a sample of the peak
+  if (curvature > 0) {
+    offset = div_round((c - a) << AUTOCORRELATE_FRAC_BITS, 2 * curvature);
+    if (offset > half)
+      offset = half;
+    else if (offset < -half)
+      offset = -half;
+  }
+
+  return ((int32_t)peak << AUTOCORRELATE_FRAC_BITS) + (int32_t)offset;
+}
+
+
+/*
+ * The direct search, for both entry points: returns the period in
+ * whole samples, and sets *frac to it with AUTOCORRELATE_FRAC_BITS
+ * fractional bits if frac is not NULL
+ */
+static int
+detect_period(const void *samples, uint32_t nsamp,
+    autocorrelate_sample_format_t format, int32_t *frac)
+{
+  const int16_t *x = samples;
+  uint16_t offset = midscale[format];
+  int shift = sum_shift[format];
+  peak_search_t ps = { 0 };
+  int period = -1;
+
+  // Stops at the first peak: the lags after it are never computed
+  for (int i=0; i < nsamp && period < 0; i++)
+    period = peak_search_step(&ps, i, lag_dot(x, nsamp, i, offset) >> shift);
+
+  if (period >= 0 && frac != NULL) {
+    int64_t a = nccf(x, nsamp, offset, shift, period - 1, ps.sums[0]);
+    int64_t b = nccf(x, nsamp, offset, shift, period, ps.sums[1]);
+    int64_t c = nccf(x, nsamp, offset, shift, period + 1, ps.sums[2]);
+    int p = period;
+
+    // Follow the peak up the normalized sums
+    while (c > b && p + 2 < nsamp) {
+      p++;
+      a = b;
+      b = c;
+      c = nccf(x, nsamp, offset, shift, p + 1,
+          lag_dot(x, nsamp, p + 1, offset) >> shift);
+    }
+    *frac = peak_vertex(p, a, b, c);
+  }
+
+  // -1 if no correlation found
+  return period;
+}
 
 
 /*
  * See documentation in .h file
  */
 int
-autocorrelate_detect_period(void *samples, uint32_t nsamp,
+autocorrelate_detect_period(const void *samples, uint32_t nsamp,
     autocorrelate_sample_format_t format)
 {
-  int32_t sum = 0;
-  int prev_sum = 0;
-  int32_t thresh = 0;
-  bool slope_positive = false;
+  return detect_period(samples, nsamp, format, NULL);
+}
 
-  int32_t s1 = 0;
-  int32_t s2 = 0;
-  
-  sum = 0;
-  for (int i=0; i < nsamp; i++) {
-    prev_sum = sum;
-    sum = 0;
-
-    for (int k=0; k < nsamp - i; k++) {
-
-      switch (format) {
-
-      case kAC_12bps_unsigned:
-        s1 = (int32_t)*((uint16_t*)samples + k) - (1 << 11);
-        s2 = (int32_t)*((uint16_t*)samples + k+i) - (1 << 11);
-        sum += (s1 * s2) >> 12;
-        break;
-
-      case kAC_16bps_unsigned:
-        s1 = (int32_t)*((uint16_t*)samples + k) - (1 << 15);
-        s2 = (int32_t)*((uint16_t*)samples + k+i) - (1 << 15);
-        sum += (s1 * s2) >> 16;
-        break;
-
-      case kAC_12bps_signed:
-      case kAC_16bps_signed:
-        s1 = *((int16_t*)samples + k);
-        s2 = *((int16_t*)samples + k+i);
-        sum += (s1 * s2) >> (format == kAC_12bps_signed ? 12 : 16);
-        break;
+
+/*
+ * See documentation in .h file
+ */
+int32_t
+autocorrelate_detect_period_frac(const void *samples, uint32_t nsamp,
+    autocorrelate_sample_format_t format)
+{
+  int32_t frac = -1;
+
+  detect_period(samples, nsamp, format, &frac);
+  return frac;
+}
+
+
+/*
+ * cos and sin of 2*pi / 2^k in q31, indexed by k. q31 cannot hold
+ * +1.0, so it is INT32_MAX.
+ */
+#define FFT_MAX_LOG2  16
+
+static const int32_t twiddle_step[FFT_MAX_LOG2 + 1][2] = {
+  {  INT32_MAX,           0 },  // 2^0, unused
+  {  INT32_MIN,           0 },  // 2^1
+  {          0,   INT32_MAX },  // 2^2
+  { 1518500250,  1518500250 },  // 2^3
+  { 1984016189,   821806413 },  // 2^4
+  { 2106220352,   418953276 },  // 2^5
+  { 2137142927,   210490206 },  // 2^6
+  { 2144896910,   105372028 },  // 2^7
+  { 2146836866,    52701887 },  // 2^8
+  { 2147321946,    26352928 },  // 2^9
+  { 2147443222,    13176712 },  // 2^10
+  { 2147473542,     6588387 },  // 2^11
+  { 2147481121,     3294197 },  // 2^12
+  { 2147483016,     1647099 },  // 2^13
+  { 2147483490,      823550 },  // 2^14
+  { 2147483609,      411775 },  // 2^15
+  { 2147483638,      205887 },  // 2^16
+};
+
+
+/*
+ * A q31 complex number; w is also used for the twiddle factors, which
+ * are stepped around the unit circle by repeated multiplication
+ */
+typedef struct {
+  int32_t re;
+  int32_t im;
+} cq31_t;
+
+
+/*
+ * Rounds a q62 product to q31, saturating: a twiddle stepped round to
+ * exactly +-1 or +-j would otherwise wrap to the opposite sign.
+ */
+static inline int32_t
+round_q31(int64_t x)
+{
+  x = (x + (1 << 30)) >> 31;
+  if (x > INT32_MAX)
+    return INT32_MAX;
+  if (x < INT32_MIN)
+    return INT32_MIN;
+  return (int32_t)x;
+}
+
+
+static inline cq31_t
+cmul_q31(cq31_t a, cq31_t b)
+{
+  cq31_t r;
+
+  r.re = round_q31((int64_t)a.re * b.re - (int64_t)a.im * b.im);
+  r.im = round_q31((int64_t)a.re * b.im + (int64_t)a.im * b.re);
+  return r;
+}
+
+
+static inline int
+log2_u32(uint32_t n)
+{
+  int k = 0;
+
+  while ((1U << k) < n)
+    k++;
+  return k;
+}
+
+
+/*
+ * In-place radix-2 complex FFT of n points (a power of two) stored as
+ * interleaved re, im. Each stage halves its outputs, so the result is
+ * the DFT divided by n and cannot overflow. The inverse uses the
+ * conjugate twiddles.
+ */
+static void
+fft_q31(int32_t *z, uint32_t n, bool inverse)
+{
+  // Bit-reversed order first, so the butterflies work in place
+  for (uint32_t i=1, j=0; i < n; i++) {
+    uint32_t bit = n >> 1;
+
+    for (; j & bit; bit >>= 1)
+      j ^= bit;
+    j |= bit;
+    if (i < j) {
+      int32_t t;
+      t = z[2*i]; z[2*i] = z[2*j]; z[2*j] = t;
+      t = z[2*i+1]; z[2*i+1] = z[2*j+1]; z[2*j+1] = t;
+    }
+  }
+
+  for (uint32_t len=2, k=1; len <= n; len <<= 1, k++) {
+    uint32_t half = len / 2;
+    cq31_t step = { twiddle_step[k][0], inverse ? twiddle_step[k][1] : -twiddle_step[k][1] };
+    cq31_t w = { INT32_MAX, 0 };
+
+    // One twiddle for all the butterflies that use it
+    for (uint32_t j=0; j < half; j++) {
+      for (uint32_t i=j; i < n; i += len) {
+        cq31_t b = { z[2*(i+half)], z[2*(i+half)+1] };
+        cq31_t t = (k == 1) ? b : cmul_q31(b, w);
+        int64_t are = z[2*i];
+        int64_t aim = z[2*i+1];
+
+        z[2*i] = (int32_t)((are + t.re) >> 1);
+        z[2*i+1] = (int32_t)((aim + t.im) >> 1);
+        z[2*(i+half)] = (int32_t)((are - t.re) >> 1);
+        z[2*(i+half)+1] = (int32_t)((aim - t.im) >> 1);
+      }
+      w = cmul_q31(w, step);
+    }
+  }
+}
+
+
+/*
+ * Bins k and n-k of the real FFT of 2n points, halved, from bins k
+ * and n-k of the n-point complex FFT of the even/odd packed samples.
+ * w is e^(-2*pi*i*k / 2n).
+ */
+static inline void
+real_fft_pair(const int32_t *z, uint32_t n, uint32_t k, cq31_t w,
+    uint64_t *p_k, uint64_t *p_nk)
+{
+  uint32_t nk = (n - k) & (n - 1);  // for k = 0 this gives bin n
+  cq31_t e, o, t;
+  int64_t re, im;
+
+  // Even and odd parts: (Z[k] + conj Z[n-k]) / 2, (Z[k] - conj Z[n-k]) / 2
+  e.re = (int32_t)(((int64_t)z[2*k] + z[2*nk]) >> 1);
+  e.im = (int32_t)(((int64_t)z[2*k+1] - z[2*nk+1]) >> 1);
+  o.re = (int32_t)(((int64_t)z[2*k] - z[2*nk]) >> 1);
+  o.im = (int32_t)(((int64_t)z[2*k+1] + z[2*nk+1]) >> 1);
+  t = cmul_q31(o, w);
+
+  // X[k] = E - j t and X[n-k] = conj E - j conj t, halved
+  re = ((int64_t)e.re + t.im) >> 1;
+  im = ((int64_t)e.im - t.re) >> 1;
+  *p_k = (uint64_t)(re * re) + (uint64_t)(im * im);
+  re = ((int64_t)e.re - t.im) >> 1;
+  im = (-(int64_t)e.im - t.re) >> 1;
+  *p_nk = (uint64_t)(re * re) + (uint64_t)(im * im);
+}
+
+
+uint32_t
+autocorrelate_fft_work_len(uint32_t nsamp)
+{
+  uint32_t m = 4;
+
+  while (m < 2 * nsamp)
+    m <<= 1;
+  return m;
+}
+
+
+/*
+ * The FFT search, for both entry points, as detect_period
+ */
+static int
+detect_period_fft(const void *samples, uint32_t nsamp,
+    autocorrelate_sample_format_t format, int32_t *work, uint32_t work_len,
+    int32_t *frac)
+{
+  const uint16_t *u = (const uint16_t *)samples;
+  const int16_t *s = (const int16_t *)samples;
+  uint32_t m = autocorrelate_fft_work_len(nsamp);  // real FFT length
+  uint32_t n = m / 2;                              // complex FFT length
+  int32_t offset = 0;
+  int32_t peak = 0;
+  int shift = 0;
+  uint64_t max_power = 0;
+  cq31_t step, w;
+  peak_search_t ps = { 0 };
+
+  assert(work_len >= m && log2_u32(m) <= FFT_MAX_LOG2);
+  if (nsamp < 2)
+    return -1;
+
+  // Centered samples, scaled up so the largest is near 2^30
+  if (format == kAC_12bps_unsigned)
+    offset = 1 << 11;
+  else if (format == kAC_16bps_unsigned)
+    offset = 1 << 15;
+  for (uint32_t i=0; i < nsamp; i++) {
+    int32_t v = (format == kAC_12bps_signed || format == kAC_16bps_signed) ?
+        s[i] : (int32_t)u[i] - offset;
+
+    work[i] = v;
+    if (v < 0)
+      v = -v;
+    if (v > peak)
+      peak = v;
+  }
+  if (peak == 0)
+    return -1;  // flat: nothing to correlate
+  while ((peak << shift) < (1 << 29))
+    shift++;
+  for (uint32_t i=0; i < nsamp; i++)
+    work[i] <<= shift;
+  for (uint32_t i=nsamp; i < m; i++)
+    work[i] = 0;  // zero padding: linear, not circular, correlation
+
+  // Real FFT of m points as a complex FFT of the even/odd pairs
+  fft_q31(work, n, false);
+
+  // The power spectrum is scaled to peak at 2^29 so the inverse
+  // cannot overflow. Find its peak first, then replace each pair of
+  // bins k, n-k with the packed input of the inverse real FFT.
+  step = (cq31_t) { twiddle_step[log2_u32(m)][0], -twiddle_step[log2_u32(m)][1] };
+  w = (cq31_t) { INT32_MAX, 0 };
+  for (uint32_t k=0; k <= n/2; k++) {
+    uint64_t p_k, p_nk;
+
+    real_fft_pair(work, n, k, w, &p_k, &p_nk);
+    if (p_k > max_power)
+      max_power = p_k;
+    if (p_nk > max_power)
+      max_power = p_nk;
+    w = cmul_q31(w, step);
+  }
+  shift = 0;
+  while ((max_power >> shift) > (1U << 29))
+    shift++;
+
+  w = (cq31_t) { INT32_MAX, 0 };
+  for (uint32_t k=0; k <= n/2; k++) {
+    uint32_t nk = n - k;
+    uint64_t p_k, p_nk;
+    int32_t sum, diff, c, sn;
+
+    real_fft_pair(work, n, k, w, &p_k, &p_nk);
+
+    // Z'[k] = (P[k] + P[n-k]) + j e^(2*pi*i*k / m) (P[k] - P[n-k])
+    sum = (int32_t)((p_k >> shift) + (p_nk >> shift));
+    diff = (int32_t)(p_k >> shift) - (int32_t)(p_nk >> shift);
+    c = w.re;
+    sn = -w.im;
+    if (k == 0) {
+      work[0] = sum;
+      work[1] = diff;
+    } else {
+      int32_t sd = round_q31((int64_t)sn * diff);
+      int32_t cd = round_q31((int64_t)c * diff);
+
+      work[2*k] = sum - sd;
+      work[2*k+1] = cd;
+      if (nk != k) {
+        work[2*nk] = sum + sd;
+        work[2*nk+1] = cd;
       }
     }
-    
-    if (i == 0) {
-      thresh = sum / 2;
-
-    } else if ((sum > thresh) && (sum - prev_sum > 0)) {
-      // slope is positive, so now enter mode where we're looking for
-      // negative slope
-      slope_positive = true;
-
-    } else if (slope_positive && (sum - prev_sum) <= 0) {
-      // We have crested the peak and started down the other
-      // side; actual peak was one sample back
-      return i-1;
+    w = cmul_q31(w, step);
+  }
+
+  // The inverse gives the autocorrelation in order, even lags in the
+  // real parts and odd lags in the imaginary parts
+  fft_q31(work, n, true);
+
+  for (int i=0; i < nsamp; i++) {
+    int period = peak_search_step(&ps, i, work[i]);
+
+    if (period >= 0 && frac != NULL) {
+      // The energies are summed directly, as in detect_period
+      uint16_t x_offset = midscale[format];
+      int x_shift = sum_shift[format];
+      int64_t a, b, c;
+      int p = period;
+
+      a = nccf(s, nsamp, x_offset, x_shift, period - 1, work[period - 1]);
+      b = nccf(s, nsamp, x_offset, x_shift, period, work[period]);
+      c = nccf(s, nsamp, x_offset, x_shift, period + 1, work[period + 1]);
+      while (c > b && p + 2 < nsamp) {
+        p++;
+        a = b;
+        b = c;
+        c = nccf(s, nsamp, x_offset, x_shift, p + 1, work[p + 1]);
+      }
+      *frac = peak_vertex(p, a, b, c);
     }
+    if (period >= 0)
+      return period;
   }
 
   // no correlation found
@@ -82,11 +617,37 @@ autocorrelate_detect_period(void *samples, uint32_t nsamp,
 }
 
 
+/*
+ * See documentation in .h file
+ */
+int
+autocorrelate_detect_period_fft(const void *samples, uint32_t nsamp,
+    autocorrelate_sample_format_t format, int32_t *work, uint32_t work_len)
+{
+  return detect_period_fft(samples, nsamp, format, work, work_len, NULL);
+}
+
+
+/*
+ * See documentation in .h file
+ */
+int32_t
+autocorrelate_detect_period_fft_frac(const void *samples, uint32_t nsamp,
+    autocorrelate_sample_format_t format, int32_t *work, uint32_t work_len)
+{
+  int32_t frac = -1;
+
+  detect_period_fft(samples, nsamp, format, work, work_len, &frac);
+  return frac;
+}
+
+
 //#define TESTING
 
 #ifdef TESTING
 
 #include <stdio.h>
+#include <stdlib.h>
 #include "fp_trig.h"
 
 #define BUF_SIZE 1024
@@ -121,7 +682,66 @@ int main()
     assert(period-res2 <= slop && res2-period <= slop);
     assert(period-res3 <= slop && res3-period <= slop);
     assert(period-res4 <= slop && res4-period <= slop);
+
+    // The FFT path runs the same peak picking on the same correlation,
+    // computed with different rounding
+    static int32_t work[2 * BUF_SIZE];
+    assert(autocorrelate_fft_work_len(BUF_SIZE) == 2 * BUF_SIZE);
+    res1 = autocorrelate_detect_period_fft(signed_12bps_test, BUF_SIZE,
+        kAC_12bps_signed, work, 2 * BUF_SIZE);
+    res2 = autocorrelate_detect_period_fft(unsigned_12bps_test, BUF_SIZE,
+        kAC_12bps_unsigned, work, 2 * BUF_SIZE);
+    res3 = autocorrelate_detect_period_fft(signed_16bps_test, BUF_SIZE,
+        kAC_16bps_signed, work, 2 * BUF_SIZE);
+    res4 = autocorrelate_detect_period_fft(unsigned_16bps_test, BUF_SIZE,
+        kAC_16bps_unsigned, work, 2 * BUF_SIZE);
+
+    assert(period-res1 <= slop && res1-period <= slop);
+    assert(period-res2 <= slop && res2-period <= slop);
+    assert(period-res3 <= slop && res3-period <= slop);
+    assert(period-res4 <= slop && res4-period <= slop);
+
+    // The fractional period does much better, by either method
+    const int32_t frac_slop = 1 << (AUTOCORRELATE_FRAC_BITS - 4);  // 1/16 sample
+    int32_t frac[] = {
+      autocorrelate_detect_period_frac(signed_12bps_test, BUF_SIZE, kAC_12bps_signed),
+      autocorrelate_detect_period_frac(unsigned_12bps_test, BUF_SIZE, kAC_12bps_unsigned),
+      autocorrelate_detect_period_frac(signed_16bps_test, BUF_SIZE, kAC_16bps_signed),
+      autocorrelate_detect_period_frac(unsigned_16bps_test, BUF_SIZE, kAC_16bps_unsigned),
+      autocorrelate_detect_period_fft_frac(signed_12bps_test, BUF_SIZE,
+          kAC_12bps_signed, work, 2 * BUF_SIZE),
+      autocorrelate_detect_period_fft_frac(unsigned_16bps_test, BUF_SIZE,
+          kAC_16bps_unsigned, work, 2 * BUF_SIZE),
+    };
+    for (int f=0; f < sizeof(frac) / sizeof(frac[0]); f++)
+      assert(abs(frac[f] - (period << AUTOCORRELATE_FRAC_BITS)) <= frac_slop);
   }
+
+  // Full-scale 16-bit square waves: each product is 2^30, so the sums
+  // need 64 bits, and the buffer must come back unchanged
+  for (int period = 12; period <= 240; period += 12) {
+    for (int i=0; i < BUF_SIZE; i++) {
+      bool high = (i % period) < period / 2;
+
+      signed_16bps_test[i] = high ? INT16_MAX : INT16_MIN;
+      unsigned_16bps_test[i] = high ? UINT16_MAX : 0;
+    }
+
+    int res1 = autocorrelate_detect_period(signed_16bps_test, BUF_SIZE, kAC_16bps_signed);
+    int res2 = autocorrelate_detect_period(unsigned_16bps_test, BUF_SIZE, kAC_16bps_unsigned);
+
+    assert(period-res1 <= slop && res1-period <= slop);
+    assert(period-res2 <= slop && res2-period <= slop);
+    for (int i=0; i < BUF_SIZE; i++) {
+      bool high = (i % period) < period / 2;
+
+      assert(signed_16bps_test[i] == (high ? INT16_MAX : INT16_MIN));
+      assert(unsigned_16bps_test[i] == (high ? UINT16_MAX : 0));
+    }
+  }
+
+  printf("autocorrelate: all periods detected\n");
+  return 0;
 }
 
 #endif
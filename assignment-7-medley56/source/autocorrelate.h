@@ -17,10 +17,14 @@ typedef enum {
   kAC_16bps_signed      // 16 bits per sample, signed samples
 } autocorrelate_sample_format_t;
   
+// Fractional bits of the periods from the _frac functions
+#define AUTOCORRELATE_FRAC_BITS  8
+
 
 /*
  * Determine the fundamental period of a waveform using
- * autocorrelation
+ * autocorrelation. The samples are only read, so they may be const
+ * (e.g. in flash) or shared with other readers.
  *
  * Parameters:
  *   samples   Array of samples
@@ -31,8 +35,73 @@ typedef enum {
  *   The recovered fundamental period of the waveform, expressed in
  *   number of samples, or -1 if no correlation was found
  */
-int autocorrelate_detect_period(void *samples, uint32_t nsamp,
+int autocorrelate_detect_period(const void *samples, uint32_t nsamp,
     autocorrelate_sample_format_t format);
 
 
+/*
+ * Same as autocorrelate_detect_period, but to a fraction of a sample:
+ * the period is the vertex of a parabola through the autocorrelation
+ * at the peak and either side of it. Those are first normalized by the
+ * energy of the samples each one multiplies, as the raw sums droop at
+ * longer lags and move the peak off the true period (by up to a sample
+ * at periods of 150-320 in 1024 samples). So the result can be more
+ * than half a sample from what autocorrelate_detect_period returns.
+ *
+ * Parameters:
+ *   samples   Array of samples
+ *   nsamp     Number of samples
+ *   format    The format for the samples (see above)
+ *
+ * Returns:
+ *   The recovered fundamental period of the waveform in samples, with
+ *   AUTOCORRELATE_FRAC_BITS fractional bits, or -1 if no correlation
+ *   was found
+ */
+int32_t autocorrelate_detect_period_frac(const void *samples, uint32_t nsamp,
+    autocorrelate_sample_format_t format);
+
+
+/*
+ * Number of int32_t words of workspace that
+ * autocorrelate_detect_period_fft needs for nsamp samples: the
+ * smallest power of two that is at least 2 * nsamp. For a power of
+ * two nsamp this is simply 2 * nsamp.
+ */
+uint32_t autocorrelate_fft_work_len(uint32_t nsamp);
+
+
+/*
+ * Same as autocorrelate_detect_period, but computes the
+ * autocorrelation in O(n log n) as the inverse FFT of the power
+ * spectrum, using q31 fixed-point math. The samples are zero-padded
+ * to twice their length, so the result is the same linear
+ * autocorrelation (to within rounding) and goes through the same peak
+ * picking.
+ *
+ * Parameters:
+ *   samples   Array of samples
+ *   nsamp     Number of samples
+ *   format    The format for the samples (see above)
+ *   work      Workspace, at least autocorrelate_fft_work_len(nsamp)
+ *             words; overwritten
+ *   work_len  Number of words in work
+ *
+ * Returns:
+ *   The recovered fundamental period of the waveform, expressed in
+ *   number of samples, or -1 if no correlation was found
+ */
+int autocorrelate_detect_period_fft(const void *samples, uint32_t nsamp,
+    autocorrelate_sample_format_t format, int32_t *work, uint32_t work_len);
+
+
+/*
+ * autocorrelate_detect_period_frac by way of the FFT: the parameters
+ * are those of autocorrelate_detect_period_fft, and the result that of
+ * autocorrelate_detect_period_frac.
+ */
+int32_t autocorrelate_detect_period_fft_frac(const void *samples, uint32_t nsamp,
+    autocorrelate_sample_format_t format, int32_t *work, uint32_t work_len);
+
+
 #endif  //  _AUTOCORRELATE_H_
@@ -10,14 +10,9 @@
 
 #include <stdint.h>
 
-#define SAMPLE_BUFFER_MAX_SIZE (1024U)  // 1024 samples in buffer
-/* Modes for waveform specification */
-#define SQUARE_MODE (0U)
-#define SINE_MODE (1U)
-#define TRIANGLE_MODE (2U)
+#include "waveforms.h"
 
-extern uint16_t sample_buffer[SAMPLE_BUFFER_MAX_SIZE];  // Buffer to store waveform samples for DAC output
-extern size_t num_samples;  // Number of valid samples stored in sample buffer
+#define SAMPLE_BUFFER_MAX_SIZE (1024U)  // 1024 samples in buffer
 
 
 /*
@@ -26,30 +21,35 @@ extern size_t num_samples;  // Number of valid samples stored in sample buffer
 void init_dac(void);
 
 /*
- * @brief Rudimentary triangle wave not at any specific frequency.
+ * @brief Play synthesized tones instead of the waveform tables, starting with the first.
  *
- * It simply increments up to 4096 and back down to zero
+ * Needs TPM0 to be initialized, as the DDS works at its rate. The DMA interrupt synthesizes
+ * each block as the previous one plays.
  */
-void triangle_output(void);
+void Start_DDS_Playback(void);
 
 /*
- * @brief Given a mode, fill the global buffer with up to 1024 waveform sample values.
+ * @brief Move on to the next synthesized tone, without a break in phase
+ */
+void Next_DDS_Tone(void);
+
+/*
+ * @brief Rudimentary triangle wave not at any specific frequency.
  *
- * Also set the number of samples global variable because it will vary based on waveform frequency
- * and sampling frequency.
+ * It simply increments up to 4096 and back down to zero
  */
-void waveform_to_samples(int mode);
+void triangle_output(void);
 
 /*
- * @brief Print the sample buffer to the debug console using PRINTF
+ * @brief Print a waveform's samples to the debug console using PRINTF
  */
-void print_sample_buffer(void);
+void print_sample_buffer(const waveform_t *waveform);
 
 /*
- * @brief Prototype function to test playing back a predefined buffer through the DAC
+ * @brief Prototype function to test playing back a predefined waveform through the DAC
  *
  * Does not use DMA or precise timing. This is just to check the shape of the waveform and look for tearing.
  */
-void playback_buffer(void);
+void playback_buffer(const waveform_t *waveform);
 
 #endif /* DAC_H_ */
@@ -0,0 +1,159 @@
+/*
+ * dds.c
+ *
+ * Direct digital synthesis. The top DDS_TABLE_BITS of the phase pick
+ * an entry of dds_sine_table and the next 16 bits interpolate linearly
+ * to the following one, which leaves the sine error far below the
+ * 12-bit DAC's quantization. Triangle and square waves come straight
+ * from the phase. All three cross mid-scale upwards at phase 0, so a
+ * change of waveform keeps its place in the period.
+ */
+
+#include <stddef.h>
+
+#include "dds.h"
+#include "waveforms.h"
+
+#define PHASE_BITS (32U)
+#define INDEX_SHIFT (PHASE_BITS - DDS_TABLE_BITS)
+#define FRAC_SHIFT (INDEX_SHIFT - 16U)  // 16 fractional bits between entries
+#define QUARTER_PERIOD (1U << (PHASE_BITS - 2))
+#define Q15_ONE (32768)
+
+
+void dds_init(dds_t *dds, uint32_t sample_rate)
+{
+	dds->sample_rate = sample_rate;
+	dds->phase = 0;
+	dds->increment = 0;
+	dds->amplitude = 0;
+	dds->target_amplitude = 0;
+	dds->mode = SINE_MODE;
+	dds->staged = 0;
+}
+
+
+/*
+ * The phase step per sample for this frequency
+ */
+static uint32_t dds_increment(const dds_t *dds, uint32_t frequency_mhz)
+{
+	/* increment = f / fs * 2^32, rounded; f is in mHz */
+	uint64_t scaled_rate = (uint64_t) dds->sample_rate * 1000U;
+
+	return (uint32_t) ((((uint64_t) frequency_mhz << PHASE_BITS) + scaled_rate / 2)
+			/ scaled_rate);
+}
+
+
+void dds_set_frequency(dds_t *dds, uint32_t frequency_mhz)
+{
+	dds->increment = dds_increment(dds, frequency_mhz);
+}
+
+
+uint32_t dds_frequency(const dds_t *dds)
+{
+	uint64_t scaled = (uint64_t) dds->increment * dds->sample_rate * 1000U;
+
+	return (uint32_t) ((scaled + (1ULL << (PHASE_BITS - 1))) >> PHASE_BITS);
+}
+
+
+void dds_set_amplitude(dds_t *dds, uint32_t amplitude)
+{
+	dds->target_amplitude = amplitude > DAC_MIDL ? DAC_MIDL : amplitude;
+}
+
+
+void dds_set_mode(dds_t *dds, uint32_t mode)
+{
+	dds->mode = mode;
+}
+
+
+void dds_set_tone(dds_t *dds, uint32_t mode, uint32_t frequency_mhz, uint32_t amplitude)
+{
+	uint32_t increment = dds_increment(dds, frequency_mhz);
+
+	/* Withdraw any tone still staged first, so a dds_fill() that runs
+	 * part way through sees no tone rather than half of this one */
+	dds->staged = 0;
+	dds->staged_mode = mode;
+	dds->staged_increment = increment;
+	dds->staged_amplitude = amplitude > DAC_MIDL ? DAC_MIDL : amplitude;
+	dds->staged = 1;
+}
+
+
+/*
+ * The waveform at this phase, in Q15
+ */
+static int32_t dds_shape(uint32_t mode, uint32_t phase)
+{
+	if (mode == SQUARE_MODE)
+	{
+		return phase < (2 * QUARTER_PERIOD) ? Q15_ONE - 1 : -(Q15_ONE - 1);
+	}
+	else if (mode == TRIANGLE_MODE)
+	{
+		/* A quarter period on, fold the top half of the period back down:
+		 * 2^30 (mid-scale) at phase 0, up to 2^31 - 1 and back */
+		uint32_t t = phase + QUARTER_PERIOD;
+
+		t ^= (uint32_t) ((int32_t) t >> 31);
+		return (int32_t) (t >> 15) - Q15_ONE;
+	}
+	else
+	{
+		uint32_t index = phase >> INDEX_SHIFT;
+		int32_t frac = (int32_t) ((phase >> FRAC_SHIFT) & 0xFFFFU);
+		int32_t s0 = dds_sine_table[index];
+		int32_t s1 = dds_sine_table[index + 1];
+
+		return s0 + (((s1 - s0) * frac) >> 16);
+	}
+}
+
+
+void dds_fill(dds_t *dds, uint16_t *samples, uint32_t n)
+{
+	if (dds->staged)
+	{
+		dds->mode = dds->staged_mode;
+		dds->increment = dds->staged_increment;
+		dds->target_amplitude = dds->staged_amplitude;
+		dds->staged = 0;
+	}
+
+	/* Read what the setters write once, so the whole block is consistent */
+	uint32_t mode = dds->mode;
+	uint32_t increment = dds->increment;
+	uint32_t target = dds->target_amplitude;
+	uint32_t phase = dds->phase;
+	/* Amplitude in Q16, ramped to the target over the block */
+	int32_t amplitude = (int32_t) (dds->amplitude << 16);
+	int32_t step = 0;
+
+	if (n == 0)
+	{
+		return;
+	}
+	if (target != dds->amplitude)
+	{
+		step = ((int32_t) (target << 16) - amplitude) / (int32_t) n;
+	}
+
+	for (uint32_t i = 0; i < n; i++)
+	{
+		int32_t value = dds_shape(mode, phase);
+
+		amplitude += step;
+		value = (value * (amplitude >> 16) + (1 << 14)) >> 15;
+		samples[i] = (uint16_t) ((int32_t) DAC_MIDH + value);
+		phase += increment;
+	}
+
+	dds->phase = phase;
+	dds->amplitude = target;
+}
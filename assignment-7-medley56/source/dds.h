@@ -0,0 +1,88 @@
+/*
+ * dds.h
+ *
+ * Direct digital synthesis: a 32-bit phase accumulator stepped by a
+ * fractional increment once per DAC sample, so any frequency plays
+ * from the same fixed-size buffer, without needing a whole number of
+ * periods in it. Frequency, amplitude and waveform can change between
+ * blocks without a break in phase.
+ */
+
+#ifndef DDS_H_
+#define DDS_H_
+
+#include <stdint.h>
+
+typedef struct {
+	uint32_t sample_rate;   // Hz
+	uint32_t phase;         // 2^32 is one period
+	uint32_t increment;     // phase step per sample
+	uint32_t amplitude;     // DAC codes from mid-scale to peak, as of the last sample
+	uint32_t target_amplitude;
+	uint32_t mode;          // SQUARE_MODE, SINE_MODE or TRIANGLE_MODE
+	/* A whole tone from dds_set_tone(), for the next dds_fill() to take up */
+	volatile uint32_t staged;
+	volatile uint32_t staged_mode;
+	volatile uint32_t staged_increment;
+	volatile uint32_t staged_amplitude;
+} dds_t;
+
+/*
+ * Resets the phase to zero and sets a silent sine (amplitude 0).
+ *
+ * Parameters:
+ *   dds          Synthesizer state
+ *   sample_rate  Rate the samples are played at, in Hz
+ */
+void dds_init(dds_t *dds, uint32_t sample_rate);
+
+/*
+ * Sets the frequency, to within sample_rate / 2^32, from the next
+ * sample on. The phase carries on from where it is.
+ *
+ * Parameters:
+ *   frequency_mhz  Frequency in millihertz, up to half the sample rate
+ */
+void dds_set_frequency(dds_t *dds, uint32_t frequency_mhz);
+
+/*
+ * Returns the frequency that is actually playing, in millihertz,
+ * rounded
+ */
+uint32_t dds_frequency(const dds_t *dds);
+
+/*
+ * Sets the amplitude, from mid-scale to peak in DAC codes, at most
+ * DAC_MIDL. The next block ramps to it linearly, so there is no step.
+ */
+void dds_set_amplitude(dds_t *dds, uint32_t amplitude);
+
+/*
+ * Sets the waveform (SQUARE_MODE, SINE_MODE or TRIANGLE_MODE) from the
+ * next block on. The phase carries on from where it is.
+ */
+void dds_set_mode(dds_t *dds, uint32_t mode);
+
+/*
+ * Stages a waveform, frequency and amplitude, as the setters above
+ * take them, for the next dds_fill() to switch to all at once. Unlike
+ * the setters, this may be called from the main loop while dds_fill()
+ * runs from the DMA interrupt: no block plays part of one tone and
+ * part of another. A tone staged again before it is taken up replaces
+ * it.
+ */
+void dds_set_tone(dds_t *dds, uint32_t mode, uint32_t frequency_mhz, uint32_t amplitude);
+
+/*
+ * Fills a block of DAC samples and advances the phase past it, first
+ * taking up any tone staged by dds_set_tone(). It must not be
+ * interrupted by a dds_set_tone() on the same dds.
+ *
+ * Parameters:
+ *   dds      Synthesizer state
+ *   samples  Buffer for n 12-bit DAC codes, centered on DAC_MIDH
+ *   n        Number of samples
+ */
+void dds_fill(dds_t *dds, uint16_t *samples, uint32_t n);
+
+#endif /* DDS_H_ */
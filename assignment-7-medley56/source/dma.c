@@ -5,21 +5,86 @@
  *      Author: gmedley
  */
 
+#include <assert.h>
+#include <stddef.h>
+
 #include "dma.h"
 #include "board.h"
 #include "log.h"
 
 #define ADC_CHCFG_SOURCE (54U)  // See Ch 22 of the Reference Manual
+#define TPM_CLOCK (48000000U)  // MCGPLLCLK/2, see Init_TPM0
+#define DMA_MAX_BYTE_COUNT (0xFFFFFU)  // BCR is 20 bits wide (Ch 23 of the Reference Manual)
+#define DMA_MAX_MODULO (15U)  // SMOD 15 is a 256 KB buffer
 
 
 /* These globals store the source pointer and number of bytes to copy during playback.
  * When changing waveforms, these should be changed.
  */
-uint16_t * Reload_DMA_Source = 0;
+const uint16_t * Reload_DMA_Source = 0;
 uint32_t Reload_DMA_Byte_Count = 0;
 
+/* Source address modulo (SMOD) of a ring buffer the DMA wraps around on its own, so
+ * the interrupt only has to reload the byte count; 0 if it restarts the buffer instead.
+ */
+static uint32_t Playback_Modulo = 0;
+
+/* When streaming, playback alternates between the two halves of this buffer, and the
+ * refill callback fills each half as soon as it has been played.
+ */
+static uint16_t * Stream_Buffer = 0;
+static uint32_t Stream_Half_Count = 0;
+static uint32_t Stream_Next_Half = 0;  // The half the DMA is playing, 0 or 1
+static playback_refill_t Stream_Refill = 0;
+
+
+/*
+ * SMOD value for the DMA to wrap around this buffer, or 0 if it can't: the size in
+ * bytes has to be a power of two from 16 bytes to 256 KB, and the buffer aligned to it
+ */
+static uint32_t Ring_Modulo(const uint16_t * buffer, uint32_t count)
+{
+	uint32_t bytes = count * 2;
+	uint32_t mod = 1;
+
+	if (bytes < 16 || (bytes & (bytes - 1)) != 0 || ((uintptr_t) buffer & (bytes - 1)) != 0)
+	{
+		return 0;
+	}
+	while ((16U << (mod - 1)) < bytes)
+	{
+		mod++;
+	}
+	return mod <= DMA_MAX_MODULO ? mod : 0;
+}
+
+
+/*
+ * The largest whole number of passes over a ring buffer the byte count can hold
+ */
+static uint32_t Ring_Byte_Count(uint32_t count)
+{
+	uint32_t bytes = count * 2;
+
+	return (DMA_MAX_BYTE_COUNT / bytes) * bytes;
+}
+
+
+/*
+ * Set the source modulo, and the byte count the interrupt reloads
+ */
+static void Set_Playback_Modulo(uint32_t mod, uint32_t count)
+{
+	Playback_Modulo = mod;
+	Reload_DMA_Byte_Count = (mod != 0) ? Ring_Byte_Count(count) : count*2;
+	DMA0->DMA[0].DCR = (DMA0->DMA[0].DCR & ~DMA_DCR_SMOD_MASK) | DMA_DCR_SMOD(mod);
+}
+
+
+void Init_DMA_For_Playback(const uint16_t * source, uint32_t count) {
+	// Play the same buffer over and over
+	Stream_Refill = 0;
 
-void Init_DMA_For_Playback(uint16_t * source, uint32_t count) {
 	// Save reload information
 	Reload_DMA_Source = source;
 	Reload_DMA_Byte_Count = count*2;
@@ -45,13 +110,38 @@ void Init_DMA_For_Playback(uint16_t * source, uint32_t count) {
 
 	// Enable DMA MUX channel with TPM0 overflow as trigger and enable the trigger
 	DMAMUX0->CHCFG[0] = DMAMUX_CHCFG_SOURCE(ADC_CHCFG_SOURCE); // | DMAMUX_CHCFG_TRIG_MASK;
+
+	Playback_Modulo = 0;
+}
+
+
+void Init_DMA_For_Ring_Playback(const uint16_t * ring, uint32_t count) {
+	uint32_t mod = Ring_Modulo(ring, count);
+
+	assert(mod != 0);
+	Init_DMA_For_Playback(ring, count);
+	Set_Playback_Modulo(mod, count);
+}
+
+
+void Init_DMA_For_Streaming(uint16_t * buffer, uint32_t count, playback_refill_t refill) {
+	// Fill both halves before starting on the first
+	refill(buffer, count);
+	Init_DMA_For_Ring_Playback(buffer, count);
+
+	// Wrap around the whole buffer, but stop after each half to refill it
+	Reload_DMA_Byte_Count = count;
+	Stream_Buffer = buffer;
+	Stream_Half_Count = count / 2;
+	Stream_Next_Half = 0;
+	Stream_Refill = refill;
 }
 
 
 void Start_DMA_Playback() {
 	// initialize source and destination pointers
-	DMA0->DMA[0].SAR = DMA_SAR_SAR((uint32_t) Reload_DMA_Source);  // Copy from the buffer
-	DMA0->DMA[0].DAR = DMA_DAR_DAR((uint32_t) (&(DAC0->DAT[0])));  // Copy to the DAC data register
+	DMA0->DMA[0].SAR = DMA_SAR_SAR((uint32_t) (uintptr_t) Reload_DMA_Source);  // Copy from the buffer
+	DMA0->DMA[0].DAR = DMA_DAR_DAR((uint32_t) (uintptr_t) (&(DAC0->DAT[0])));  // Copy to the DAC data register
 	// byte count
 	DMA0->DMA[0].DSR_BCR = DMA_DSR_BCR_BCR(Reload_DMA_Byte_Count);
 	// clear done flag
@@ -61,11 +151,49 @@ void Start_DMA_Playback() {
 }
 
 
-void DMA0_IRQHandler(void) {
-	// Clear done flag
-	DMA0->DMA[0].DSR_BCR |= DMA_DSR_BCR_DONE_MASK;
-	// Start the next DMA playback cycle
+void Switch_DMA_Playback(const uint16_t * source, uint32_t count) {
+	// The DMA interrupt reloads from these, so don't let it see only one of them change
+	uint32_t pm = __get_PRIMASK();
+	__disable_irq();
+
+	Reload_DMA_Source = source;
+	Stream_Refill = 0;
+
+	// Stop requests, abandon the rest of the old buffer and start on the new one, as a
+	// ring if it can be
+	DMAMUX0->CHCFG[0] &= ~DMAMUX_CHCFG_ENBL_MASK;
+	DMA0->DMA[0].DSR_BCR = DMA_DSR_BCR_DONE_MASK;
+	Set_Playback_Modulo(Ring_Modulo(source, count), count);
 	Start_DMA_Playback();
+
+	__set_PRIMASK(pm);
+}
+
+
+void DMA0_IRQHandler(void) {
+	if (Playback_Modulo != 0)
+	{
+		// The source address has already wrapped round to where playback carries on,
+		// so just clear done and reload the count. The TPM0 request waits meanwhile, so
+		// nothing is lost as long as this happens within a sample period.
+		DMA0->DMA[0].DSR_BCR = DMA_DSR_BCR_DONE_MASK;
+		DMA0->DMA[0].DSR_BCR = DMA_DSR_BCR_BCR(Reload_DMA_Byte_Count);
+
+		if (Stream_Refill != 0)
+		{
+			// The count just reloaded starts the DMA on the other half: refill the one just played
+			uint16_t * played = Stream_Buffer + Stream_Next_Half * Stream_Half_Count;
+			Stream_Next_Half ^= 1;
+			Stream_Refill(played, Stream_Half_Count);
+		}
+	}
+	else
+	{
+		// Clear done flag
+		DMA0->DMA[0].DSR_BCR |= DMA_DSR_BCR_DONE_MASK;
+		// Start the next DMA playback cycle
+		Start_DMA_Playback();
+	}
 }
 
 
@@ -88,6 +216,12 @@ void Init_TPM0(uint32_t period_us)
 }
 
 
+uint32_t Get_TPM0_Sample_Rate(void)
+{
+	return TPM_CLOCK / (TPM0->MOD + 1);
+}
+
+
 void Start_TPM0(void)
 {
 	// Enable counter
@@ -10,16 +10,55 @@
 
 #include <stdint.h>
 
+/* Called from the DMA interrupt to fill a buffer of samples that has just been played */
+typedef void (*playback_refill_t)(uint16_t * samples, uint32_t count);
+
 /*
  * @brief Initialize the DMA peripheral
  */
-void Init_DMA_For_Playback(uint16_t * source, uint32_t count);
+void Init_DMA_For_Playback(const uint16_t * source, uint32_t count);
+
+/*
+ * @brief Initialize the DMA peripheral to play a ring buffer over and over by itself.
+ *
+ * The ring's size in bytes must be a power of two from 16 bytes to 256 KB, and it must be
+ * aligned to its size. The DMA wraps round it with source address modulo, so instead of an
+ * interrupt and a restart after each pass, there is only one to reload the byte count
+ * when it runs out, about every 5.5 s at 96 kHz.
+ */
+void Init_DMA_For_Ring_Playback(const uint16_t * ring, uint32_t count);
+
+/*
+ * @brief Restart playback from another buffer of samples, e.g. another waveform table.
+ *
+ * Only the source pointer and byte count change; the rest of the configuration stays.
+ * The buffer plays as a ring if it could be passed to Init_DMA_For_Ring_Playback().
+ */
+void Switch_DMA_Playback(const uint16_t * source, uint32_t count);
+
+/*
+ * @brief Initialize the DMA peripheral to stream samples through a ping-pong buffer.
+ *
+ * count samples are split into two halves. While the DMA plays one, refill is called to
+ * fill the other, so the buffer size doesn't depend on what is played. The buffer is a
+ * ring, as for Init_DMA_For_Ring_Playback(), but that only wraps the address: the byte
+ * count runs out at the end of every half and the DMA stops until the interrupt reloads
+ * it. The interrupt has to get there within one sample period, at about 186 interrupts
+ * a second at 96 kHz, or the DAC misses a sample. Start with Start_DMA_Playback();
+ * Init_DMA_For_Playback() or Switch_DMA_Playback() end it.
+ */
+void Init_DMA_For_Streaming(uint16_t * buffer, uint32_t count, playback_refill_t refill);
 
 /*
  * @brief Initialize the TPM0 timer that triggers the DMA
  */
 void Init_TPM0(uint32_t period_us);
 
+/*
+ * @brief Rate TPM0 triggers DMA transfers at, in Hz (rounded down)
+ */
+uint32_t Get_TPM0_Sample_Rate(void);
+
 /*
  * @brief Start the TPM0 timer
  */
@@ -0,0 +1,323 @@
+/*
+ * fp_trig.c: a fixed-point implementation of sin and cos (and their
+ * inverses)
+ *
+ * fp_sin and fp_cos interpolate linearly in a quarter-wave table of
+ * sines, kept with 4 more bits than the result so that only the final
+ * rounding shows. Built with FP_TRIG_CORDIC defined, they use CORDIC
+ * instead and the table is left out; the CORDIC and Taylor series
+ * versions are available either way, for comparison.
+ *
+ * Angles are first reduced modulo TWO_PI, then folded into a quarter
+ * period using PI and HALF_PI. Those are rounded to whole units, which
+ * costs less than half a unit of the result.
+ */
+
+#include <assert.h>
+
+#include "fp_trig.h"
+#include "isqrt.h"
+
+/*
+ * sin(i * SIN_LOOKUP_STEP / TRIG_SCALE_FACTOR), scaled by
+ * TRIG_SCALE_FACTOR << SIN_LOOKUP_SHIFT, over a quarter period
+ */
+#define SIN_LOOKUP_STEP    (50)   // HALF_PI / 64
+#define SIN_LOOKUP_SIZE    (HALF_PI / SIN_LOOKUP_STEP + 1)
+#define SIN_LOOKUP_SHIFT   (4)
+
+#ifndef FP_TRIG_CORDIC
+static const int16_t sin_lookup[SIN_LOOKUP_SIZE] = {
+      0,   800,  1599,  2398,  3195,  3990,  4783,  5572,
+   6359,  7142,  7920,  8693,  9462, 10224, 10981, 11731,
+  12473, 13209, 13936, 14655, 15365, 16066, 16757, 17438,
+  18109, 18768, 19417, 20053, 20678, 21290, 21889, 22475,
+  23048, 23606, 24151, 24681, 25196, 25695, 26180, 26648,
+  27101, 27537, 27957, 28359, 28745, 29113, 29464, 29797,
+  30112, 30409, 30688, 30948, 31190, 31412, 31616, 31801,
+  31967, 32113, 32240, 32347, 32435, 32504, 32553, 32582,
+  32592
+};
+#endif
+
+/*
+ * CORDIC: angles are in units of 1 / (TRIG_SCALE_FACTOR << 16)
+ * radians, and vectors are scaled by 1 << 14, which leaves room for
+ * the gain of 1.647 within 32 bits
+ */
+#define CORDIC_ITERATIONS  (16)
+#define CORDIC_ANGLE_SHIFT (16)
+#define CORDIC_SHIFT       (14)
+#define CORDIC_X0          (20266586)  // TRIG_SCALE_FACTOR / 1.647 << CORDIC_SHIFT
+
+// atan(2^-i)
+static const int32_t cordic_atan[CORDIC_ITERATIONS] = {
+  104848167, 61895487, 32703875, 16600998, 8332713, 4170419, 2085718, 1042923,
+  521469, 260736, 130368, 65184, 32592, 16296, 8148, 4074
+};
+
+/* Taylor series terms carry this many extra fraction bits */
+#define TAYLOR_SHIFT       (16)
+
+
+int32_t fp_radians(int degrees)
+{
+  int64_t scaled = (int64_t)degrees * PI;
+
+  // round to nearest, away from zero
+  if (scaled < 0)
+    return (int32_t)((scaled - 90) / 180);
+  return (int32_t)((scaled + 90) / 180);
+}
+
+
+/*
+ * Reduces x to [0, TWO_PI)
+ */
+static int32_t reduce(int32_t x)
+{
+  x %= TWO_PI;
+  if (x < 0)
+    x += TWO_PI;
+  return x;
+}
+
+
+/*
+ * Folds r in [0, TWO_PI) into [0, HALF_PI], returning the sign of
+ * sin(r) and setting *folded such that sin(r) = sign * sin(*folded)
+ */
+static int32_t fold(int32_t r, int32_t *folded)
+{
+  int32_t sign = 1;
+
+  if (r >= PI) {
+    r -= PI;
+    sign = -1;
+  }
+  if (r > HALF_PI)
+    r = PI - r;
+
+  *folded = r;
+  return sign;
+}
+
+
+/*
+ * CORDIC rotation of (CORDIC_X0, 0) through r in [-HALF_PI, HALF_PI],
+ * giving sin(r) and cos(r) * TRIG_SCALE_FACTOR << CORDIC_SHIFT
+ */
+static void cordic_rotate(int32_t r, int32_t *sin_r, int32_t *cos_r)
+{
+  int32_t x = CORDIC_X0;
+  int32_t y = 0;
+  int32_t z = r << CORDIC_ANGLE_SHIFT;
+
+  for (int i = 0; i < CORDIC_ITERATIONS; i++) {
+    int32_t dx = y >> i;
+    int32_t dy = x >> i;
+
+    if (z >= 0) {
+      x -= dx;
+      y += dy;
+      z -= cordic_atan[i];
+    } else {
+      x += dx;
+      y -= dy;
+      z += cordic_atan[i];
+    }
+  }
+
+  *sin_r = y;
+  *cos_r = x;
+}
+
+
+/*
+ * CORDIC sine of r in [0, TWO_PI)
+ */
+static int32_t cordic_sin_reduced(int32_t r)
+{
+  int32_t folded, s, c;
+  int32_t sign = fold(r, &folded);
+
+  cordic_rotate(folded, &s, &c);
+  return sign * ((s + (1 << (CORDIC_SHIFT - 1))) >> CORDIC_SHIFT);
+}
+
+
+#ifndef FP_TRIG_CORDIC
+/*
+ * Table sine of r in [0, TWO_PI)
+ */
+static int32_t lookup_sin_reduced(int32_t r)
+{
+  int32_t folded, i, frac, y;
+  int32_t sign = fold(r, &folded);
+
+  i = folded / SIN_LOOKUP_STEP;
+  frac = folded % SIN_LOOKUP_STEP;
+  if (i == SIN_LOOKUP_SIZE - 1)
+    return sign * TRIG_SCALE_FACTOR;
+
+  // interpolate, then drop the extra bits, rounding once
+  y = sin_lookup[i] * SIN_LOOKUP_STEP + (sin_lookup[i+1] - sin_lookup[i]) * frac;
+  y = (y + (SIN_LOOKUP_STEP << (SIN_LOOKUP_SHIFT - 1))) / (SIN_LOOKUP_STEP << SIN_LOOKUP_SHIFT);
+  return sign * y;
+}
+#endif
+
+
+/*
+ * Sine of r in [0, TWO_PI), by whichever method this is built for
+ */
+static int32_t sin_reduced(int32_t r)
+{
+#ifdef FP_TRIG_CORDIC
+  return cordic_sin_reduced(r);
+#else
+  return lookup_sin_reduced(r);
+#endif
+}
+
+
+int32_t fp_sin(int32_t x)
+{
+  return sin_reduced(reduce(x));
+}
+
+
+int32_t fp_cos(int32_t x)
+{
+  return sin_reduced(reduce(reduce(x) + HALF_PI));
+}
+
+
+int32_t cordic_fp_sin(int32_t x)
+{
+  return cordic_sin_reduced(reduce(x));
+}
+
+
+int32_t cordic_fp_cos(int32_t x)
+{
+  return cordic_sin_reduced(reduce(reduce(x) + HALF_PI));
+}
+
+
+int32_t taylor_fp_sin(int32_t x)
+{
+  int32_t r;
+  int32_t sign = fold(reduce(x), &r);
+  int64_t term = (int64_t)r << TAYLOR_SHIFT;
+  int64_t sum = term;
+
+  // x - x^3/3! + x^5/5! - ..., until the terms no longer show
+  for (int32_t n = 2; term != 0; n += 2) {
+    term = -term * r / TRIG_SCALE_FACTOR * r / TRIG_SCALE_FACTOR / (n * (n + 1));
+    sum += term;
+  }
+
+  return sign * (int32_t)((sum + (1 << (TAYLOR_SHIFT - 1))) >> TAYLOR_SHIFT);
+}
+
+
+void fp_sin_batch(const int32_t *x, int32_t *y, uint32_t n)
+{
+  for (uint32_t i = 0; i < n; i++)
+    y[i] = sin_reduced(reduce(x[i]));
+}
+
+
+void fp_cos_batch(const int32_t *x, int32_t *y, uint32_t n)
+{
+  for (uint32_t i = 0; i < n; i++)
+    y[i] = sin_reduced(reduce(reduce(x[i]) + HALF_PI));
+}
+
+
+void fp_sin_ramp(int32_t x0, int32_t dx, int32_t *y, uint32_t n)
+{
+  // stepping the reduced phase needs no division per sample
+  int32_t r = reduce(x0);
+  int32_t step = reduce(dx);
+
+  for (uint32_t i = 0; i < n; i++) {
+    y[i] = sin_reduced(r);
+    r += step;
+    if (r >= TWO_PI)
+      r -= TWO_PI;
+  }
+}
+
+
+int32_t fp_asin(int32_t x)
+{
+  assert(x >= -TRIG_SCALE_FACTOR && x <= TRIG_SCALE_FACTOR);
+
+#ifdef FP_TRIG_CORDIC
+  // CORDIC vectoring: the angle of (sqrt(1 - x^2), x)
+  int32_t vx = (int32_t)isqrt64(TRIG_SCALE_FACTOR * TRIG_SCALE_FACTOR - x * x) << CORDIC_SHIFT;
+  int32_t vy = x << CORDIC_SHIFT;
+  int32_t z = 0;
+
+  for (int i = 0; i < CORDIC_ITERATIONS; i++) {
+    int32_t dx = vy >> i;
+    int32_t dy = vx >> i;
+
+    if (vy > 0) {
+      vx += dx;
+      vy -= dy;
+      z += cordic_atan[i];
+    } else {
+      vx -= dx;
+      vy += dy;
+      z -= cordic_atan[i];
+    }
+  }
+  return (z + (1 << (CORDIC_ANGLE_SHIFT - 1))) >> CORDIC_ANGLE_SHIFT;
+#else
+  // find the table entries either side of |x|, and interpolate between them
+  int32_t target = (x < 0 ? -x : x) << SIN_LOOKUP_SHIFT;
+  int32_t lo = 0;
+  int32_t hi = SIN_LOOKUP_SIZE - 1;
+  int32_t angle;
+
+  while (hi - lo > 1) {
+    int32_t mid = (lo + hi) / 2;
+
+    if (sin_lookup[mid] <= target)
+      lo = mid;
+    else
+      hi = mid;
+  }
+  angle = fp_interpolate(target, sin_lookup[lo], lo * SIN_LOOKUP_STEP,
+      sin_lookup[hi], hi * SIN_LOOKUP_STEP);
+
+  return x < 0 ? -angle : angle;
+#endif
+}
+
+
+int32_t fp_acos(int32_t x)
+{
+  return HALF_PI - fp_asin(x);
+}
+
+
+int32_t fp_interpolate(int32_t x, int32_t x1, int32_t y1,
+    int32_t x2, int32_t y2)
+{
+  int32_t num = (x - x1) * (y2 - y1);
+  int32_t den = x2 - x1;
+
+  if (den < 0) {
+    num = -num;
+    den = -den;
+  }
+
+  // round to nearest, away from zero
+  if (num < 0)
+    return y1 + (num - den / 2) / den;
+  return y1 + (num + den / 2) / den;
+}
@@ -0,0 +1,240 @@
+/*
+ * goertzel.c
+ *
+ * Goertzel filter bank. For each tone, every sample x runs through
+ *
+ *   s = x + coeff * s1 - s2,  s2 = s1,  s1 = s
+ *
+ * and at the end of the block the energy at the tone's frequency is
+ *
+ *   P = s1^2 + s2^2 - coeff * s1 * s2
+ *
+ * which is |X|^2 of the DFT at that frequency, (A N / 2)^2 for a tone
+ * of amplitude A. The block's total AC energy is kept alongside, from
+ * the sums of the samples and their squares, to give each tone's share
+ * of it and its SNR.
+ *
+ * Samples are reduced to 12 bits around mid-scale, the DAC's
+ * resolution, so that with at least one cycle per block of at most
+ * GOERTZEL_MAX_BLOCK samples |s| < N 2^11 / sin(2 pi / N) < 2^29. The
+ * coefficients have GOERTZEL_COEFF_BITS fractional bits: with fewer,
+ * the low frequencies would be noticeably off, as 2 cos is so close to
+ * 2 there. The products are rounded, not truncated, as the bias would
+ * build up in the filter; what rounding is left still makes SNRs over
+ * about 45 dB come out too high.
+ */
+
+#include <assert.h>
+#include <math.h>
+#include <stddef.h>
+
+#include "goertzel.h"
+#include "isqrt.h"
+
+#define MIDSCALE (32768)
+#define SAMPLE_SHIFT (4U)  // 16-bit ADC codes to 12 bits
+#define COEFF_ROUND (1 << (GOERTZEL_COEFF_BITS - 1))
+#define DB_PER_OCTAVE_Q8 (771)  // 10 log10(2) = 3.0103 dB, in 1/256
+
+
+void goertzel_init(goertzel_t *g, uint32_t sample_rate, uint32_t block_size,
+		const uint32_t *frequencies, uint32_t num_tones)
+{
+	assert(num_tones <= GOERTZEL_MAX_TONES);
+	assert(block_size > 0 && block_size <= GOERTZEL_MAX_BLOCK);
+
+	g->num_tones = num_tones;
+	g->block_size = block_size;
+	for (uint32_t t = 0; t < num_tones; t++)
+	{
+		/* Once per tone, so double precision is affordable even without an FPU */
+		double w = 2 * M_PI * frequencies[t] / sample_rate;
+
+		assert((uint64_t) frequencies[t] * block_size >= sample_rate);
+		assert((uint64_t) (sample_rate / 2 - frequencies[t]) * block_size >= sample_rate);
+		g->tones[t].frequency = frequencies[t];
+		g->tones[t].coeff = (int32_t) lround(2 * cos(w) * (1 << GOERTZEL_COEFF_BITS));
+	}
+	goertzel_reset(g);
+}
+
+
+/*
+ * Clears the filter states and sums for the next block
+ */
+static void start_block(goertzel_t *g)
+{
+	for (uint32_t t = 0; t < g->num_tones; t++)
+	{
+		g->tones[t].s1 = 0;
+		g->tones[t].s2 = 0;
+	}
+	g->count = 0;
+	g->sum = 0;
+	g->sum_sq = 0;
+}
+
+
+void goertzel_reset(goertzel_t *g)
+{
+	start_block(g);
+	for (uint32_t t = 0; t < g->num_tones; t++)
+	{
+		g->tones[t].amplitude = 0;
+		g->tones[t].share_q16 = 0;
+		g->tones[t].snr_db = 0;
+	}
+	g->blocks = 0;
+}
+
+
+/*
+ * log2(x) with 8 fractional bits, for x > 0, to within 0.01
+ */
+static int32_t log2_q8(uint64_t x)
+{
+	int32_t msb = 0;
+	int32_t frac;
+
+	for (int32_t step = 32; step > 0; step /= 2)
+	{
+		if (x >> (msb + step))
+		{
+			msb += step;
+		}
+	}
+	frac = (int32_t) ((msb >= 8 ? x >> (msb - 8) : x << (8 - msb)) & 0xFF);
+	/* log2(1 + f) is about f + 0.34 f (1 - f) */
+	return (msb << 8) + frac + ((frac * (256 - frac) * 87) >> 16);
+}
+
+
+/*
+ * Works out each tone's results from the block just completed
+ */
+static void finish_block(goertzel_t *g)
+{
+	uint32_t n = g->block_size;
+	/* AC energy: the sum of squares about the block's own mean */
+	int64_t energy = (int64_t) g->sum_sq - ((int64_t) g->sum * g->sum) / n;
+
+	for (uint32_t t = 0; t < g->num_tones; t++)
+	{
+		goertzel_tone_t *tone = &g->tones[t];
+		int64_t s1 = tone->s1;
+		int64_t s2 = tone->s2;
+		int64_t power = s1 * s1 + s2 * s2 - ((tone->coeff * s1) >> GOERTZEL_COEFF_BITS) * s2;
+		/* The tone's own sum of squares over the block, A^2 N / 2 */
+		int64_t tone_energy;
+		int64_t rest;
+
+		if (power < 0)
+		{
+			power = 0;
+		}
+		tone_energy = 2 * power / n;
+		rest = energy - tone_energy;
+
+		tone->amplitude = (uint32_t) (((uint64_t) isqrt64((uint64_t) power) << (SAMPLE_SHIFT + 1)) / n);
+		if (energy <= 0 || tone_energy == 0)
+		{
+			tone->share_q16 = 0;
+			tone->snr_db = -(GOERTZEL_MAX_SNR_DB << GOERTZEL_SNR_FRAC_BITS);
+			continue;
+		}
+		tone->share_q16 = (tone_energy >= energy) ? 65536U : (uint32_t) ((tone_energy << 16) / energy);
+		if (rest <= 0)
+		{
+			tone->snr_db = GOERTZEL_MAX_SNR_DB << GOERTZEL_SNR_FRAC_BITS;
+		}
+		else
+		{
+			int32_t db = ((log2_q8((uint64_t) tone_energy) - log2_q8((uint64_t) rest))
+					* DB_PER_OCTAVE_Q8) >> 8;
+
+			if (db > (GOERTZEL_MAX_SNR_DB << GOERTZEL_SNR_FRAC_BITS))
+			{
+				db = GOERTZEL_MAX_SNR_DB << GOERTZEL_SNR_FRAC_BITS;
+			}
+			else if (db < -(GOERTZEL_MAX_SNR_DB << GOERTZEL_SNR_FRAC_BITS))
+			{
+				db = -(GOERTZEL_MAX_SNR_DB << GOERTZEL_SNR_FRAC_BITS);
+			}
+			tone->snr_db = db;
+		}
+	}
+	g->blocks++;
+}
+
+
+uint32_t goertzel_process(goertzel_t *g, const uint16_t *samples, uint32_t n)
+{
+	uint32_t completed = 0;
+
+	while (n > 0)
+	{
+		uint32_t chunk = g->block_size - g->count;
+
+		if (chunk > n)
+		{
+			chunk = n;
+		}
+
+		/* The energy first, then one filter at a time over the chunk, so each
+		 * keeps its state and coefficient in registers */
+		for (uint32_t i = 0; i < chunk; i++)
+		{
+			int32_t x = ((int32_t) samples[i] - MIDSCALE) >> SAMPLE_SHIFT;
+
+			g->sum += x;
+			g->sum_sq += (uint32_t) (x * x);
+		}
+		for (uint32_t t = 0; t < g->num_tones; t++)
+		{
+			goertzel_tone_t *tone = &g->tones[t];
+			int64_t coeff = tone->coeff;
+			int32_t s1 = tone->s1;
+			int32_t s2 = tone->s2;
+
+			for (uint32_t i = 0; i < chunk; i++)
+			{
+				int32_t x = ((int32_t) samples[i] - MIDSCALE) >> SAMPLE_SHIFT;
+				int32_t s = x + (int32_t) ((coeff * s1 + COEFF_ROUND) >> GOERTZEL_COEFF_BITS) - s2;
+
+				s2 = s1;
+				s1 = s;
+			}
+			tone->s1 = s1;
+			tone->s2 = s2;
+		}
+
+		samples += chunk;
+		n -= chunk;
+		g->count += chunk;
+		if (g->count == g->block_size)
+		{
+			finish_block(g);
+			start_block(g);
+			completed++;
+		}
+	}
+	return completed;
+}
+
+
+int32_t goertzel_detect(const goertzel_t *g)
+{
+	int32_t best = -1;
+
+	for (uint32_t t = 0; t < g->num_tones; t++)
+	{
+		const goertzel_tone_t *tone = &g->tones[t];
+
+		if (tone->share_q16 >= GOERTZEL_MIN_SHARE_Q16 && tone->amplitude >= GOERTZEL_MIN_AMPLITUDE
+				&& (best < 0 || tone->share_q16 > g->tones[best].share_q16))
+		{
+			best = (int32_t) t;
+		}
+	}
+	return best;
+}
@@ -0,0 +1,102 @@
+/*
+ * goertzel.h
+ *
+ * A bank of Goertzel filters: the energy at each of a few known
+ * frequencies, over blocks of ADC samples, in fixed point. Where the
+ * autocorrelation searches every lag for whatever period is there,
+ * this only asks whether each target tone is present, at O(N) per tone.
+ * Samples can arrive in any size of chunk; the results are updated
+ * every block_size samples.
+ */
+
+#ifndef GOERTZEL_H_
+#define GOERTZEL_H_
+
+#include <stdint.h>
+
+#define GOERTZEL_MAX_TONES  (8U)
+#define GOERTZEL_MAX_BLOCK  (1024U)  // keeps the filter states within 32 bits
+#define GOERTZEL_COEFF_BITS (28U)    // fractional bits of the filter coefficients
+
+/*
+ * goertzel_detect() only reports a tone holding at least this share of
+ * the block's AC energy, in 1/65536 (0.5), and this peak amplitude, in
+ * 16-bit ADC codes (1/64 of full scale)
+ */
+#define GOERTZEL_MIN_SHARE_Q16  (32768U)
+#define GOERTZEL_MIN_AMPLITUDE  (512U)
+
+/* SNRs are in dB with this many fractional bits, and at most GOERTZEL_MAX_SNR_DB */
+#define GOERTZEL_SNR_FRAC_BITS  (8U)
+#define GOERTZEL_MAX_SNR_DB     (99)
+
+typedef struct {
+	uint32_t frequency;  // Hz
+	int32_t coeff;       // 2 cos(2 pi f / fs), with GOERTZEL_COEFF_BITS fractional bits
+	int32_t s1;          // filter state, the last two outputs
+	int32_t s2;
+	/* Results of the last whole block */
+	uint32_t amplitude;  // peak, in 16-bit ADC codes
+	uint32_t share_q16;  // share of the block's AC energy in this tone, 65536 is all of it
+	int32_t snr_db;      // this tone against all the rest, GOERTZEL_SNR_FRAC_BITS, good to ~45 dB
+} goertzel_tone_t;
+
+typedef struct {
+	goertzel_tone_t tones[GOERTZEL_MAX_TONES];
+	uint32_t num_tones;
+	uint32_t block_size;
+	uint32_t count;      // samples into the current block
+	int32_t sum;         // of the current block's samples, 12 bits around mid-scale
+	uint64_t sum_sq;
+	uint32_t blocks;     // whole blocks since the reset
+} goertzel_t;
+
+/*
+ * Sets up a filter for each target frequency, and resets.
+ *
+ * The tones are separated best when each is a whole number of cycles
+ * in a block: at 48 kHz, 240 samples (5 ms) hold 2, 3 and 4 cycles of
+ * 400, 600 and 800 Hz, so each of those reads zero from the others,
+ * and from the DC offset. Otherwise the tones leak into each other's
+ * filters, the more so the fewer cycles there are in a block.
+ *
+ * Parameters:
+ *   g            Filter bank
+ *   sample_rate  Rate the samples are taken at, in Hz
+ *   block_size   Samples per result, up to GOERTZEL_MAX_BLOCK
+ *   frequencies  num_tones target frequencies in Hz, each between
+ *                sample_rate / block_size and half the sample rate
+ *                less that
+ *   num_tones    Up to GOERTZEL_MAX_TONES
+ */
+void goertzel_init(goertzel_t *g, uint32_t sample_rate, uint32_t block_size,
+		const uint32_t *frequencies, uint32_t num_tones);
+
+/*
+ * Starts a new block and clears the results, e.g. after samples were
+ * lost
+ */
+void goertzel_reset(goertzel_t *g);
+
+/*
+ * Runs samples through every filter.
+ *
+ * Parameters:
+ *   g        Filter bank
+ *   samples  16-bit unsigned samples, as read from the ADC
+ *   n        Number of samples, any length
+ *
+ * Returns:
+ *   The number of blocks completed; the results are those of the last
+ *   one
+ */
+uint32_t goertzel_process(goertzel_t *g, const uint16_t *samples, uint32_t n);
+
+/*
+ * Returns the index of the strongest tone in the last block, if it has
+ * at least GOERTZEL_MIN_SHARE_Q16 of the energy and an amplitude of at
+ * least GOERTZEL_MIN_AMPLITUDE, or -1
+ */
+int32_t goertzel_detect(const goertzel_t *g);
+
+#endif /* GOERTZEL_H_ */
@@ -0,0 +1,33 @@
+/*
+ * isqrt.c
+ *
+ * Integer square root
+ */
+
+#include "isqrt.h"
+
+
+uint32_t isqrt64(uint64_t x)
+{
+	uint64_t root = 0;
+	uint64_t bit = (uint64_t) 1 << 62;
+
+	while (bit > x)
+	{
+		bit >>= 2;
+	}
+	while (bit != 0)
+	{
+		if (x >= root + bit)
+		{
+			x -= root + bit;
+			root = (root >> 1) + bit;
+		}
+		else
+		{
+			root >>= 1;
+		}
+		bit >>= 2;
+	}
+	return (uint32_t) root;
+}
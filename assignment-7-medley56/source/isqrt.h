@@ -0,0 +1,21 @@
+/*
+ * isqrt.h
+ *
+ * Integer square root, shared by the modules that need one: the
+ * autocorrelation's normalization, the Goertzel amplitudes, the
+ * waveform statistics and the CORDIC arcsine.
+ */
+
+#ifndef ISQRT_H_
+#define ISQRT_H_
+
+#include <stdint.h>
+
+/*
+ * @brief The largest r with r*r <= x, by the digit-by-digit method:
+ * one compare and subtract per result bit, with no multiplies or
+ * divisions, as the M0+ has no divider
+ */
+uint32_t isqrt64(uint64_t x);
+
+#endif /* ISQRT_H_ */
@@ -36,6 +36,7 @@
 #include "pin_mux.h"
 #include "test_sine.h"
 #include "dac.h"
+#include "waveforms.h"
 #include "adc.h"
 #include "dma.h"
 #include "log.h"
@@ -72,11 +73,22 @@ int main(void)
 	LOG("Starting DMA trigger timer (TPM0)...");
 	Start_TPM0();
 
-	/* This is where we start playing out through the DAC (in the systick interrupt) */
+	/* Start playing out through the DAC, synthesized or straight from the flash tables;
+	 * the systick interrupt moves on to the next tone or waveform */
+#ifdef DDS_PLAYBACK
+	Start_DDS_Playback();
+#else
+	LOG("Running %s waveform", waveforms[SQUARE_MODE].name);
+	Init_DMA_For_Playback(waveforms[SQUARE_MODE].samples, waveforms[SQUARE_MODE].num_samples);
+	Start_DMA_Playback();
+#endif
     systick_init();
 
     while (1)
     {
-    	// Everything is interrupt-based
+    	// The streaming pitch detector and everything that logs run here,
+    	// so the interrupts only hand over samples and switch waveforms
+    	Process_ADC_Samples();
+    	systick_process();
     }
 }
@@ -0,0 +1,188 @@
+/*
+ * pitch.c
+ *
+ * Streaming YIN pitch detector (de Cheveigne and Kawahara, 2002).
+ *
+ * The difference function
+ *
+ *   d(tau) = sum over the last PITCH_WINDOW samples j of (x[j] - x[j-tau])^2
+ *
+ * is updated for every new sample by adding the term of the sample
+ * that enters the window and subtracting the one that leaves it,
+ * PITCH_MAX_LAG lags at a time. Each block then only normalizes d and
+ * looks for its first dip, which costs PITCH_MAX_LAG steps, however
+ * long the block was.
+ */
+
+#include <stddef.h>
+
+#include "pitch.h"
+
+#define HISTORY_MASK (PITCH_HISTORY - 1)
+
+#if (PITCH_HISTORY & HISTORY_MASK) || PITCH_HISTORY <= PITCH_WINDOW + PITCH_MAX_LAG
+#error "PITCH_HISTORY must be a power of two greater than PITCH_WINDOW + PITCH_MAX_LAG"
+#endif
+
+/*
+ * Samples are 12 bits, so a squared difference is below 2^24 and d
+ * fits in 32 bits for windows of up to 256 samples
+ */
+#if PITCH_WINDOW > 256
+#error "PITCH_WINDOW too long for 32-bit difference sums"
+#endif
+
+
+void pitch_reset(pitch_t *p)
+{
+	for (size_t i = 0; i < PITCH_HISTORY; i++)
+	{
+		p->history[i] = 0;
+	}
+	for (size_t i = 0; i <= PITCH_MAX_LAG; i++)
+	{
+		p->diff[i] = 0;
+	}
+	p->count = 0;
+	p->acc = 0;
+	p->acc_n = 0;
+	p->period = -1;
+}
+
+
+/*
+ * Adds one decimated sample to the history and slides the window of
+ * every d(tau) along by one. Before the history has filled, the
+ * samples missing from it are zero on both sides of the update, so d
+ * is still exact for the zero-extended signal.
+ */
+static void push_sample(pitch_t *p, int16_t x)
+{
+	const int16_t *h = p->history;
+	uint32_t t = p->count;
+	int32_t old = h[(t - PITCH_WINDOW) & HISTORY_MASK];
+
+	p->history[t & HISTORY_MASK] = x;
+	for (uint32_t tau = 1; tau <= PITCH_MAX_LAG; tau++)
+	{
+		int32_t in = x - h[(t - tau) & HISTORY_MASK];
+		int32_t out = old - h[(t - PITCH_WINDOW - tau) & HISTORY_MASK];
+
+		// The true sum is never negative, so modulo 2^32 is exact
+		p->diff[tau] += (uint32_t) (in * in - out * out);
+	}
+	p->count++;
+}
+
+
+/*
+ * Cumulative mean normalized difference d'(tau) = d(tau) * tau / sum
+ * of d(1..tau), in q16. It is at most tau.
+ */
+static uint32_t cmndf_q16(uint32_t d, uint32_t tau, uint64_t cum)
+{
+	if (cum == 0)
+	{
+		return 1U << 16;
+	}
+	return (uint32_t) ((((uint64_t) d * tau) << 16) / cum);
+}
+
+
+/*
+ * YIN steps 3 to 5: the first lag whose d' falls below the threshold,
+ * followed down to the bottom of its dip, refined by fitting a
+ * parabola through d' at the neighbouring lags
+ */
+static int32_t estimate(const pitch_t *p)
+{
+	const uint32_t *d = p->diff;
+	uint64_t cum = 0;
+	uint32_t tau;
+	uint32_t cur, prev, next = 0;
+	const int32_t half = 1 << (PITCH_FRAC_BITS - 1);  // half a lag
+	int32_t offset = 0;
+
+	// No division here: d * tau / cum < threshold, multiplied out
+	for (tau = 1; tau <= PITCH_MAX_LAG; tau++)
+	{
+		cum += d[tau];
+		if (tau >= PITCH_MIN_LAG
+				&& (((uint64_t) d[tau] * tau) << 8) < PITCH_THRESHOLD_Q8 * cum)
+		{
+			break;
+		}
+	}
+	if (tau > PITCH_MAX_LAG)
+	{
+		return -1;  // no dip deep enough: unvoiced, or below the lowest pitch
+	}
+
+	cur = cmndf_q16(d[tau], tau, cum);
+	prev = cmndf_q16(d[tau - 1], tau - 1, cum - d[tau]);
+	while (tau < PITCH_MAX_LAG)
+	{
+		next = cmndf_q16(d[tau + 1], tau + 1, cum + d[tau + 1]);
+		if (next >= cur)
+		{
+			break;
+		}
+		cum += d[++tau];
+		prev = cur;
+		cur = next;
+	}
+
+	if (tau < PITCH_MAX_LAG)
+	{
+		// Vertex of the parabola through (-1, prev), (0, cur), (1, next):
+		// (prev - next) / (2 * curvature) lags
+		int64_t curvature = (int64_t) prev - 2 * (int64_t) cur + next;
+
+		if (curvature > 0)
+		{
+			offset = (int32_t) ((((int64_t) prev - next) * half) / curvature);
+		}
+		if (offset > half)
+		{
+			offset = half;
+		}
+		else if (offset < -half)
+		{
+			offset = -half;
+		}
+	}
+
+	return ((int32_t) (tau << PITCH_FRAC_BITS) + offset) * (int32_t) PITCH_DECIMATION;
+}
+
+
+int32_t pitch_process(pitch_t *p, const uint16_t *samples, uint32_t n)
+{
+	for (uint32_t i = 0; i < n; i++)
+	{
+		p->acc += samples[i];
+		if (++p->acc_n == PITCH_DECIMATION)
+		{
+			// Mean of the group, 16 bits down to 12
+			push_sample(p, (int16_t) (p->acc / (PITCH_DECIMATION << 4)));
+			p->acc = 0;
+			p->acc_n = 0;
+		}
+	}
+
+	if (p->count < PITCH_WINDOW + PITCH_MAX_LAG)
+	{
+		p->period = -1;
+	}
+	else
+	{
+		p->period = estimate(p);
+	}
+	return p->period;
+}
+
+
+int32_t pitch_period(const pitch_t *p)
+{
+	return p->period;
+}
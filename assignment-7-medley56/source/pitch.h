@@ -0,0 +1,71 @@
+/*
+ * pitch.h
+ *
+ * Streaming pitch detector: a YIN difference function kept up to date
+ * one sample at a time, so a fresh period estimate is available after
+ * every block of ADC samples instead of once per one-shot capture.
+ */
+
+#ifndef PITCH_H_
+#define PITCH_H_
+
+#include <stdint.h>
+
+/*
+ * Input samples are averaged in groups of PITCH_DECIMATION before the
+ * difference function sees them: 48 kHz becomes 12 kHz, which keeps
+ * the per-sample work within budget on the M0+. Lags are in decimated
+ * samples; the estimates are converted back to input samples.
+ */
+#define PITCH_DECIMATION   (4U)
+#define PITCH_MIN_LAG      (4U)   // 3 kHz at 12 kHz
+#define PITCH_MAX_LAG      (64U)  // 187.5 Hz at 12 kHz
+#define PITCH_WINDOW       (64U)  // integration window, at least PITCH_MAX_LAG
+#define PITCH_HISTORY      (256U) // power of two > PITCH_WINDOW + PITCH_MAX_LAG
+
+/* Estimates are in input samples with this many fractional bits */
+#define PITCH_FRAC_BITS    (8U)
+
+/*
+ * YIN's absolute threshold on the cumulative mean normalized
+ * difference, in 1/256: 38 is about 0.15
+ */
+#define PITCH_THRESHOLD_Q8 (38U)
+
+typedef struct {
+	int16_t history[PITCH_HISTORY];  // decimated samples, 12 bits
+	uint32_t diff[PITCH_MAX_LAG + 1];  // d(tau) over the last PITCH_WINDOW samples
+	uint32_t count;     // decimated samples seen since the reset
+	uint32_t acc;       // sum of the input samples of the current group
+	uint32_t acc_n;     // number of input samples in acc
+	int32_t period;     // latest estimate, or -1
+} pitch_t;
+
+/*
+ * Clears the history, e.g. after samples were lost
+ */
+void pitch_reset(pitch_t *p);
+
+/*
+ * Feeds a block of samples to the detector and returns the period
+ * estimate at the end of the block.
+ *
+ * Parameters:
+ *   p        Detector state
+ *   samples  16-bit unsigned samples, as read from the ADC
+ *   n        Number of samples; any length, blocks need not be whole
+ *            multiples of PITCH_DECIMATION
+ *
+ * Returns:
+ *   The period in input samples, with PITCH_FRAC_BITS fractional
+ *   bits, or -1 if there is no clear period (or not yet enough
+ *   history)
+ */
+int32_t pitch_process(pitch_t *p, const uint16_t *samples, uint32_t n);
+
+/*
+ * Returns the estimate of the last pitch_process call, or -1
+ */
+int32_t pitch_period(const pitch_t *p);
+
+#endif /* PITCH_H_ */
@@ -11,7 +11,7 @@
 #include "test_sine.h"
 
 /*
- * Test the sine function.
+ * Test a sine function.
  *
  * Your sin function should accept inputs in the range [INT_MIN, INT_MAX] and
  * produce outputs in the range [-TRIG_SCALE_FACTOR, TRIG_SCALE_FACTOR].
@@ -20,7 +20,7 @@
  *
  * Ensure that max_err is <= 2.0 and sum_sq error is <= 12000.
  */
-void test_sin()
+int test_sin_function(const char *name, int32_t (*sin_fn)(int32_t))
 {
   double act_sin;
   double exp_sin;
@@ -30,7 +30,7 @@ void test_sin()
 
   for (int i=-TWO_PI; i <= TWO_PI; i++) {
     exp_sin = sin( (double)i / TRIG_SCALE_FACTOR) * TRIG_SCALE_FACTOR;
-    act_sin = fp_sin(i);
+    act_sin = sin_fn(i);
 
     err = act_sin - exp_sin;
     if (err < 0)
@@ -41,10 +41,21 @@ void test_sin()
     sum_sq += err*err;
   }
 
-  printf("max_err=%f  sum_sq=%f\n\r", max_err, sum_sq);
+  printf("%s: max_err=%f  sum_sq=%f\n\r", name, max_err, sum_sq);
 
   if (max_err > 2.0 || sum_sq > 12000)
   {
 	  printf("Error: Do not proceed. Your sine function needs work\n\r");
+	  return 0;
   }
+  return 1;
+}
+
+/*
+ * Test the sine function. host/trig_bench compares the CORDIC and Taylor
+ * series versions with it.
+ */
+void test_sin()
+{
+  test_sin_function("fp_sin", fp_sin);
 }
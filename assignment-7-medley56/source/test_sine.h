@@ -8,6 +8,9 @@
 #ifndef TEST_SINE_H_
 #define TEST_SINE_H_
 
+#include <stdint.h>
+
+int test_sin_function(const char *name, int32_t (*sin_fn)(int32_t));
 void test_sin();
 void test_square();
 
@@ -10,6 +10,7 @@
 #include "core_cm0plus.h"
 #include "fsl_debug_console.h"
 #include "dac.h"
+#include "waveforms.h"
 #include "adc.h"
 #include "dma.h"
 #include "timing.h"
@@ -27,7 +28,10 @@
 
 static ticktime_t start_time;
 static ticktime_t subseconds_since_startup;  // Count of subseconds since system boot up to (2^32) / 16 / 3600 / 24 = ~3106 days
-uint8_t mode = SQUARE_MODE;
+uint8_t mode = SQUARE_MODE;  // The waveform playing, started by main()
+/* Set by the SysTick handler for systick_process() in the main loop, which does the printing */
+static volatile bool tick_pending = false;
+static volatile uint32_t switch_cycles = 0;  // Core cycles the last waveform switch took
 
 
 void SysTick_Handler()
@@ -36,33 +40,39 @@ void SysTick_Handler()
 	/* Increment internal time counter */
 	subseconds_since_startup++;
 
-	Summarize_Waveform();
+#ifndef DDS_PLAYBACK
+	/* Move on to the next waveform. The tables are in flash, so this only retargets the
+	 * playback DMA; SysTick counts down once every EXT_CLK_PRESCALE core cycles. */
+	mode = (mode + 1) % NUM_WAVEFORMS;
+	uint32_t switch_start = SysTick->VAL;
+	Switch_DMA_Playback(waveforms[mode].samples, waveforms[mode].num_samples);
+	switch_cycles = (switch_start - SysTick->VAL) * EXT_CLK_PRESCALE;
+#endif
+
+	/* Summarizing and logging take milliseconds at 115200 baud, so the main loop does them */
+	tick_pending = true;
+}
 
-	if (mode == SQUARE_MODE)
-	{
-		LOG("Running SQUARE waveform");
-		waveform_to_samples(SQUARE_MODE);
-		mode = SINE_MODE;
-	} else if (mode == SINE_MODE)
-	{
-		LOG("Running SINE waveform");
-		waveform_to_samples(SINE_MODE);
-		mode = TRIANGLE_MODE;
-	}
-	else
+void systick_process()
+{
+	if (!tick_pending)
 	{
-		LOG("Running TRIANGLE waveform");
-		waveform_to_samples(TRIANGLE_MODE);
-		mode = SQUARE_MODE;
+		return;
 	}
+	tick_pending = false;
+
+	/* The capture filled long ago and is still the previous waveform's */
+	Summarize_Waveform();
 
-	/* Start playback with new waveform buffer */
-	Init_DMA_For_Playback(sample_buffer, num_samples);
-	Start_DMA_Playback();
+#ifdef DDS_PLAYBACK
+	Next_DDS_Tone();
+#else
+	LOG("Running %s waveform", waveforms[mode].name);
+	LOG("Waveform switch took %d cycles", switch_cycles);
+#endif
 
-	/* Now that the waveform is playing start sampling with the ADC on TPM1 */
+	/* Now that the waveform is playing start a new capture; TPM1 and the DMA run throughout */
 	Reset_ADC_Sampling();
-	NVIC_EnableIRQ(TPM1_IRQn);
 }
 
 void systick_init()
@@ -20,6 +20,13 @@ typedef uint32_t ticktime_t;
  */
 void systick_init();
 
+/*
+ * Summarize the capture and move on to the next tone after each tick,
+ * and log the waveform switch the SysTick handler made. Call from the
+ * main loop.
+ */
+void systick_process();
+
 /*
  * Return time since startup
  */
@@ -0,0 +1,68 @@
+/*
+ * waveforms.h
+ *
+ * The waveforms the DAC plays, as const tables in flash. The tables in
+ * waveforms.c are generated on the host from the parameters below by
+ * host/waveform_gen, so switching waveforms only has to point the
+ * playback DMA at another table. Other frequencies are synthesized by
+ * dds.c from a sine table generated along with them.
+ */
+
+#ifndef WAVEFORMS_H_
+#define WAVEFORMS_H_
+
+#include <stdint.h>
+
+#define DAC_RESOLUTION (4096U)
+#define DAC_HIGH (DAC_RESOLUTION-1)  // 4095
+#define DAC_MIDH (DAC_RESOLUTION / 2)  // 2048
+#define DAC_MIDL (DAC_MIDH - 1)  // 2047, such that DAC_MIDH + DAC_MIDL = DAC_HIGH
+#define DAC_LOW (0U)  // 0
+#define DAC_SAMPLE_RATE (96000U)  // 96kHz for all waveforms, as specified in assignment
+
+/* Modes for waveform specification, and the index of each in waveforms[] */
+#define SQUARE_MODE (0U)
+#define SINE_MODE (1U)
+#define TRIANGLE_MODE (2U)
+#define NUM_WAVEFORMS (3U)
+
+/* Pre-calculated parameters for each waveform mode */
+/* square */
+#define SQUARE_SAMPLES_PER_PERIOD (240U)
+#define SQUARE_NUM_PERIODS (4U)
+#define SQUARE_NUM_SAMPLES (SQUARE_SAMPLES_PER_PERIOD * SQUARE_NUM_PERIODS)  // Number of samples for square wave buffer
+#define SQUARE_FREQUENCY (400U)  // 400Hz
+/* sine */
+#define SINE_SAMPLES_PER_PERIOD (160U)
+#define SINE_NUM_PERIODS (6U)
+#define SINE_NUM_SAMPLES (SINE_SAMPLES_PER_PERIOD * SINE_NUM_PERIODS)  // Number of samples for sine wave buffer
+#define SINE_FREQUENCY (600U)  // 600Hz
+/* triangle */
+#define TRIANGLE_SAMPLES_PER_PERIOD (120U)
+#define TRIANGLE_NUM_PERIODS (8U)
+#define TRIANGLE_NUM_SAMPLES (TRIANGLE_SAMPLES_PER_PERIOD * TRIANGLE_NUM_PERIODS)  // Number of samples for triangle wave buffer
+#define TRIANGLE_FREQUENCY (800U)  // 800Hz
+
+typedef struct {
+	const char *name;
+	const uint16_t *samples;  // whole periods, DAC codes
+	uint32_t num_samples;
+	uint32_t samples_per_period;
+	uint32_t frequency;       // Hz, at DAC_SAMPLE_RATE
+} waveform_t;
+
+/* Indexed by mode */
+extern const waveform_t waveforms[NUM_WAVEFORMS];
+
+/*
+ * One period of sine for the DDS engine (dds.c), which interpolates
+ * between entries: sin(2 pi i / DDS_TABLE_SIZE) * DDS_TABLE_SCALE, plus
+ * a copy of entry 0 at the end
+ */
+#define DDS_TABLE_BITS (10U)
+#define DDS_TABLE_SIZE (1U << DDS_TABLE_BITS)
+#define DDS_TABLE_SCALE (32767)
+
+extern const int16_t dds_sine_table[DDS_TABLE_SIZE + 1];
+
+#endif /* WAVEFORMS_H_ */
@@ -0,0 +1,136 @@
+/*
+ * wavestats.c
+ *
+ * Streaming waveform statistics. Each sample only updates the extremes
+ * and two integer sums, relative to mid-scale: a few cycles on the M0+,
+ * cheap enough to run on every sample as it is captured.
+ *
+ * The integer sums stand in for Welford's update, which needs a
+ * division per sample. They are exact, so the variance comes out of
+ * them without the cancellation of S2/n - mean^2 in floating point:
+ * with S1 = q*n + r (0 <= r < n), the sum of squared deviations from
+ * the mean is
+ *
+ *   M2 = S2 - S1^2/n = S2 - q^2*n - 2*q*r - r^2/n
+ *
+ * where every term fits in 64 bits, unlike S1^2, and M2 <= S2.
+ */
+
+#include <stddef.h>
+
+#include "wavestats.h"
+#include "isqrt.h"
+
+#define FRAC_BITS (8U)  // of the mean and RMS values before rounding
+
+
+void wavestats_reset(wavestats_t *ws)
+{
+	ws->count = 0;
+	ws->min = UINT16_MAX;
+	ws->max = 0;
+	ws->sum = 0;
+	ws->sum_sq = 0;
+}
+
+
+void wavestats_add(wavestats_t *ws, const uint16_t *samples, uint32_t n)
+{
+	uint16_t min = ws->min;
+	uint16_t max = ws->max;
+	int64_t sum = ws->sum;
+	uint64_t sum_sq = ws->sum_sq;
+
+	for (uint32_t i = 0; i < n; i++)
+	{
+		uint16_t x = samples[i];
+		int32_t d = (int32_t) x - (int32_t) WAVESTATS_MIDSCALE;
+
+		if (x < min)
+		{
+			min = x;
+		}
+		if (x > max)
+		{
+			max = x;
+		}
+		sum += d;
+		sum_sq += (uint32_t) (d * d);  // at most 2^30
+	}
+
+	ws->count += n;
+	ws->min = min;
+	ws->max = max;
+	ws->sum = sum;
+	ws->sum_sq = sum_sq;
+}
+
+
+void wavestats_merge(wavestats_t *dst, const wavestats_t *src)
+{
+	dst->count += src->count;
+	if (src->min < dst->min)
+	{
+		dst->min = src->min;
+	}
+	if (src->max > dst->max)
+	{
+		dst->max = src->max;
+	}
+	dst->sum += src->sum;
+	dst->sum_sq += src->sum_sq;
+}
+
+
+/*
+ * Rounds a value with FRAC_BITS fractional bits to the nearest integer
+ */
+static uint32_t round_frac(uint64_t x)
+{
+	return (uint32_t) ((x + (1U << (FRAC_BITS - 1))) >> FRAC_BITS);
+}
+
+
+int wavestats_result(const wavestats_t *ws, wavestats_result_t *result)
+{
+	uint64_t n = ws->count;
+	int64_t q, r;
+	uint64_t m2, variance_q, mean_q;
+
+	if (n == 0)
+	{
+		return -1;
+	}
+
+	/* Mean offset from mid-scale, S1 = q*n + r, rounded towards -infinity
+	 * so that 0 <= r < n */
+	q = ws->sum / (int64_t) n;
+	r = ws->sum % (int64_t) n;
+	if (r < 0)
+	{
+		q--;
+		r += (int64_t) n;
+	}
+
+	/* Sum of squared deviations, rounded up by less than 1 */
+	m2 = ws->sum_sq - (uint64_t) (q * q) * n - (uint64_t) (2 * q * r)
+		- ((uint64_t) r * (uint64_t) r) / n;
+
+	/* Variance and mean with 2 * FRAC_BITS and FRAC_BITS fractional bits.
+	 * M2/n is below 2^30 and r/n below 1, so neither overflows. */
+	variance_q = ((m2 / n) << (2 * FRAC_BITS)) + ((m2 % n) << (2 * FRAC_BITS)) / n;
+	mean_q = ((uint64_t) (q + WAVESTATS_MIDSCALE) << FRAC_BITS)
+		+ ((uint64_t) r << FRAC_BITS) / n;
+
+	result->count = ws->count;
+	result->min = ws->min;
+	result->max = ws->max;
+	result->peak_to_peak = ws->max - ws->min;
+	result->mean = (uint16_t) (q + WAVESTATS_MIDSCALE + (2 * (uint64_t) r >= n));
+	result->dc_offset = (int32_t) result->mean - (int32_t) WAVESTATS_MIDSCALE;
+	result->variance = (uint32_t) (m2 / n + (2 * (m2 % n) >= n));
+	/* mean(x^2) = variance + mean^2 */
+	result->rms = (uint16_t) round_frac(isqrt64(variance_q + mean_q * mean_q));
+	result->ac_rms = (uint16_t) round_frac(isqrt64(variance_q));
+	return 0;
+}
@@ -0,0 +1,72 @@
+/*
+ * wavestats.h
+ *
+ * Waveform statistics kept up to date as samples arrive, so that they
+ * are ready as soon as a capture ends, with no second pass over the
+ * buffer. Partial results over separate blocks can be merged.
+ */
+
+#ifndef WAVESTATS_H_
+#define WAVESTATS_H_
+
+#include <stdint.h>
+
+/*
+ * Samples are accumulated relative to mid-scale, so that a squared
+ * sample is below 2^30 and the sums cannot overflow for any count
+ * that fits in 32 bits
+ */
+#define WAVESTATS_MIDSCALE (32768U)
+
+typedef struct {
+	uint32_t count;   // samples accumulated
+	uint16_t min;
+	uint16_t max;
+	int64_t sum;      // of (x - WAVESTATS_MIDSCALE)
+	uint64_t sum_sq;  // of (x - WAVESTATS_MIDSCALE)^2
+} wavestats_t;
+
+typedef struct {
+	uint32_t count;
+	uint16_t min;
+	uint16_t max;
+	uint16_t peak_to_peak;  // max - min
+	uint16_t mean;          // rounded to the nearest count
+	int32_t dc_offset;      // mean - WAVESTATS_MIDSCALE
+	uint32_t variance;      // population variance, in counts^2
+	uint16_t rms;           // sqrt(mean(x^2)), including the DC
+	uint16_t ac_rms;        // sqrt(variance), the DC removed
+} wavestats_result_t;
+
+/*
+ * Clears the accumulator
+ */
+void wavestats_reset(wavestats_t *ws);
+
+/*
+ * Adds a block of samples to the accumulator.
+ *
+ * Parameters:
+ *   ws       Accumulator
+ *   samples  16-bit unsigned samples, as read from the ADC
+ *   n        Number of samples
+ */
+void wavestats_add(wavestats_t *ws, const uint16_t *samples, uint32_t n);
+
+/*
+ * Adds the samples accumulated in src to dst, as if they had all been
+ * added to dst. The total count must fit in 32 bits.
+ */
+void wavestats_merge(wavestats_t *dst, const wavestats_t *src);
+
+/*
+ * Computes the statistics of the samples accumulated so far. The
+ * extremes are exact, the mean and variance are rounded to the nearest
+ * count, and the RMS values are within 1/256 of that.
+ *
+ * Returns:
+ *   0 on success, or -1 if no samples have been accumulated
+ */
+int wavestats_result(const wavestats_t *ws, wavestats_result_t *result);
+
+#endif /* WAVESTATS_H_ */
@@ -17,6 +17,7 @@
 #include <stdio.h>
 #include "cbfifo.h"
 #include "timing.h"
+#include "cpuload.h"
 
 #define UART_OVERSAMPLE_RATE (16U)
 #define USE_TWO_STOP_BITS (1U)  // 0 for one stop bit, 1 for two stop bits
@@ -131,6 +132,7 @@ void UART0_init(uint32_t baud_rate)
 // UART0 IRQ Handler. Listing 8.12 on p. 235
 void UART0_IRQHandler(void)
 {
+    cpuload_cat_t prev = cpuload_enter(CPULOAD_UART0);
     uint32_t pm = __get_PRIMASK();
     __disable_irq();
 
@@ -194,6 +196,7 @@ void UART0_IRQHandler(void)
 
 	/* Re-enable interrupts to their previous state */
     __set_PRIMASK(pm);
+    cpuload_exit(prev);
 }
 
 void send_string(char *str)
@@ -15,6 +15,7 @@
 #include "pidctl.h"
 #include "tpm.h"
 #include "constants.h"
+#include "cpuload.h"
 
 #define CR (13U)  // carriage return ASCII decimal code
 #define SPACE (32U)  // space ASCII decimal code
@@ -58,15 +59,40 @@ static const command_table_t resume_command_struct = {
         "Resume normal operations (bring out of SAFE mode)\r\n"
 };
 
+static const command_table_t load_command_struct = {
+        "LOAD",
+        load_command,
+        "Show CPU load per ISR, blocking wait and idle over the last second,\r\n"
+        "and the busiest 1/16s window since the last reset.\r\nExample:\r\n\t> LOAD\r\n\t> LOAD RESET\r\n"
+};
+
 static const command_table_t commands[] = {
 	echo_command_struct,
 	led_command_struct,
 	mtrset_command_struct,
 	resume_command_struct,
+	load_command_struct,
 };
 
 static const int num_commands = sizeof(commands) / sizeof(command_table_t);
 
+/*
+ * Spins until a character has been received, charging the wait to CPU load idle time
+ */
+static char await_char(void)
+{
+	cpuload_cat_t prev = cpuload_enter(CPULOAD_IDLE);
+	char c;
+
+	do
+	{
+		c = getchar();
+	} while (c == (char) ERROR);  // ERROR means no input in the receive buffer
+
+	cpuload_exit(prev);
+	return c;
+}
+
 int await_command(char *cmd)
 {
 	char *cmd_start = cmd;
@@ -76,13 +102,7 @@ int await_command(char *cmd)
 	/* Await either a command overflow or a carriage return */
 	while (1)
 	{
-		c = getchar();
-
-		/* If getchar returned ERROR, there was no input in the receive buffer */
-		if (c == (char) ERROR)
-		{
-			continue;  // Keep waiting
-		}
+		c = await_char();
 
 		if (c == BS)
 		{
@@ -296,6 +316,27 @@ uint32_t resume_command(int argc, char*argv[])
     return SUCCESS;
 }
 
+uint32_t load_command(int argc, char*argv[])
+{
+    if (argc > 1 && strcasecmp(argv[1], "HELP") == 0)
+    {
+        printf("%s", load_command_struct.help_string);
+        return SUCCESS;
+    }
+    if (argc > 1 && strcasecmp(argv[1], "RESET") == 0)
+    {
+        cpuload_reset();
+        printf("OK\r\n");
+        return SUCCESS;
+    }
+    if (argc > 1)
+    {
+        return ERROR;
+    }
+    cpuload_report();
+    return SUCCESS;
+}
+
 void print_command(int argc, char *argv[])
 {
 	printf("Parsed command: (argc=%u, argv=[", argc);
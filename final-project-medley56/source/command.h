@@ -73,6 +73,11 @@ uint32_t mtrset_command(int argc, char*argv[]);
  */
 uint32_t resume_command(int argc, char*argv[]);
 
+/*
+ * @brief Reports CPU load (LOAD) or clears its history (LOAD RESET)
+ */
+uint32_t load_command(int argc, char*argv[]);
+
 
 /**
  * @brief Print command tokens, including the arg count.
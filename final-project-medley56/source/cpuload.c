@@ -0,0 +1,200 @@
+/**
+ * @file cpuload.c
+ * @brief CPU load accounting across ISRs, blocking waits and idle
+ *
+ * @date 2026-10-18
+ * @author Gavin Medley
+ * @see cpuload.h
+ */
+
+#include "cpuload.h"
+
+#include <stdio.h>
+#include "MKL25Z4.h"
+#include "timing.h"
+
+#define CYCLES_PER_WINDOW (CLK_FREQ / SEC_FRAC)
+
+static const char *const category_names[CPULOAD_NUM_CATEGORIES] = {
+	"main", "idle", "TPM1", "PORTD", "UART0", "wait i2c", "wait adc", "wait delay"
+};
+
+static cpuload_cat_t current = CPULOAD_MAIN;  // Category being charged
+static uint32_t last;  // Cycle clock at the last charge
+
+static uint32_t window[CPULOAD_NUM_CATEGORIES];  // Cycles in the open window
+static uint32_t history[CPULOAD_WINDOWS][CPULOAD_NUM_CATEGORIES];  // Closed windows
+static uint32_t rolling[CPULOAD_NUM_CATEGORIES];  // Sum of history
+static uint32_t rolling_total;
+static uint32_t entries[CPULOAD_NUM_CATEGORIES];  // cpuload_enter() calls
+static uint32_t windows_closed;
+
+static uint32_t worst[CPULOAD_NUM_CATEGORIES];  // Busiest closed window
+static uint32_t worst_busy;
+static uint32_t worst_total;
+static ticktime_t worst_time;
+
+/* Charges the cycles since the last charge to the current category. Interrupts must be masked */
+static void charge()
+{
+	uint32_t t = now_cycles32();
+
+	window[current] += t - last;
+	last = t;
+}
+
+void cpuload_init()
+{
+	uint32_t pm = __get_PRIMASK();
+	__disable_irq();
+
+	current = CPULOAD_MAIN;
+	last = now_cycles32();
+	for (int i = 0; i < CPULOAD_NUM_CATEGORIES; i++)
+	{
+		window[i] = 0;
+	}
+	cpuload_reset();
+
+	__set_PRIMASK(pm);
+}
+
+cpuload_cat_t cpuload_enter(cpuload_cat_t cat)
+{
+	uint32_t pm = __get_PRIMASK();
+	__disable_irq();
+
+	cpuload_cat_t prev = current;
+	charge();
+	current = cat;
+	entries[cat]++;
+
+	__set_PRIMASK(pm);
+	return prev;
+}
+
+void cpuload_exit(cpuload_cat_t prev)
+{
+	uint32_t pm = __get_PRIMASK();
+	__disable_irq();
+
+	charge();
+	current = prev;
+
+	__set_PRIMASK(pm);
+}
+
+void cpuload_tick()
+{
+	uint32_t *oldest = history[windows_closed % CPULOAD_WINDOWS];
+	uint32_t busy = 0;
+	uint32_t total = 0;
+
+	/* SysTick has the highest priority, so nothing else runs meanwhile */
+	charge();
+
+	for (int i = 0; i < CPULOAD_NUM_CATEGORIES; i++)
+	{
+		rolling[i] += window[i] - oldest[i];
+		rolling_total += window[i] - oldest[i];
+		oldest[i] = window[i];
+		total += window[i];
+		if (i != CPULOAD_IDLE)
+		{
+			busy += window[i];
+		}
+	}
+	if (busy > worst_busy)
+	{
+		for (int i = 0; i < CPULOAD_NUM_CATEGORIES; i++)
+		{
+			worst[i] = window[i];
+		}
+		worst_busy = busy;
+		worst_total = total;
+		worst_time = now();
+	}
+
+	for (int i = 0; i < CPULOAD_NUM_CATEGORIES; i++)
+	{
+		window[i] = 0;
+	}
+	windows_closed++;
+}
+
+void cpuload_reset()
+{
+	uint32_t pm = __get_PRIMASK();
+	__disable_irq();
+
+	for (int i = 0; i < CPULOAD_NUM_CATEGORIES; i++)
+	{
+		for (int w = 0; w < CPULOAD_WINDOWS; w++)
+		{
+			history[w][i] = 0;
+		}
+		rolling[i] = 0;
+		entries[i] = 0;
+		worst[i] = 0;
+	}
+	rolling_total = 0;
+	windows_closed = 0;
+	worst_busy = 0;
+	worst_total = 0;
+	worst_time = 0;
+
+	__set_PRIMASK(pm);
+}
+
+/* Prints part/whole as a percentage with one decimal */
+static void print_percent(uint32_t part, uint32_t whole)
+{
+	uint32_t tenths = whole ? (uint32_t) ((uint64_t) part * 1000U / whole) : 0;
+
+	printf("%3u.%u%%", (unsigned) (tenths / 10), (unsigned) (tenths % 10));
+}
+
+void cpuload_report()
+{
+	uint32_t r[CPULOAD_NUM_CATEGORIES], w[CPULOAD_NUM_CATEGORIES], e[CPULOAD_NUM_CATEGORIES];
+	uint32_t r_total, w_busy, w_total, n;
+	ticktime_t w_time;
+
+	/* Copy first, so the figures are from one moment and printing is not counted against them */
+	uint32_t pm = __get_PRIMASK();
+	__disable_irq();
+	for (int i = 0; i < CPULOAD_NUM_CATEGORIES; i++)
+	{
+		r[i] = rolling[i];
+		w[i] = worst[i];
+		e[i] = entries[i];
+	}
+	r_total = rolling_total;
+	w_busy = worst_busy;
+	w_total = worst_total;
+	w_time = worst_time;
+	n = windows_closed;
+	__set_PRIMASK(pm);
+
+	if (n > CPULOAD_WINDOWS)
+	{
+		n = CPULOAD_WINDOWS;
+	}
+	printf("CPU load over the last %u ms (%u windows of %u cycles)\r\n",
+			(unsigned) (n * 1000U / SEC_FRAC), (unsigned) n, (unsigned) CYCLES_PER_WINDOW);
+	printf("%-11s %7s %7s %10s\r\n", "category", "load", "worst", "entries");
+	for (int i = 0; i < CPULOAD_NUM_CATEGORIES; i++)
+	{
+		printf("%-11s ", category_names[i]);
+		print_percent(r[i], r_total);
+		printf(" ");
+		print_percent(w[i], w_total);
+		printf(" %10u\r\n", (unsigned) e[i]);
+	}
+	printf("%-11s ", "busy");
+	print_percent(r_total - r[CPULOAD_IDLE], r_total);
+	printf(" ");
+	print_percent(w_busy, w_total);
+	printf("\r\nWorst window ended at %u.%02u s\r\n", (unsigned) (w_time / SEC_FRAC),
+			(unsigned) (w_time % SEC_FRAC * 100U / SEC_FRAC));
+}
@@ -0,0 +1,76 @@
+/**
+ * @file cpuload.h
+ * @brief CPU load accounting across ISRs, blocking waits and idle
+ *
+ * Every cycle is charged to exactly one category: the one most recently
+ * entered and not yet exited. ISRs and blocking waits bracket themselves
+ * with cpuload_enter()/cpuload_exit(); nesting (PORTD preempting TPM1,
+ * pt_read() waiting inside TPM1) unwinds through the saved categories.
+ * SysTick closes a window every tick and keeps the last CPULOAD_WINDOWS
+ * of them for the rolling figures, plus the busiest window seen.
+ *
+ * Each transition is two clock reads and a few adds with interrupts
+ * masked, so it stays on in production builds.
+ *
+ * @date 2026-10-18
+ * @author Gavin Medley
+ */
+
+#ifndef CPULOAD_H_
+#define CPULOAD_H_
+
+#include <stdint.h>
+
+#define CPULOAD_WINDOWS 16U  // Rolling history; 16 ticks of 1/16s = 1s
+
+/* Where the cycles go. Everything but CPULOAD_IDLE counts as busy */
+typedef enum {
+	CPULOAD_MAIN,        // Thread mode: command processing, printf
+	CPULOAD_IDLE,        // Waiting for a command character
+	CPULOAD_TPM1,        // PID and PT state machine ISR
+	CPULOAD_PORTD,       // Encoder edge ISR
+	CPULOAD_UART0,       // UART byte ISR
+	CPULOAD_WAIT_I2C,    // Spinning in i2c_wait()
+	CPULOAD_WAIT_ADC,    // Spinning in pt_read()
+	CPULOAD_WAIT_DELAY,  // Spinning in delay()
+	CPULOAD_NUM_CATEGORIES
+} cpuload_cat_t;
+
+/**
+ * @brief Start accounting, charging to CPULOAD_MAIN from now on.
+ *
+ * Call after systick_init().
+ */
+void cpuload_init();
+
+/**
+ * @brief Charge cycles from now on to a category.
+ *
+ * @param cat The category being entered.
+ * @return The category that was current, to pass to cpuload_exit().
+ */
+cpuload_cat_t cpuload_enter(cpuload_cat_t cat);
+
+/**
+ * @brief Charge cycles from now on to the category current before the matching cpuload_enter().
+ *
+ * @param prev The value returned by cpuload_enter().
+ */
+void cpuload_exit(cpuload_cat_t prev);
+
+/**
+ * @brief Close the current window. Called from SysTick_Handler.
+ */
+void cpuload_tick();
+
+/**
+ * @brief Forget the rolling history, the worst window and the entry counts.
+ */
+void cpuload_reset();
+
+/**
+ * @brief Print rolling utilization per category and the worst busy window.
+ */
+void cpuload_report();
+
+#endif /* CPULOAD_H_ */
@@ -8,6 +8,7 @@
 #include "encoder.h"
 
 #include "MKL25Z4.h"
+#include "cpuload.h"
 
 
 #define ENCODER_PORT PORTD  // Only PORTA and PORTD support interrupt generation
@@ -85,6 +86,7 @@ void PORTD_IRQHandler(void)
     /* Following code sourced from:
      * https://hifiduino.wordpress.com/2010/10/20/rotaryencoder-hw-sw-no-debounce/
      */
+    cpuload_cat_t prev = cpuload_enter(CPULOAD_PORTD);
     int8_t enc_states[] = {0,-1,1,0,1,0,0,-1,-1,0,0,1,0,1,-1,0};
     static uint8_t old_AB = 0;
     /**/
@@ -99,5 +101,6 @@ void PORTD_IRQHandler(void)
     //LOG("change = %i", enc_states[(old_AB & 0x0F)]);
     encoder_value += ( enc_states[( old_AB & 0x0F )]);
 
+    cpuload_exit(prev);
     return;
 }
@@ -0,0 +1,83 @@
+/**
+ * @file monotonic.c
+ * @brief 64-bit monotonic cycle clock from a periodic down-counter
+ * @author Gavin Medley
+ */
+
+#include "monotonic.h"
+
+void monotonic_init(monotonic_clock_t *clock, uint32_t period, uint32_t hz,
+		monotonic_read_counter_t readCounter,
+		monotonic_wrap_pending_t wrapPending) {
+	clock->overflows = 0;
+	clock->period = period;
+	clock->hz = hz;
+	clock->readCounter = readCounter;
+	clock->wrapPending = wrapPending;
+}
+
+/*
+ * Takes a consistent reading: returns the counts since the last reload
+ * and sets *overflows to the reloads so far, pending one included
+ */
+static uint32_t read_clock(const monotonic_clock_t *clock, uint64_t *overflows) {
+	uint64_t o;
+	uint32_t counter;
+	uint32_t pending;
+
+	// overflows, counter and pending must describe one instant. If the
+	// tick interrupt runs in between, overflows changes: start again.
+	do {
+		o = clock->overflows;
+		counter = clock->readCounter();
+		// The counter may have reloaded with the interrupt still pending
+		// (about to run, or masked). Count that reload, and read the
+		// counter again so that it is certainly the post-reload value.
+		pending = clock->wrapPending() ? 1 : 0;
+		if (pending) {
+			counter = clock->readCounter();
+		}
+	} while (clock->overflows != o);
+
+	*overflows = o + pending;
+	return clock->period - 1 - counter;
+}
+
+uint64_t monotonic_now(const monotonic_clock_t *clock) {
+	uint64_t overflows;
+	uint32_t elapsed = read_clock(clock, &overflows);
+
+	return overflows * clock->period + elapsed;
+}
+
+uint32_t monotonic_now32(const monotonic_clock_t *clock) {
+	uint64_t overflows;
+	uint32_t elapsed = read_clock(clock, &overflows);
+
+	// Same low 32 bits as monotonic_now, without a 64-bit multiply
+	return (uint32_t) overflows * clock->period + elapsed;
+}
+
+/*
+ * Returns cycles * scale / hz, splitting cycles so that nothing
+ * overflows for scale up to 10^9
+ */
+static uint64_t scale_cycles(uint64_t cycles, uint32_t scale, uint32_t hz) {
+	return (cycles / hz) * scale + (cycles % hz) * scale / hz;
+}
+
+uint64_t monotonic_to_ns(const monotonic_clock_t *clock, uint64_t cycles) {
+	return scale_cycles(cycles, 1000000000u, clock->hz);
+}
+
+uint64_t monotonic_to_us(const monotonic_clock_t *clock, uint64_t cycles) {
+	return scale_cycles(cycles, 1000000u, clock->hz);
+}
+
+uint64_t monotonic_to_ms(const monotonic_clock_t *clock, uint64_t cycles) {
+	return scale_cycles(cycles, 1000u, clock->hz);
+}
+
+uint64_t monotonic_from_us(const monotonic_clock_t *clock, uint64_t us) {
+	return (us / 1000000u) * clock->hz + (us % 1000000u) * clock->hz / 1000000u;
+}
@@ -10,6 +10,7 @@
 
 #include <stdio.h>
 #include "MKL25Z4.h"
+#include "cpuload.h"
 
 #define PT_PIN (1U)
 #define PT_CHANNEL (0U)  // PTE0, ADC0_DP0/ADC0_SE0
@@ -37,10 +38,12 @@ uint16_t pt_read()
 
     ADC0->SC1[0] = PT_CHANNEL | ADC_SC1_DIFF_MASK; // Writing to SC1A triggers a conversion
 
+    cpuload_cat_t prev = cpuload_enter(CPULOAD_WAIT_ADC);
     while (!(ADC0->SC1[0] & ADC_SC1_COCO_MASK))
     {
         // wait
     }
+    cpuload_exit(prev);
 
     result = ADC0->R[0];
     return result;
@@ -9,6 +9,7 @@
 
 #include <assert.h>
 #include "MKL25Z4.h"
+#include "cpuload.h"
 
 /* I2C1 Configuration settings */
 #define I2C I2C1
@@ -103,11 +104,13 @@ void scmd_ma_set_drive(uint8_t drive)
 
 void i2c_wait (void)
 {
+    cpuload_cat_t prev = cpuload_enter(CPULOAD_WAIT_I2C);
     while ((I2C1->S & I2C_S_IICIF_MASK) == 0)
     {
         // Wait for interrupt flag to be set
     }
     I2C1->S |= I2C_S_IICIF_MASK;  // Write to flag to clear it
+    cpuload_exit(prev);
 }
 
 
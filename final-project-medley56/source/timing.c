@@ -10,10 +10,14 @@
 #include "MKL25Z4.h"
 #include "core_cm0plus.h"
 #include "timing.h"
+#include "monotonic.h"
+#include "cpuload.h"
 
-#define EXT_CLK_PRESCALE 16U  // Prescale value for external clock (from ARMv6-M manual)
-#define RELOAD_VALUE ((CLK_FREQ / EXT_CLK_PRESCALE / SEC_FRAC) - 1)  // Reload value (1 tick worth of cycles)
-#define SYSTICK_IRQ_PRIORITY 3U  // SysTick IRQ priority
+#define CYCLES_PER_TICK (CLK_FREQ / SEC_FRAC)  // 1.5M, fits the 24-bit counter
+#define RELOAD_VALUE (CYCLES_PER_TICK - 1)  // Reload value (1 tick worth of cycles)
+#define SYSTICK_IRQ_PRIORITY 0U  // SysTick IRQ priority. Highest, so that no ISR reading
+                                 // now_cycles() runs between its exception entry (which clears
+                                 // the pending flag) and the tick being counted
 /*
  * Note: with SEC_FRAC (in timing.h) set to 16 (1tick = 1/16s)
  * storing ticks in a uint32_t the MCU can count for
@@ -22,6 +26,17 @@
 
 static ticktime_t start_time;
 static ticktime_t ticks_since_startup;  // Count of ticks since system startup
+static monotonic_clock_t cycle_clock;  // Core cycles since startup, from ticks and SysTick->VAL
+
+static uint32_t systick_counter()
+{
+	return SysTick->VAL;
+}
+
+static bool systick_pending()
+{
+	return (SCB->ICSR & SCB_ICSR_PENDSTSET_Msk) != 0;
+}
 
 void SysTick_Handler()
 {
@@ -31,6 +46,10 @@ void SysTick_Handler()
 
 	/* Increment internal time counter */
 	ticks_since_startup++;
+	monotonic_tick(&cycle_clock);
+
+	/* Close the CPU load window */
+	cpuload_tick();
 
 	/* Re-enable interrupts to their previous state */
 	__set_PRIMASK(pm);
@@ -38,15 +57,19 @@ void SysTick_Handler()
 
 void systick_init()
 {
-	/* Set the reload value to the max value that the 24bit current value register
-	 * (CVR) can hold (results in 1Hz interrupts) */
+	/* Set the reload value to one tick worth of core clock cycles (results in
+	 * SEC_FRAC interrupts per second) */
 	SysTick->LOAD = RELOAD_VALUE;
 	SysTick->VAL = 0;  // Force the counter to set its reload value
+	monotonic_init(&cycle_clock, CYCLES_PER_TICK, CLK_FREQ, systick_counter,
+			systick_pending);
 
-	/* CLKSOURCE = 0 (default) uses external clock (core clock prescaled by 16), 1 uses core clock
+	/* CLKSOURCE = 0 (default) uses external clock (core clock prescaled by 16), 1 uses core clock.
+	 * The core clock makes SysTick->VAL count cycles, for now_cycles().
 	 * ENABLE = 1 enables the counter
 	 * TICKINT = 1 turns on counter interrupt routine */
-	SysTick->CTRL = SysTick_CTRL_TICKINT_Msk | // Enable systick interrupt to count global time since startup
+	SysTick->CTRL = SysTick_CTRL_CLKSOURCE_Msk |  // Count core clock cycles
+			SysTick_CTRL_TICKINT_Msk | // Enable systick interrupt to count global time since startup
 			SysTick_CTRL_ENABLE_Msk;  // Enable the systick counter
 
 	NVIC_SetPriority(SysTick_IRQn, SYSTICK_IRQ_PRIORITY);
@@ -59,6 +82,21 @@ ticktime_t now()
 	return ticks_since_startup;
 }
 
+uint64_t now_cycles()
+{
+	return monotonic_now(&cycle_clock);
+}
+
+uint32_t now_cycles32()
+{
+	return monotonic_now32(&cycle_clock);
+}
+
+uint64_t cycles_to_us(uint64_t cycles)
+{
+	return monotonic_to_us(&cycle_clock, cycles);
+}
+
 void reset_global_timer() // Resets timer to 0; doesn't affect now() values
 {
 	start_time = now();
@@ -71,6 +109,7 @@ ticktime_t get_global_timer() // Returns ticks since the last call to reset_time
 
 void delay(uint32_t ticks)
 {
+	cpuload_cat_t prev = cpuload_enter(CPULOAD_WAIT_DELAY);
 	uint32_t end = now() + ticks;
 	while (now() < end)
 	{
@@ -82,5 +121,6 @@ void delay(uint32_t ticks)
 		 */
 		__asm volatile("NOP");
 	}
+	cpuload_exit(prev);
 }
 
@@ -28,6 +28,27 @@ void systick_init();
  */
 ticktime_t now(); // in sixteenths of a second
 
+/**
+ * @brief Return core clock cycles since startup.
+ *
+ * Combines the tick count with the live SysTick counter, so the resolution is
+ * one cycle even though SysTick only interrupts SEC_FRAC times per second.
+ * Safe to call from interrupts.
+ */
+uint64_t now_cycles();
+
+/**
+ * @brief Return the low 32 bits of now_cycles(), more cheaply.
+ *
+ * Wraps every 179s at 24MHz; differences of two readings are valid across the wrap.
+ */
+uint32_t now_cycles32();
+
+/**
+ * @brief Convert a number of core clock cycles to microseconds, rounding down.
+ */
+uint64_t cycles_to_us(uint64_t cycles);
+
 /**
  * @brief Reset the timer to zero. Does not affect now() values.
  */
@@ -12,6 +12,7 @@
 #include "pidctl.h"
 #include "pt.h"
 #include "led.h"
+#include "cpuload.h"
 
 #define PT_THRESHOLD (6000U)  // Threshold for "light detected"
 #define TPM_OVERFLOW_MOD (375U)  // 48MHz / 128 = 375kHz. If we count 375 then we should be counting milliseconds
@@ -87,6 +88,8 @@ void TPM1_IRQHandler(void) {
     static uint32_t pt_monitor_counter;  // Only check PT every so often
     static uint16_t pt_value;
 
+    cpuload_cat_t prev = cpuload_enter(CPULOAD_TPM1);
+
     NVIC_ClearPendingIRQ(TPM1_IRQn);
     TPM1->SC |= TPM_SC_TOF_MASK;
 
@@ -125,4 +128,5 @@ void TPM1_IRQHandler(void) {
     motor_ctrl_counter++;
     pt_monitor_counter++;
 
+    cpuload_exit(prev);
 }
@@ -0,0 +1,542 @@
+/*
+ * footprint.c
+ *
+ * Per-module flash/RAM sizes and worst-case stack depths of a firmware
+ * image, checked against budgets.
+ *
+ * Sizes come from the linker map: every input section is charged to
+ * the object it came from (archive members as library:member, or the
+ * whole library with -a), to flash if it runs from or is loaded from
+ * flash, and to RAM if it lives there at run time. With -n, nm -S
+ * output of the image lists the largest symbols of each module (-v).
+ *
+ * Stack depths come from the -fstack-usage frames (.su files) and the
+ * calls in objdump -d output of the image. The roots are main, every
+ * *Handler, and any -r functions; handlers are charged the exception
+ * frame on top. The total assumes every handler nests on top of main,
+ * which is the worst case when priorities are not known.
+ *
+ * The budget file has one limit per line, in bytes (or with a K suffix):
+ *
+ *   flash isha 4096        flash/ram of a module, or of "total"
+ *   ram total 12K
+ *   stack SysTick_Handler 256    stack of a root, or "total"
+ *   call SysTick_Handler ticktime_isr
+ *
+ * "call" adds an edge the disassembly cannot show: a function pointer,
+ * or a jump through a register. The exit status is 1 if any budget is
+ * exceeded.
+ *
+ * Usage: footprint [-a] [-v] [-m map] [-n nm-output] [-d objdump-output]
+ *                  [-b budgets] [-r root]... [su-file...]
+ */
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "mapfile.h"
+#include "stackdepth.h"
+
+#define TOP_SYMBOLS  3   // largest symbols listed per module with -v
+#define MAX_ROOTS    64
+
+typedef struct {
+	char name[128];
+	uint32_t size;
+} symbol_t;
+
+typedef struct {
+	char name[128];
+	uint32_t flash;
+	uint32_t ram;
+	symbol_t top[TOP_SYMBOLS];
+} module_t;
+
+static module_t *modules;
+static size_t num_modules;
+static uint32_t total_flash, total_ram;
+
+static size_t roots[MAX_ROOTS];
+static uint32_t root_depth[MAX_ROOTS];
+static size_t num_roots;
+static uint32_t total_stack;
+static bool total_recursive, total_incomplete;
+
+static bool group_archives;
+static uint32_t checked, exceeded;
+
+/*
+ * Names the module of an input file: "./source/isha.o" is isha, and
+ * ".../libc.a(lib_a-memcpy.o)" is libc:memcpy, or libc with -a
+ */
+static void module_name(const char *file, char *out, size_t n) {
+	const char *open = strchr(file, '(');
+	const char *base;
+	char archive[64] = "";
+	char member[63];
+	char *dot;
+
+	if (file[0] == '\0') {
+		snprintf(out, n, "(fill)");
+		return;
+	}
+	if (open != NULL) {
+		const char *a = open;
+
+		while (a > file && a[-1] != '/') {
+			a--;
+		}
+		snprintf(archive, sizeof(archive), "%.*s", (int) (open - a), a);
+		dot = strstr(archive, ".a");
+		if (dot != NULL) {
+			*dot = '\0';
+		}
+		base = open + 1;
+		if (strncmp(base, "lib_a-", 6) == 0) {
+			base += 6;  // newlib's member prefix
+		}
+	} else {
+		base = strrchr(file, '/');
+		base = (base == NULL) ? file : base + 1;
+	}
+	snprintf(member, sizeof(member), "%s", base);
+	member[strcspn(member, ")")] = '\0';
+	dot = strrchr(member, '.');
+	if (dot != NULL && (strcmp(dot, ".o") == 0 || strcmp(dot, ".obj") == 0)) {
+		*dot = '\0';
+	}
+
+	if (archive[0] == '\0') {
+		snprintf(out, n, "%s", member);
+	} else if (group_archives) {
+		snprintf(out, n, "%s", archive);
+	} else {
+		snprintf(out, n, "%s:%s", archive, member);
+	}
+}
+
+static module_t *find_module(const char *name) {
+	module_t *m;
+
+	for (size_t i = 0; i < num_modules; i++) {
+		if (strcmp(modules[i].name, name) == 0) {
+			return &modules[i];
+		}
+	}
+	m = realloc(modules, (num_modules + 1) * sizeof(*m));
+	if (m == NULL) {
+		fprintf(stderr, "footprint: out of memory\n");
+		exit(1);
+	}
+	modules = m;
+	m = &modules[num_modules++];
+	*m = (module_t) { 0 };
+	snprintf(m->name, sizeof(m->name), "%s", name);
+	return m;
+}
+
+static void add_sizes(const map_t *map) {
+	for (size_t i = 0; i < map->num_sections; i++) {
+		const map_section_t *s = &map->sections[i];
+		char name[128];
+		module_t *m;
+
+		module_name(s->file, name, sizeof(name));
+		m = find_module(name);
+		if (s->flash) {
+			m->flash += s->size;
+			total_flash += s->size;
+		}
+		if (s->ram) {
+			m->ram += s->size;
+			total_ram += s->size;
+		}
+	}
+}
+
+// Keeps the TOP_SYMBOLS largest symbols of each module
+static void add_symbols(FILE *nm, const map_t *map) {
+	char line[512];
+
+	while (fgets(line, sizeof(line), nm) != NULL) {
+		char addr_text[16], size_text[16], type[4], name[128], module[128];
+		uint32_t addr, size;
+		const map_section_t *s;
+		module_t *m;
+
+		// Only symbols with a size: "00000c0d 00000040 T ISHAReset"
+		if (sscanf(line, "%15s %15s %3s %127s", addr_text, size_text, type,
+				name) != 4 || strlen(type) != 1) {
+			continue;
+		}
+		addr = strtoul(addr_text, NULL, 16);
+		size = strtoul(size_text, NULL, 16);
+		s = map_find(map, addr & ~1u);
+		if (s == NULL) {
+			continue;
+		}
+		module_name(s->file, module, sizeof(module));
+		m = find_module(module);
+		for (int k = 0; k < TOP_SYMBOLS; k++) {
+			if (size > m->top[k].size) {
+				memmove(&m->top[k + 1], &m->top[k],
+						(TOP_SYMBOLS - 1 - k) * sizeof(m->top[0]));
+				snprintf(m->top[k].name, sizeof(m->top[k].name), "%s", name);
+				m->top[k].size = size;
+				break;
+			}
+		}
+	}
+}
+
+// Most flash first, then by name
+static int compare_module(const void *a, const void *b) {
+	const module_t *x = a;
+	const module_t *y = b;
+
+	if (x->flash != y->flash) {
+		return (x->flash > y->flash) ? -1 : 1;
+	}
+	if (x->ram != y->ram) {
+		return (x->ram > y->ram) ? -1 : 1;
+	}
+	return strcmp(x->name, y->name);
+}
+
+static void print_sizes(bool verbose) {
+	qsort(modules, num_modules, sizeof(*modules), compare_module);
+	printf("     flash       ram  module\n");
+	for (size_t i = 0; i < num_modules; i++) {
+		const module_t *m = &modules[i];
+
+		printf("%10u %9u  %s\n", (unsigned) m->flash, (unsigned) m->ram, m->name);
+		for (int k = 0; verbose && k < TOP_SYMBOLS && m->top[k].size; k++) {
+			printf("%10u            %s\n", (unsigned) m->top[k].size,
+					m->top[k].name);
+		}
+	}
+	printf("%10u %9u  total\n", (unsigned) total_flash, (unsigned) total_ram);
+}
+
+static bool is_handler(const char *name) {
+	size_t n = strlen(name);
+
+	return n > 7 && strcmp(name + n - 7, "Handler") == 0;
+}
+
+static void add_root(size_t i) {
+	for (size_t k = 0; k < num_roots; k++) {
+		if (roots[k] == i) {
+			return;
+		}
+	}
+	if (num_roots < MAX_ROOTS) {
+		roots[num_roots++] = i;
+	}
+}
+
+static void print_stack(stack_graph_t *g, bool after_sizes) {
+	bool any;
+
+	printf("%s     stack  root: deepest path\n", after_sizes ? "\n" : "");
+	total_stack = 0;
+	for (size_t k = 0; k < num_roots; k++) {
+		size_t i = roots[k];
+		const stack_func_t *f = &g->funcs[i];
+		uint32_t d = stack_depth(g, i);
+
+		if (is_handler(f->name)) {
+			d += EXCEPTION_FRAME_BYTES;
+		}
+		root_depth[k] = d;
+		total_stack += d;
+		total_recursive |= f->recursive;
+		total_incomplete |= f->incomplete;
+		printf("%10u%s %s:", (unsigned) d, f->incomplete ? "+" : " ", f->name);
+		// A cycle ends the path where it comes back round
+		for (size_t j = i, n = 0; j != SIZE_MAX && n < g->num_funcs;
+				j = g->funcs[j].next, n++) {
+			printf(" %s%s", (j == i) ? "" : "> ", g->funcs[j].name);
+		}
+		printf("%s\n", f->recursive ? " (recursive)" : "");
+	}
+	printf("%10u%s total: main and every handler nested\n",
+			(unsigned) total_stack, total_incomplete ? "+" : " ");
+
+	// Why a depth is only a lower bound (+)
+	any = false;
+	for (size_t i = 0; i < g->num_funcs; i++) {
+		const stack_func_t *f = &g->funcs[i];
+
+		if (f->state != 0 && (!f->known || f->dynamic)) {
+			printf("%s%s%s", any ? ", " : "\nframe unknown or dynamic: ", f->name,
+					f->dynamic ? " (dynamic)" : "");
+			any = true;
+		}
+	}
+	if (any) {
+		printf("\n");
+	}
+	any = false;
+	for (size_t i = 0; i < g->num_funcs; i++) {
+		const stack_func_t *f = &g->funcs[i];
+
+		if (f->state != 0 && f->indirect) {
+			printf("%s%s", any ? ", " : "indirect calls not followed: ", f->name);
+			any = true;
+		}
+	}
+	if (any) {
+		printf("\n");
+	}
+}
+
+static bool parse_bytes(const char *s, uint32_t *bytes) {
+	char *end;
+	unsigned long v = strtoul(s, &end, 0);
+
+	if (end == s) {
+		return false;
+	}
+	if (*end == 'K' || *end == 'k') {
+		v *= 1024;
+		end++;
+	}
+	*bytes = (uint32_t) v;
+	return *end == '\0';
+}
+
+static void check(const char *kind, const char *name, uint32_t value,
+		uint32_t limit, bool unbounded) {
+	checked++;
+	if (unbounded || value > limit) {
+		exceeded++;
+		if (unbounded) {
+			printf("budget exceeded: %s %s is unbounded (recursive), limit %u\n",
+					kind, name, (unsigned) limit);
+		} else {
+			printf("budget exceeded: %s %s %u > %u\n", kind, name,
+					(unsigned) value, (unsigned) limit);
+		}
+	}
+}
+
+// Reads the call lines of the budget file, before depths are computed
+static int read_calls(FILE *f, stack_graph_t *g) {
+	char line[512];
+
+	while (fgets(line, sizeof(line), f) != NULL) {
+		char kind[16], a[128], b[128];
+		size_t caller, callee;
+
+		if (sscanf(line, "%15s %127s %127s", kind, a, b) != 3
+				|| strcmp(kind, "call") != 0) {
+			continue;
+		}
+		caller = stack_find(g, a);
+		callee = stack_find(g, b);
+		if (caller == SIZE_MAX || callee == SIZE_MAX) {
+			fprintf(stderr, "footprint: call %s %s: no such function\n", a, b);
+			continue;
+		}
+		if (stack_add_call(g, caller, callee) != 0) {
+			return -1;
+		}
+	}
+	rewind(f);
+	return 0;
+}
+
+static void check_budgets(FILE *f, const stack_graph_t *g, bool sizes,
+		bool stack) {
+	char line[512];
+
+	while (fgets(line, sizeof(line), f) != NULL) {
+		char kind[16], name[128], limit_text[32];
+		uint32_t limit;
+		bool found = false;
+
+		if (line[0] == '#'
+				|| sscanf(line, "%15s %127s %31s", kind, name, limit_text) != 3
+				|| strcmp(kind, "call") == 0) {
+			continue;
+		}
+		if (!parse_bytes(limit_text, &limit)) {
+			fprintf(stderr, "footprint: bad budget: %s", line);
+			exceeded++;
+			continue;
+		}
+		if (sizes && (strcmp(kind, "flash") == 0 || strcmp(kind, "ram") == 0)) {
+			bool flash = kind[0] == 'f';
+
+			if (strcmp(name, "total") == 0) {
+				check(kind, name, flash ? total_flash : total_ram, limit, false);
+				continue;
+			}
+			for (size_t i = 0; i < num_modules; i++) {
+				if (strcmp(modules[i].name, name) == 0) {
+					check(kind, name, flash ? modules[i].flash : modules[i].ram,
+							limit, false);
+					found = true;
+				}
+			}
+		} else if (stack && strcmp(kind, "stack") == 0) {
+			if (strcmp(name, "total") == 0) {
+				check(kind, name, total_stack, limit, total_recursive);
+				continue;
+			}
+			for (size_t k = 0; k < num_roots; k++) {
+				if (strcmp(g->funcs[roots[k]].name, name) == 0) {
+					check(kind, name, root_depth[k], limit,
+							g->funcs[roots[k]].recursive);
+					found = true;
+				}
+			}
+		} else {
+			continue;  // nothing to check it against in this run
+		}
+		if (!found) {
+			fprintf(stderr, "footprint: budget for unknown %s %s\n", kind, name);
+		}
+	}
+}
+
+static FILE *open_or_die(const char *path) {
+	FILE *f = fopen(path, "r");
+
+	if (f == NULL) {
+		perror(path);
+		exit(1);
+	}
+	return f;
+}
+
+static void usage(const char *prog) {
+	fprintf(stderr, "usage: %s [-a] [-v] [-m map] [-n nm-output] "
+			"[-d objdump-output] [-b budgets] [-r root]... [su-file...]\n", prog);
+}
+
+int main(int argc, char *argv[]) {
+	const char *map_path = NULL, *nm_path = NULL, *objdump_path = NULL;
+	const char *budget_path = NULL;
+	const char *extra_roots[MAX_ROOTS];
+	size_t num_extra = 0;
+	bool verbose = false;
+	map_t map = { 0 };
+	stack_graph_t g = { 0 };
+	FILE *budgets = NULL;
+	int opt;
+
+	while ((opt = getopt(argc, argv, "avm:n:d:b:r:")) != -1) {
+		switch (opt) {
+		case 'a':
+			group_archives = true;
+			break;
+		case 'v':
+			verbose = true;
+			break;
+		case 'm':
+			map_path = optarg;
+			break;
+		case 'n':
+			nm_path = optarg;
+			break;
+		case 'd':
+			objdump_path = optarg;
+			break;
+		case 'b':
+			budget_path = optarg;
+			break;
+		case 'r':
+			if (num_extra < MAX_ROOTS) {
+				extra_roots[num_extra++] = optarg;
+			}
+			break;
+		default:
+			usage(argv[0]);
+			return 2;
+		}
+	}
+	if (map_path == NULL && objdump_path == NULL) {
+		usage(argv[0]);
+		return 2;
+	}
+	if (budget_path != NULL) {
+		budgets = open_or_die(budget_path);
+	}
+
+	if (map_path != NULL) {
+		FILE *f = open_or_die(map_path);
+
+		if (map_read(f, &map) != 0) {
+			fprintf(stderr, "%s: %s: not a GNU ld map file\n", argv[0], map_path);
+			return 1;
+		}
+		fclose(f);
+		add_sizes(&map);
+		if (nm_path != NULL) {
+			f = open_or_die(nm_path);
+			add_symbols(f, &map);
+			fclose(f);
+		}
+		print_sizes(verbose);
+	}
+
+	if (objdump_path != NULL) {
+		FILE *f;
+
+		for (int i = optind; i < argc; i++) {
+			f = open_or_die(argv[i]);
+			if (stack_read_su(f, &g) != 0) {
+				fprintf(stderr, "%s: out of memory\n", argv[0]);
+				return 1;
+			}
+			fclose(f);
+		}
+		f = open_or_die(objdump_path);
+		if (stack_read_objdump(f, &g) != 0
+				|| (budgets != NULL && read_calls(budgets, &g) != 0)) {
+			fprintf(stderr, "%s: out of memory\n", argv[0]);
+			return 1;
+		}
+		fclose(f);
+
+		for (size_t i = 0; i < g.num_funcs; i++) {
+			if (g.funcs[i].defined && strcmp(g.funcs[i].name, "main") == 0) {
+				add_root(i);
+			}
+		}
+		for (size_t i = 0; i < g.num_funcs; i++) {
+			if (g.funcs[i].defined && is_handler(g.funcs[i].name)) {
+				add_root(i);
+			}
+		}
+		for (size_t k = 0; k < num_extra; k++) {
+			size_t i = stack_find(&g, extra_roots[k]);
+
+			if (i == SIZE_MAX) {
+				fprintf(stderr, "%s: -r %s: no such function\n", argv[0],
+						extra_roots[k]);
+				return 1;
+			}
+			add_root(i);
+		}
+		print_stack(&g, map_path != NULL);
+	}
+
+	if (budgets != NULL) {
+		printf("\n");
+		check_budgets(budgets, &g, map_path != NULL, objdump_path != NULL);
+		fclose(budgets);
+		printf("%u budgets checked, %u exceeded\n", (unsigned) checked,
+				(unsigned) exceeded);
+	}
+
+	free(modules);
+	map_free(&map);
+	stack_free(&g);
+	return exceeded ? 1 : 0;
+}
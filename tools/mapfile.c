@@ -0,0 +1,195 @@
+/*
+ * mapfile.c
+ *
+ * Reads the memory regions and input sections of a GNU ld map file
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "mapfile.h"
+
+// Output sections that take no space in the image
+static const char *const unallocated[] = {
+	".debug", ".comment", ".ARM.attributes", ".stab", ".gnu.attributes"
+};
+
+static bool is_unallocated(const char *name) {
+	for (size_t i = 0; i < sizeof(unallocated) / sizeof(unallocated[0]); i++) {
+		if (strncmp(name, unallocated[i], strlen(unallocated[i])) == 0) {
+			return true;
+		}
+	}
+	return false;
+}
+
+static const map_region_t *region_of(const map_t *map, uint32_t addr) {
+	for (size_t i = 0; i < map->num_regions; i++) {
+		const map_region_t *r = &map->regions[i];
+
+		if (addr >= r->origin && addr - r->origin < r->length) {
+			return r;
+		}
+	}
+	return NULL;
+}
+
+static void trim(char *s) {
+	size_t n = strlen(s);
+
+	while (n > 0 && (s[n - 1] == '\n' || s[n - 1] == '\r' || s[n - 1] == ' ')) {
+		s[--n] = '\0';
+	}
+}
+
+static int add_region(map_t *map, const char *name, uint32_t origin,
+		uint32_t length, const char *attributes) {
+	map_region_t *r = realloc(map->regions,
+			(map->num_regions + 1) * sizeof(*r));
+
+	if (r == NULL) {
+		return -1;
+	}
+	map->regions = r;
+	r = &map->regions[map->num_regions++];
+	r->name = strdup(name);
+	r->origin = origin;
+	r->length = length;
+	r->ram = strchr(attributes, 'w') != NULL;
+	return (r->name == NULL) ? -1 : 0;
+}
+
+static int add_section(map_t *map, size_t *cap, const char *name,
+		const char *file, uint32_t vma, uint32_t size, bool loaded_in_flash) {
+	const map_region_t *r = region_of(map, vma);
+	map_section_t *s;
+
+	if (size == 0 || r == NULL) {
+		return 0;
+	}
+	if (map->num_sections == *cap) {
+		*cap = *cap ? 2 * *cap : 256;
+		s = realloc(map->sections, *cap * sizeof(*s));
+		if (s == NULL) {
+			return -1;
+		}
+		map->sections = s;
+	}
+	s = &map->sections[map->num_sections++];
+	s->name = strdup(name);
+	s->file = strdup(file);
+	s->vma = vma;
+	s->size = size;
+	s->ram = r->ram;
+	s->flash = !r->ram || loaded_in_flash;
+	return (s->name == NULL || s->file == NULL) ? -1 : 0;
+}
+
+int map_read(FILE *f, map_t *map) {
+	char line[1024];
+	char pending[512] = "";  // input section name whose addresses wrap
+	bool in_regions = false, in_map = false;
+	bool skip = false;       // inside an unallocated output section
+	bool loaded_in_flash = false;
+	size_t cap = 0;
+
+	*map = (map_t) { 0 };
+	while (fgets(line, sizeof(line), f) != NULL) {
+		char name[512], file[512], attributes[16];
+		unsigned a, b, lma;
+
+		trim(line);
+		if (strcmp(line, "Memory Configuration") == 0) {
+			in_regions = true;
+			continue;
+		}
+		if (strcmp(line, "Linker script and memory map") == 0) {
+			in_regions = false;
+			in_map = true;
+			continue;
+		}
+		if (in_regions) {
+			attributes[0] = '\0';
+			if (sscanf(line, "%511s 0x%x 0x%x %15s", name, &a, &b, attributes) >= 3
+					&& strcmp(name, "*default*") != 0
+					&& add_region(map, name, a, b, attributes) != 0) {
+				return -1;
+			}
+			continue;
+		}
+		if (!in_map || line[0] == '\0') {
+			continue;
+		}
+
+		if (line[0] == '.') {
+			// Output section: ".data 0x1ffff000 0x10 load address 0x2170",
+			// or just its name with the addresses on the next line
+			int n = sscanf(line, "%511s 0x%x 0x%x load address 0x%x", name, &a,
+					&b, &lma);
+			const map_region_t *load = (n == 4) ? region_of(map, lma) : NULL;
+
+			skip = is_unallocated(name);
+			loaded_in_flash = load != NULL && !load->ram;
+			pending[0] = '\0';
+			continue;
+		}
+		if (skip || line[0] != ' ') {
+			continue;
+		}
+		if (line[1] != ' ') {
+			// " .text.name 0xaddr 0xsize file", " COMMON ..." or " *fill* ..."
+			int n = sscanf(line + 1, "%511s 0x%x 0x%x %511[^\n]", name, &a, &b,
+					file);
+
+			if (n == 1) {
+				strcpy(pending, name);
+				continue;
+			}
+			if (n == 3 && strcmp(name, "*fill*") == 0) {
+				file[0] = '\0';
+				n = 4;
+			}
+			if (n == 4 && add_section(map, &cap, name, file, a, b,
+					loaded_in_flash) != 0) {
+				return -1;
+			}
+			pending[0] = '\0';
+			continue;
+		}
+		// "   0xaddr 0xsize file" continuing a long section name; a line
+		// with an address and a symbol name only is a symbol
+		if (pending[0] != '\0') {
+			if (sscanf(line, " 0x%x 0x%x %511[^\n]", &a, &b, file) == 3
+					&& add_section(map, &cap, pending, file, a, b,
+							loaded_in_flash) != 0) {
+				return -1;
+			}
+			pending[0] = '\0';
+		}
+	}
+	return in_map ? 0 : -1;
+}
+
+void map_free(map_t *map) {
+	for (size_t i = 0; i < map->num_regions; i++) {
+		free(map->regions[i].name);
+	}
+	for (size_t i = 0; i < map->num_sections; i++) {
+		free(map->sections[i].name);
+		free(map->sections[i].file);
+	}
+	free(map->regions);
+	free(map->sections);
+	*map = (map_t) { 0 };
+}
+
+const map_section_t *map_find(const map_t *map, uint32_t addr) {
+	for (size_t i = 0; i < map->num_sections; i++) {
+		const map_section_t *s = &map->sections[i];
+
+		if (addr >= s->vma && addr - s->vma < s->size) {
+			return s;
+		}
+	}
+	return NULL;
+}
@@ -0,0 +1,56 @@
+/*
+ * mapfile.h
+ *
+ * Reads the memory regions and input sections of a GNU ld map file
+ */
+
+#ifndef _MAPFILE_H_
+#define _MAPFILE_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+/* A MEMORY region; writable regions are RAM, the others flash */
+typedef struct {
+	char *name;
+	uint32_t origin;
+	uint32_t length;
+	bool ram;
+} map_region_t;
+
+/* One input section placed by the linker */
+typedef struct {
+	char *name;       ///<Input section, e.g. .text.ISHAReset
+	char *file;       ///<Object or archive(member), "" for linker fill
+	uint32_t vma;     ///<Run address
+	uint32_t size;
+	bool flash;       ///<Occupies flash: runs from it or is loaded from it
+	bool ram;         ///<Occupies RAM at run time
+} map_section_t;
+
+typedef struct {
+	map_region_t *regions;
+	size_t num_regions;
+	map_section_t *sections;
+	size_t num_sections;
+} map_t;
+
+/*
+ * Reads a map file. Non-allocated output sections (debug info,
+ * comments, attributes) and empty input sections are left out.
+ *
+ * Returns:
+ *   0 on success, -1 if memory ran out or there was no memory map
+ */
+int map_read(FILE *f, map_t *map);
+
+void map_free(map_t *map);
+
+/*
+ * Returns the input section containing addr, or NULL
+ */
+const map_section_t *map_find(const map_t *map, uint32_t addr);
+
+#endif  // _MAPFILE_H_
@@ -0,0 +1,204 @@
+/*
+ * stackdepth.c
+ *
+ * Worst-case stack depth from -fstack-usage frame sizes and the calls
+ * found in objdump -d output
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "stackdepth.h"
+
+enum { UNVISITED, ON_PATH, DONE };
+
+size_t stack_find(const stack_graph_t *g, const char *name) {
+	for (size_t i = 0; i < g->num_funcs; i++) {
+		if (strcmp(g->funcs[i].name, name) == 0) {
+			return i;
+		}
+	}
+	return SIZE_MAX;
+}
+
+/*
+ * Returns the index of the function, adding it if it is new, or
+ * SIZE_MAX if memory ran out
+ */
+static size_t intern(stack_graph_t *g, const char *name) {
+	size_t i = stack_find(g, name);
+	stack_func_t *f;
+
+	if (i != SIZE_MAX) {
+		return i;
+	}
+	f = realloc(g->funcs, (g->num_funcs + 1) * sizeof(*f));
+	if (f == NULL) {
+		return SIZE_MAX;
+	}
+	g->funcs = f;
+	f = &g->funcs[g->num_funcs];
+	*f = (stack_func_t) { 0 };
+	f->name = strdup(name);
+	f->next = SIZE_MAX;
+	if (f->name == NULL) {
+		return SIZE_MAX;
+	}
+	return g->num_funcs++;
+}
+
+int stack_read_su(FILE *f, stack_graph_t *g) {
+	char line[1024];
+
+	while (fgets(line, sizeof(line), f) != NULL) {
+		char *tab = strchr(line, '\t');
+		char *name;
+		unsigned bytes;
+		size_t i;
+
+		if (tab == NULL) {
+			continue;
+		}
+		*tab = '\0';
+		// The name follows the third colon: file:line:column:name
+		name = strrchr(line, ':');
+		name = (name == NULL) ? line : name + 1;
+		if (sscanf(tab + 1, "%u", &bytes) != 1) {
+			continue;
+		}
+		i = intern(g, name);
+		if (i == SIZE_MAX) {
+			return -1;
+		}
+		// Static functions of the same name in several files: keep the
+		// largest, as the call graph cannot tell them apart either
+		if (!g->funcs[i].known || bytes > g->funcs[i].frame) {
+			g->funcs[i].frame = bytes;
+		}
+		g->funcs[i].known = true;
+		if (strstr(tab + 1, "dynamic") != NULL
+				&& strstr(tab + 1, "bounded") == NULL) {
+			g->funcs[i].dynamic = true;
+		}
+	}
+	return 0;
+}
+
+int stack_add_call(stack_graph_t *g, size_t caller, size_t callee) {
+	stack_func_t *f = &g->funcs[caller];
+	size_t *c;
+
+	for (size_t i = 0; i < f->num_callees; i++) {
+		if (f->callees[i] == callee) {
+			return 0;
+		}
+	}
+	c = realloc(f->callees, (f->num_callees + 1) * sizeof(*c));
+	if (c == NULL) {
+		return -1;
+	}
+	f->callees = c;
+	f->callees[f->num_callees++] = callee;
+	return 0;
+}
+
+int stack_read_objdump(FILE *f, stack_graph_t *g) {
+	char line[1024];
+	size_t current = SIZE_MAX;
+
+	while (fgets(line, sizeof(line), f) != NULL) {
+		char name[512], mnemonic[16], target[512];
+		unsigned addr;
+		char *fields[4] = { NULL };
+		char *p = line;
+		int n = 0;
+
+		// "00000c0c <ISHAReset>:" starts a function
+		if (sscanf(line, "%x <%511[^>]>:", &addr, name) == 2) {
+			current = intern(g, name);
+			if (current == SIZE_MAX) {
+				return -1;
+			}
+			g->funcs[current].defined = true;
+			continue;
+		}
+		if (current == SIZE_MAX) {
+			continue;
+		}
+		// "     c1a:\tf000 f81b \tbl\tc54 <ISHAResult>": address, encoding,
+		// mnemonic and operands, separated by tabs
+		while (n < 4 && (fields[n] = strsep(&p, "\t")) != NULL) {
+			n++;
+		}
+		if (n < 4 || sscanf(fields[2], "%15s", mnemonic) != 1) {
+			continue;
+		}
+		if (strcmp(mnemonic, "blx") == 0 && fields[3][0] == 'r') {
+			g->funcs[current].indirect = true;
+			continue;
+		}
+		if (strcmp(mnemonic, "bl") != 0 && strcmp(mnemonic, "blx") != 0
+				&& strcmp(mnemonic, "b") != 0 && strcmp(mnemonic, "b.n") != 0
+				&& strcmp(mnemonic, "b.w") != 0) {
+			continue;
+		}
+		// Only branches to the start of a function: "<name>", not
+		// "<name+0x12>"
+		if (sscanf(fields[3], "%*x <%511[^>]>", target) != 1
+				|| strchr(target, '+') != NULL
+				|| strcmp(target, g->funcs[current].name) == 0) {
+			continue;
+		}
+		{
+			size_t callee = intern(g, target);
+
+			if (callee == SIZE_MAX || stack_add_call(g, current, callee) != 0) {
+				return -1;
+			}
+		}
+	}
+	return 0;
+}
+
+static uint32_t visit(stack_graph_t *g, size_t i) {
+	stack_func_t *f = &g->funcs[i];
+	uint32_t deepest = 0;
+
+	if (f->state == DONE) {
+		return f->depth;
+	}
+	if (f->state == ON_PATH) {
+		f->recursive = true;
+		return 0;
+	}
+	f->state = ON_PATH;
+	f->incomplete = !f->known || f->dynamic || f->indirect;
+	for (size_t k = 0; k < f->num_callees; k++) {
+		size_t c = f->callees[k];
+		uint32_t d = visit(g, c);
+
+		// Reaching a cycle or a gap anywhere below taints f too
+		f->recursive |= g->funcs[c].recursive;
+		f->incomplete |= g->funcs[c].incomplete;
+		if (f->next == SIZE_MAX || d > deepest) {
+			deepest = d;
+			f->next = c;
+		}
+	}
+	f->depth = f->frame + deepest;
+	f->state = DONE;
+	return f->depth;
+}
+
+uint32_t stack_depth(stack_graph_t *g, size_t root) {
+	return visit(g, root);
+}
+
+void stack_free(stack_graph_t *g) {
+	for (size_t i = 0; i < g->num_funcs; i++) {
+		free(g->funcs[i].name);
+		free(g->funcs[i].callees);
+	}
+	free(g->funcs);
+	*g = (stack_graph_t) { 0 };
+}
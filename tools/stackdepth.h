@@ -0,0 +1,86 @@
+/*
+ * stackdepth.h
+ *
+ * Worst-case stack depth from -fstack-usage frame sizes and the calls
+ * found in objdump -d output
+ */
+
+#ifndef _STACKDEPTH_H_
+#define _STACKDEPTH_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+// Stacked by the core on exception entry: 8 words, plus a word of
+// padding when the stack pointer was not 8-byte aligned
+#define EXCEPTION_FRAME_BYTES 36
+
+typedef struct {
+	char *name;
+	uint32_t frame;      ///<Bytes, from the .su files
+	bool known;          ///<A .su entry was found
+	bool dynamic;        ///<alloca or VLA: the frame is a lower bound
+	bool indirect;       ///<Makes calls through a register
+	bool defined;        ///<Appears in the disassembly
+	size_t *callees;
+	size_t num_callees;
+	// Filled in by stack_depth()
+	int state;
+	uint32_t depth;
+	size_t next;         ///<Deepest callee, or SIZE_MAX
+	bool recursive;      ///<On or above a call cycle
+	bool incomplete;     ///<Unknown frames or indirect calls at or below
+} stack_func_t;
+
+typedef struct {
+	stack_func_t *funcs;
+	size_t num_funcs;
+} stack_graph_t;
+
+/*
+ * Adds the frames of a .su file: "file:line:col:name<TAB>bytes<TAB>kind"
+ *
+ * Returns:
+ *   0 on success, -1 if memory ran out
+ */
+int stack_read_su(FILE *f, stack_graph_t *g);
+
+/*
+ * Adds the functions of objdump -d output and the calls they make: bl,
+ * and b to the start of another function (tail calls). blx through a
+ * register marks the caller as making indirect calls.
+ *
+ * Returns:
+ *   0 on success, -1 if memory ran out
+ */
+int stack_read_objdump(FILE *f, stack_graph_t *g);
+
+/*
+ * Adds a call the disassembly cannot show, e.g. through a function
+ * pointer
+ *
+ * Returns:
+ *   0 on success, -1 if memory ran out
+ */
+int stack_add_call(stack_graph_t *g, size_t caller, size_t callee);
+
+/*
+ * Returns the index of the function, or SIZE_MAX
+ */
+size_t stack_find(const stack_graph_t *g, const char *name);
+
+/*
+ * Computes the worst-case depth of every function reachable from
+ * root: its frame plus the deepest of its callees. A call cycle is
+ * followed once; the functions that reach it are marked recursive.
+ *
+ * Returns:
+ *   Depth of root in bytes
+ */
+uint32_t stack_depth(stack_graph_t *g, size_t root);
+
+void stack_free(stack_graph_t *g);
+
+#endif  // _STACKDEPTH_H_